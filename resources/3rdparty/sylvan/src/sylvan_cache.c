@@ -74,6 +74,39 @@ static uint32_t*          cache_status;
 
 static uint64_t           next_opid;
 
+/**
+ * Lookup counters of the cache, only maintained if enabled with cache_enablestats. Every thread
+ * counts in its own slot (one cache line each, to avoid false sharing). Threads beyond
+ * CACHE_COUNTERS_MAX share the last slot, which makes the counters only approximate in that case.
+ */
+#define CACHE_COUNTERS_MAX 256
+
+typedef struct cache_counters {
+    uint64_t            hits;
+    uint64_t            misses;
+    char                pad[LINE_SIZE-2*sizeof(uint64_t)];
+} __attribute__((aligned(LINE_SIZE))) cache_counters_t;
+
+static int                cache_counters_enabled;
+static cache_counters_t   cache_counters[CACHE_COUNTERS_MAX];
+static int                cache_counters_next;
+static __thread cache_counters_t *cache_counters_local;
+
+static inline int
+cache_count(int result)
+{
+    if (__builtin_expect(!cache_counters_enabled, 1)) return result;
+    cache_counters_t *counters = cache_counters_local;
+    if (__builtin_expect(counters == NULL, 0)) {
+        int index = __sync_fetch_and_add(&cache_counters_next, 1);
+        if (index >= CACHE_COUNTERS_MAX) index = CACHE_COUNTERS_MAX-1;
+        counters = cache_counters_local = cache_counters + index;
+    }
+    if (result) counters->hits++;
+    else counters->misses++;
+    return result;
+}
+
 uint64_t
 cache_next_opid()
 {
@@ -112,8 +145,8 @@ cache_hash6(uint64_t a, uint64_t b, uint64_t c, uint64_t d, uint64_t e, uint64_t
     return hash;
 }
 
-int
-cache_get6(uint64_t a, uint64_t b, uint64_t c, uint64_t d, uint64_t e, uint64_t f, uint64_t *res1, uint64_t *res2)
+static inline int
+cache_get6_lookup(uint64_t a, uint64_t b, uint64_t c, uint64_t d, uint64_t e, uint64_t f, uint64_t *res1, uint64_t *res2)
 {
     const uint64_t hash = cache_hash6(a, b, c, d, e, f);
 #if CACHE_MASK
@@ -139,6 +172,12 @@ cache_get6(uint64_t a, uint64_t b, uint64_t c, uint64_t d, uint64_t e, uint64_t
     return *s_bucket == s ? 1 : 0;
 }
 
+int
+cache_get6(uint64_t a, uint64_t b, uint64_t c, uint64_t d, uint64_t e, uint64_t f, uint64_t *res1, uint64_t *res2)
+{
+    return cache_count(cache_get6_lookup(a, b, c, d, e, f, res1, res2));
+}
+
 int
 cache_put6(uint64_t a, uint64_t b, uint64_t c, uint64_t d, uint64_t e, uint64_t f, uint64_t res1, uint64_t res2)
 {
@@ -175,8 +214,8 @@ cache_put6(uint64_t a, uint64_t b, uint64_t c, uint64_t d, uint64_t e, uint64_t
     return 1;
 }
 
-int
-cache_get(uint64_t a, uint64_t b, uint64_t c, uint64_t *res)
+static inline int
+cache_get_lookup(uint64_t a, uint64_t b, uint64_t c, uint64_t *res)
 {
     const uint64_t hash = cache_hash(a, b, c);
 #if CACHE_MASK
@@ -200,6 +239,12 @@ cache_get(uint64_t a, uint64_t b, uint64_t c, uint64_t *res)
     return *s_bucket == s ? 1 : 0;
 }
 
+int
+cache_get(uint64_t a, uint64_t b, uint64_t c, uint64_t *res)
+{
+    return cache_count(cache_get_lookup(a, b, c, res));
+}
+
 int
 cache_put(uint64_t a, uint64_t b, uint64_t c, uint64_t res)
 {
@@ -310,3 +355,29 @@ cache_getmaxsize()
 {
     return cache_max;
 }
+
+void
+cache_enablestats(int enabled)
+{
+    cache_counters_enabled = enabled;
+}
+
+void
+cache_getstats(uint64_t *hits, uint64_t *misses)
+{
+    *hits = 0;
+    *misses = 0;
+    for (int i=0; i<CACHE_COUNTERS_MAX; i++) {
+        *hits += cache_counters[i].hits;
+        *misses += cache_counters[i].misses;
+    }
+}
+
+void
+cache_resetstats()
+{
+    for (int i=0; i<CACHE_COUNTERS_MAX; i++) {
+        cache_counters[i].hits = 0;
+        cache_counters[i].misses = 0;
+    }
+}
@@ -123,6 +123,25 @@ size_t cache_getsize(void);
 
 size_t cache_getmaxsize(void);
 
+/**
+ * Enable or disable counting the lookups in the cache. Counting is disabled by default, as it
+ * costs a thread-local access on every lookup.
+ */
+void cache_enablestats(int enabled);
+
+/**
+ * Get the number of lookups in the cache that succeeded (hits) and failed (misses) since the
+ * last call to cache_resetstats, counting only while enabled. The counters are kept per thread
+ * and are not synchronized, so the result is only exact if no thread accesses the cache
+ * concurrently.
+ */
+void cache_getstats(uint64_t *hits, uint64_t *misses);
+
+/**
+ * Reset the lookup counters of the cache.
+ */
+void cache_resetstats(void);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -434,4 +434,13 @@ VOID_TASK_IMPL_2(sylvan_table_usage, size_t*, filled, size_t*, total)
     if (total != NULL) *total = tot;
 }
 
+void
+sylvan_table_memory(void **hashes, size_t *hashes_size, void **data, size_t *data_size)
+{
+    *hashes = nodes->table;
+    *hashes_size = nodes->max_size * 8;
+    *data = nodes->data;
+    *data_size = nodes->max_size * 16;
+}
+
 
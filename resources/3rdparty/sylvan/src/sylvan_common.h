@@ -86,6 +86,12 @@ void sylvan_register_quit(quit_cb cb);
 VOID_TASK_DECL_2(sylvan_table_usage, size_t*, size_t*);
 #define sylvan_table_usage(filled, total) (CALL(sylvan_table_usage, filled, total))
 
+/**
+ * Return the memory areas of the nodes table, i.e. the hash array and the data array, for
+ * example to set a memory policy for them before they are first accessed.
+ */
+void sylvan_table_memory(void **hashes, size_t *hashes_size, void **data, size_t *data_size);
+
 /**
  * GARBAGE COLLECTION
  *
@@ -555,6 +555,11 @@ VOID_TASK_IMPL_1(llmsset_clear_data, llmsset_t, dbs)
 
 VOID_TASK_IMPL_1(llmsset_clear_hashes, llmsset_t, dbs)
 {
+#if defined(__linux__) && defined(MADV_DONTNEED)
+    // discarding the pages of the private anonymous mapping zero-fills them on the next access,
+    // but unlike a new mapping it keeps the memory policy of the area (e.g. interleaving)
+    if (madvise(dbs->table, dbs->max_size * 8, MADV_DONTNEED) == 0) return;
+#endif
     // just reallocate...
     if (mmap(dbs->table, dbs->max_size * 8, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) != (void*)-1) {
 #if defined(madvise) && defined(MADV_RANDOM)
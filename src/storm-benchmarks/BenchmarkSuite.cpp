@@ -0,0 +1,125 @@
+#include "storm-benchmarks/BenchmarkSuite.h"
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <thread>
+
+#include "json.hpp"
+
+#include "storm/utility/storm-version.h"
+
+namespace storm {
+    namespace benchmarks {
+
+        namespace {
+            double median(std::vector<double> values) {
+                std::sort(values.begin(), values.end());
+                uint64_t size = values.size();
+                return size % 2 == 1 ? values[size / 2] : (values[size / 2 - 1] + values[size / 2]) / 2.0;
+            }
+        }
+
+        BenchmarkSuite::BenchmarkSuite(uint64_t repetitions, bool quick, std::set<std::string> const& groups) : repetitions(std::max<uint64_t>(1, repetitions)), quick(quick), groups(groups) {
+            // Intentionally left empty.
+        }
+
+        bool BenchmarkSuite::isQuick() const {
+            return quick;
+        }
+
+        bool BenchmarkSuite::isGroupSelected(std::string const& group) const {
+            return groups.empty() || groups.find(group) != groups.end();
+        }
+
+        void BenchmarkSuite::run(std::string const& group, std::string const& name, Parameters const& parameters, std::string const& workUnit, std::function<uint64_t ()> const& function) {
+            if (!isGroupSelected(group)) {
+                return;
+            }
+
+            BenchmarkResult result;
+            result.group = group;
+            result.name = name;
+            result.parameters = parameters;
+            result.workUnit = workUnit;
+
+            // Perform one repetition to warm up the caches.
+            result.work = function();
+            for (uint64_t repetition = 0; repetition < repetitions; ++repetition) {
+                auto start = std::chrono::high_resolution_clock::now();
+                function();
+                result.times.push_back(std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count());
+            }
+
+            double medianTime = median(result.times);
+            std::cout << std::left << std::setw(50) << (group + "/" + name) << std::right << std::setw(12) << std::fixed << std::setprecision(3) << medianTime * 1000.0 << " ms";
+            if (result.work > 0 && medianTime > 0) {
+                std::cout << std::setw(12) << std::setprecision(2) << result.work / medianTime / 1e6 << " M" << workUnit << "/s";
+            }
+            std::cout << std::endl;
+            results.push_back(std::move(result));
+        }
+
+        std::vector<BenchmarkResult> const& BenchmarkSuite::getResults() const {
+            return results;
+        }
+
+        void BenchmarkSuite::exportToJson(std::ostream& out) const {
+            nlohmann::json report;
+            report["schema-version"] = resultSchemaVersion;
+
+            nlohmann::json build;
+            build["version"] = storm::utility::StormVersion::shortVersionString();
+            build["revision"] = storm::utility::StormVersion::gitRevisionHash;
+            build["compiler"] = storm::utility::StormVersion::cxxCompiler;
+            build["flags"] = storm::utility::StormVersion::cxxFlags;
+            report["storm"] = build;
+
+            nlohmann::json machine;
+            machine["system"] = storm::utility::StormVersion::systemName;
+            machine["hardware-threads"] = std::thread::hardware_concurrency();
+            report["machine"] = machine;
+
+            std::time_t now = std::time(nullptr);
+            char date[32];
+            std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+            report["date"] = date;
+            report["repetitions"] = repetitions;
+            report["quick"] = quick;
+
+            nlohmann::json benchmarks = nlohmann::json::array();
+            for (auto const& result : results) {
+                nlohmann::json benchmark;
+                benchmark["group"] = result.group;
+                benchmark["name"] = result.name;
+                nlohmann::json parameters = nlohmann::json::object();
+                for (auto const& parameter : result.parameters) {
+                    parameters[parameter.first] = parameter.second;
+                }
+                benchmark["parameters"] = parameters;
+
+                nlohmann::json time;
+                time["min"] = *std::min_element(result.times.begin(), result.times.end());
+                time["median"] = median(result.times);
+                time["mean"] = std::accumulate(result.times.begin(), result.times.end(), 0.0) / result.times.size();
+                time["max"] = *std::max_element(result.times.begin(), result.times.end());
+                time["samples"] = result.times;
+                benchmark["time"] = time;
+
+                nlohmann::json work;
+                work["amount"] = result.work;
+                work["unit"] = result.workUnit;
+                double medianTime = median(result.times);
+                work["throughput"] = medianTime > 0 ? result.work / medianTime : 0.0;
+                benchmark["work"] = work;
+                benchmarks.push_back(benchmark);
+            }
+            report["benchmarks"] = benchmarks;
+            out << report.dump(4) << std::endl;
+        }
+
+    }
+}
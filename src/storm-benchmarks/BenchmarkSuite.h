@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <ostream>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace storm {
+    namespace benchmarks {
+
+        /*!
+         * The version of the format in which the results are exported. It has to be increased whenever the meaning of an
+         * existing field changes or a field is removed, such that results of different versions are not compared by
+         * accident. See result.schema.json for a description of the format.
+         */
+        uint64_t const resultSchemaVersion = 1;
+
+        /*!
+         * The parameters that identify a benchmark besides its group and name, e.g. the size of the input.
+         */
+        typedef std::map<std::string, std::string> Parameters;
+
+        /*!
+         * The measurements of a single benchmark.
+         */
+        struct BenchmarkResult {
+            std::string group;
+            std::string name;
+            Parameters parameters;
+
+            // The time (in seconds) of every repetition.
+            std::vector<double> times;
+
+            // The amount of work performed in every repetition and its unit (e.g. the number of matrix entries).
+            uint64_t work;
+            std::string workUnit;
+        };
+
+        /*!
+         * Runs benchmarks and collects their results. Every benchmark is executed once to warm up the caches and then
+         * repeated a fixed number of times. All inputs are generated with fixed seeds, so the results are reproducible
+         * (up to the noise of the machine).
+         */
+        class BenchmarkSuite {
+        public:
+            /*!
+             * Creates a suite.
+             *
+             * @param repetitions The number of measured repetitions of every benchmark.
+             * @param quick If set, the benchmarks use smaller inputs, which is useful to check that they work at all.
+             * @param groups The groups of benchmarks to run. If empty, all groups are run.
+             */
+            BenchmarkSuite(uint64_t repetitions, bool quick, std::set<std::string> const& groups);
+
+            /*!
+             * Retrieves whether the benchmarks are to use smaller inputs.
+             */
+            bool isQuick() const;
+
+            /*!
+             * Retrieves whether the benchmarks of the given group are to be run. This can be used to skip the (possibly
+             * expensive) preparation of the inputs of a group.
+             */
+            bool isGroupSelected(std::string const& group) const;
+
+            /*!
+             * Runs the given benchmark if it is selected.
+             *
+             * @param group The group of the benchmark.
+             * @param name The name of the benchmark within the group.
+             * @param parameters The parameters of the benchmark.
+             * @param workUnit The unit of the work performed by the benchmark.
+             * @param function The function to measure. It returns the amount of work it performed.
+             */
+            void run(std::string const& group, std::string const& name, Parameters const& parameters, std::string const& workUnit, std::function<uint64_t ()> const& function);
+
+            /*!
+             * Retrieves the results of all benchmarks that were run so far.
+             */
+            std::vector<BenchmarkResult> const& getResults() const;
+
+            /*!
+             * Writes the results in the JSON format described by result.schema.json.
+             *
+             * @param out The stream to write to.
+             */
+            void exportToJson(std::ostream& out) const;
+
+        private:
+            uint64_t repetitions;
+            bool quick;
+            std::set<std::string> groups;
+            std::vector<BenchmarkResult> results;
+        };
+
+        /*!
+         * Benchmarks of the sparse matrix (multiplication and reduction) and its compact layout.
+         */
+        void runMatrixBenchmarks(BenchmarkSuite& suite);
+
+        /*!
+         * Benchmarks of bit vector operations and the bit vector hash map.
+         */
+        void runBitVectorBenchmarks(BenchmarkSuite& suite);
+
+        /*!
+         * Benchmarks of the explicit model builder on the bundled PRISM models.
+         */
+        void runBuilderBenchmarks(BenchmarkSuite& suite);
+
+        /*!
+         * Benchmarks of value and policy iteration and of the SCC decomposition.
+         */
+        void runSolverBenchmarks(BenchmarkSuite& suite);
+
+        /*!
+         * Benchmarks of symbolic model building and reachability with CUDD and Sylvan.
+         */
+        void runSymbolicBenchmarks(BenchmarkSuite& suite);
+
+        /*!
+         * Benchmarks of the evaluation of the transition functions of parametric models with carl and compiled.
+         */
+        void runParametricBenchmarks(BenchmarkSuite& suite);
+
+    }
+}
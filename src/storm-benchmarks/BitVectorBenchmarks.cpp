@@ -0,0 +1,96 @@
+#include "storm-benchmarks/BenchmarkSuite.h"
+
+#include <random>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+
+namespace storm {
+    namespace benchmarks {
+
+        namespace {
+            storm::storage::BitVector createRandomBitVector(uint64_t length, std::mt19937_64& generator) {
+                storm::storage::BitVector result(length);
+                for (uint64_t bitIndex = 0; bitIndex + 64 <= length; bitIndex += 64) {
+                    result.setFromInt(bitIndex, 64, generator());
+                }
+                return result;
+            }
+        }
+
+        void runBitVectorBenchmarks(BenchmarkSuite& suite) {
+            std::string const group = "bitvector";
+            if (!suite.isGroupSelected(group)) {
+                return;
+            }
+
+            std::mt19937_64 generator(42);
+            uint64_t length = suite.isQuick() ? (1ull << 16) : (1ull << 26);
+            storm::storage::BitVector first = createRandomBitVector(length, generator);
+            storm::storage::BitVector second = createRandomBitVector(length, generator);
+            Parameters parameters = {{"bits", std::to_string(length)}};
+
+            suite.run(group, "and", parameters, "bits", [&] () {
+                storm::storage::BitVector result = first & second;
+                return length;
+            });
+            suite.run(group, "or-assign", parameters, "bits", [&] () {
+                storm::storage::BitVector result = first;
+                result |= second;
+                return length;
+            });
+            suite.run(group, "complement", parameters, "bits", [&] () {
+                storm::storage::BitVector result = ~first;
+                return length;
+            });
+            suite.run(group, "count", parameters, "bits", [&] () {
+                volatile uint64_t count = first.getNumberOfSetBits();
+                (void) count;
+                return length;
+            });
+            suite.run(group, "iterate", parameters, "bits", [&] () {
+                volatile uint64_t sum = 0;
+                for (auto index : first) {
+                    sum += index;
+                }
+                return length;
+            });
+            suite.run(group, "subset", parameters, "bits", [&] () {
+                volatile bool subset = (first & second).isSubsetOf(first);
+                (void) subset;
+                return length;
+            });
+
+            // The hash map is used to store the states during the exploration, so we use keys of a typical state size.
+            uint64_t const keyLength = 128;
+            uint64_t numberOfKeys = suite.isQuick() ? 10000 : 2000000;
+            std::vector<storm::storage::BitVector> keys;
+            keys.reserve(numberOfKeys);
+            for (uint64_t key = 0; key < numberOfKeys; ++key) {
+                keys.push_back(createRandomBitVector(keyLength, generator));
+            }
+            Parameters hashMapParameters = {{"keys", std::to_string(numberOfKeys)}, {"bits", std::to_string(keyLength)}};
+
+            suite.run(group, "hashmap-insert", hashMapParameters, "keys", [&] () {
+                storm::storage::BitVectorHashMap<uint32_t> map(keyLength);
+                for (uint64_t key = 0; key < numberOfKeys; ++key) {
+                    map.findOrAdd(keys[key], static_cast<uint32_t>(key));
+                }
+                return numberOfKeys;
+            });
+
+            storm::storage::BitVectorHashMap<uint32_t> map(keyLength, numberOfKeys);
+            for (uint64_t key = 0; key < numberOfKeys; ++key) {
+                map.findOrAdd(keys[key], static_cast<uint32_t>(key));
+            }
+            suite.run(group, "hashmap-find", hashMapParameters, "keys", [&] () {
+                volatile uint64_t sum = 0;
+                for (auto const& key : keys) {
+                    sum += map.getValue(key);
+                }
+                return numberOfKeys;
+            });
+        }
+
+    }
+}
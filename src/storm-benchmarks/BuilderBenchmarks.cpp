@@ -0,0 +1,38 @@
+#include "storm-benchmarks/BenchmarkSuite.h"
+
+#include "storm-config.h"
+
+#include "storm/api/builder.h"
+#include "storm/api/model_descriptions.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+namespace storm {
+    namespace benchmarks {
+
+        void runBuilderBenchmarks(BenchmarkSuite& suite) {
+            std::string const group = "builder";
+            if (!suite.isGroupSelected(group)) {
+                return;
+            }
+
+            std::vector<std::string> models;
+            if (suite.isQuick()) {
+                models = {"dtmc/die.pm", "mdp/two_dice.nm", "dtmc/crowds-5-5.pm"};
+            } else {
+                models = {"dtmc/crowds-5-5.pm", "dtmc/brp-16-2.pm", "dtmc/nand-5-2.pm", "dtmc/leader-3-5.pm", "mdp/leader4.nm", "mdp/csma2-2.nm", "mdp/wlan0-2-2.nm", "mdp/firewire3-0.5.nm", "ctmc/tandem5.sm"};
+            }
+
+            for (auto const& model : models) {
+                storm::storage::SymbolicModelDescription program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/" + model);
+                storm::builder::BuilderOptions options;
+                options.setBuildAllLabels().setBuildAllRewardModels();
+                suite.run(group, "explicit", {{"model", model}}, "states", [&] () {
+                    return storm::api::buildSparseModel<double>(program, options)->getNumberOfStates();
+                });
+            }
+        }
+
+    }
+}
@@ -0,0 +1,74 @@
+#include "storm-benchmarks/BenchmarkSuite.h"
+#include "storm-benchmarks/RandomMatrix.h"
+
+#include <iostream>
+#include <sstream>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/CompactSparseMatrix.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/utility/simd.h"
+
+namespace storm {
+    namespace benchmarks {
+
+        void runMatrixBenchmarks(BenchmarkSuite& suite) {
+            std::string const group = "matrix";
+            if (!suite.isGroupSelected(group)) {
+                return;
+            }
+
+            uint64_t numberOfStates = suite.isQuick() ? 10000 : 1000000;
+            uint64_t choicesPerState = 4;
+            uint64_t successorsPerChoice = 8;
+            storm::storage::SparseMatrix<double> matrix = createRandomMatrix(numberOfStates, choicesPerState, successorsPerChoice);
+            Parameters parameters = {{"states", std::to_string(numberOfStates)}, {"choices", std::to_string(choicesPerState)}, {"successors", std::to_string(successorsPerChoice)}};
+
+            std::vector<double> x(matrix.getColumnCount(), 0.5);
+            std::vector<double> b(matrix.getRowCount(), 0.1);
+            std::vector<double> rowResult(matrix.getRowCount());
+            std::vector<double> groupResult(matrix.getRowGroupCount());
+            std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+            uint64_t entryCount = matrix.getEntryCount();
+
+            suite.run(group, "multiply", parameters, "entries", [&] () {
+                matrix.multiplyWithVector(x, rowResult, &b);
+                return entryCount;
+            });
+            suite.run(group, "multiply-reduce", parameters, "entries", [&] () {
+                matrix.multiplyAndReduce(storm::solver::OptimizationDirection::Maximize, rowGroupIndices, x, &b, groupResult, nullptr);
+                return entryCount;
+            });
+            suite.run(group, "multiply-gauss-seidel", parameters, "entries", [&] () {
+                std::vector<double> y = x;
+                matrix.multiplyAndReduceBackward(storm::solver::OptimizationDirection::Maximize, rowGroupIndices, y, &b, y, nullptr);
+                return entryCount;
+            });
+            suite.run(group, "transpose", parameters, "entries", [&] () {
+                matrix.transpose(true);
+                return entryCount;
+            });
+
+            for (auto kernel : {storm::utility::simd::SimdKernel::None, storm::utility::simd::SimdKernel::Avx2, storm::utility::simd::SimdKernel::Avx512}) {
+                std::stringstream kernelName;
+                kernelName << kernel;
+                if (!storm::utility::simd::isSupported(kernel)) {
+                    std::cout << "Skipping the " << kernelName.str() << " kernel, because it is not supported on this machine." << std::endl;
+                    continue;
+                }
+                storm::storage::CompactSparseMatrix<double> compactMatrix(matrix, kernel);
+                Parameters compactParameters = parameters;
+                compactParameters["kernel"] = kernelName.str();
+                suite.run(group, "compact-multiply", compactParameters, "entries", [&] () {
+                    compactMatrix.multiplyWithVector(x, rowResult, &b);
+                    return entryCount;
+                });
+                suite.run(group, "compact-multiply-reduce", compactParameters, "entries", [&] () {
+                    compactMatrix.multiplyAndReduce(storm::solver::OptimizationDirection::Maximize, rowGroupIndices, x, &b, groupResult, nullptr);
+                    return entryCount;
+                });
+            }
+        }
+
+    }
+}
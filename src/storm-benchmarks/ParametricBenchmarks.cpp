@@ -0,0 +1,102 @@
+#include "storm-benchmarks/BenchmarkSuite.h"
+
+#include <random>
+#include <unordered_set>
+
+#include "storm-config.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/api/builder.h"
+#include "storm/api/model_descriptions.h"
+#include "storm/api/properties.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+#include "storm-pars/utility/CompiledRationalFunctions.h"
+#include "storm-pars/utility/parametric.h"
+
+namespace storm {
+    namespace benchmarks {
+
+        void runParametricBenchmarks(BenchmarkSuite& suite) {
+            std::string const group = "parametric";
+            if (!suite.isGroupSelected(group)) {
+                return;
+            }
+
+            std::vector<std::pair<std::string, std::string>> models;
+            if (suite.isQuick()) {
+                models = {{"pdtmc/brp16_2.pm", "P=? [F s=5]"}};
+            } else {
+                models = {{"pdtmc/brp16_2.pm", "P=? [F s=5]"}, {"pdtmc/crowds3_5.pm", "P=? [F \"observe0Greater1\"]"}};
+            }
+            uint64_t numberOfValuations = suite.isQuick() ? 100 : 10000;
+
+            for (auto const& model : models) {
+                storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/" + model.first);
+                auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(model.second, program));
+                auto dtmc = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+                // Collect the distinct non-constant transition functions, as done by the model instantiator.
+                std::unordered_set<storm::RationalFunction> functionSet;
+                for (auto const& entry : dtmc->getTransitionMatrix()) {
+                    if (!storm::utility::isConstant(entry.getValue())) {
+                        functionSet.insert(entry.getValue());
+                    }
+                }
+                std::vector<storm::RationalFunction> functions(functionSet.begin(), functionSet.end());
+                storm::utility::CompiledRationalFunctions compiledFunctions;
+                for (auto const& function : functions) {
+                    compiledFunctions.addFunction(function);
+                }
+
+                // Draw random valuations from the interior of the parameter space.
+                std::mt19937_64 generator(42);
+                std::uniform_real_distribution<double> distribution(0.05, 0.95);
+                uint64_t numberOfVariables = compiledFunctions.getVariables().size();
+                std::vector<double> batchValues(numberOfVariables * numberOfValuations);
+                std::vector<std::vector<double>> values(numberOfValuations, std::vector<double>(numberOfVariables));
+                std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> valuations(numberOfValuations);
+                for (uint64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+                    for (uint64_t variable = 0; variable < numberOfVariables; ++variable) {
+                        double value = distribution(generator);
+                        values[valuation][variable] = value;
+                        batchValues[variable * numberOfValuations + valuation] = value;
+                        valuations[valuation].emplace(compiledFunctions.getVariables()[variable], storm::utility::convertNumber<storm::RationalFunctionCoefficient>(value));
+                    }
+                }
+
+                Parameters parameters = {{"model", model.first}, {"functions", std::to_string(functions.size())}, {"instructions", std::to_string(compiledFunctions.getNumberOfInstructions())}, {"valuations", std::to_string(numberOfValuations)}};
+                uint64_t work = functions.size() * numberOfValuations;
+
+                suite.run(group, "evaluate-carl", parameters, "evaluations", [&] () {
+                    volatile double sum = 0.0;
+                    for (auto const& valuation : valuations) {
+                        for (auto const& function : functions) {
+                            sum += storm::utility::convertNumber<double>(storm::utility::parametric::evaluate(function, valuation));
+                        }
+                    }
+                    return work;
+                });
+                suite.run(group, "evaluate-compiled", parameters, "evaluations", [&] () {
+                    std::vector<double> registers = compiledFunctions.createRegisters();
+                    std::vector<double> results(functions.size());
+                    volatile double sum = 0.0;
+                    for (auto const& valuation : values) {
+                        compiledFunctions.evaluate(valuation.data(), registers, results.data());
+                        sum += results.front();
+                    }
+                    return work;
+                });
+                suite.run(group, "evaluate-compiled-batch", parameters, "evaluations", [&] () {
+                    std::vector<double> results(functions.size() * numberOfValuations);
+                    compiledFunctions.evaluateBatch(numberOfValuations, batchValues.data(), results.data());
+                    volatile double sum = results.front();
+                    (void) sum;
+                    return work;
+                });
+            }
+        }
+
+    }
+}
@@ -0,0 +1,35 @@
+#include "storm-benchmarks/RandomMatrix.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace storm {
+    namespace benchmarks {
+
+        storm::storage::SparseMatrix<double> createRandomMatrix(uint64_t numberOfStates, uint64_t choicesPerState, uint64_t successorsPerChoice, double rowSum) {
+            std::mt19937_64 generator(42);
+            std::uniform_int_distribution<uint64_t> successorDistribution(0, numberOfStates - 1);
+
+            storm::storage::SparseMatrixBuilder<double> builder(numberOfStates * choicesPerState, numberOfStates, numberOfStates * choicesPerState * successorsPerChoice, true, true, numberOfStates);
+            std::vector<uint64_t> successors(successorsPerChoice);
+            uint64_t row = 0;
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                builder.newRowGroup(row);
+                for (uint64_t choice = 0; choice < choicesPerState; ++choice, ++row) {
+                    for (auto& successor : successors) {
+                        successor = successorDistribution(generator);
+                    }
+                    std::sort(successors.begin(), successors.end());
+                    successors.erase(std::unique(successors.begin(), successors.end()), successors.end());
+                    for (auto const& successor : successors) {
+                        builder.addNextValue(row, successor, rowSum / successors.size());
+                    }
+                    successors.resize(successorsPerChoice);
+                }
+            }
+            return builder.build();
+        }
+
+    }
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace benchmarks {
+
+        /*!
+         * Creates a random MDP-like matrix in which every state has the given number of choices and every choice has
+         * the given number of successors. The matrix only depends on its parameters, i.e. it is the same for every run.
+         *
+         * @param numberOfStates The number of states (row groups).
+         * @param choicesPerState The number of choices (rows) of every state.
+         * @param successorsPerChoice The (maximal) number of successors of every choice.
+         * @param rowSum The sum of the values of every row. Values below one make equation systems with this matrix
+         * uniquely solvable.
+         * @return The matrix.
+         */
+        storm::storage::SparseMatrix<double> createRandomMatrix(uint64_t numberOfStates, uint64_t choicesPerState, uint64_t successorsPerChoice, double rowSum = 1.0);
+
+    }
+}
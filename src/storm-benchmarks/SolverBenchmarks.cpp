@@ -0,0 +1,84 @@
+#include "storm-benchmarks/BenchmarkSuite.h"
+#include "storm-benchmarks/RandomMatrix.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/SolverSelectionOptions.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/constants.h"
+
+namespace storm {
+    namespace benchmarks {
+
+        namespace {
+            struct SolverConfiguration {
+                std::string name;
+                storm::solver::MinMaxMethod method;
+                bool sound;
+                uint64_t numberOfThreads;
+            };
+        }
+
+        void runSolverBenchmarks(BenchmarkSuite& suite) {
+            std::string const group = "solver";
+            if (!suite.isGroupSelected(group)) {
+                return;
+            }
+
+            // The rows of the matrix sum up to less than one, so the equation system has a unique solution within the
+            // bounds [0, 1] and the solvers do not need any preprocessing of the system.
+            uint64_t numberOfStates = suite.isQuick() ? 1000 : 100000;
+            double const rowSum = 0.9;
+            storm::storage::SparseMatrix<double> matrix = createRandomMatrix(numberOfStates, 4, 8, rowSum);
+            std::vector<double> b(matrix.getRowCount(), 1.0 - rowSum);
+            Parameters parameters = {{"states", std::to_string(numberOfStates)}, {"choices", "4"}, {"successors", "8"}};
+            uint64_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+
+            std::vector<SolverConfiguration> configurations = {
+                {"value-iteration", storm::solver::MinMaxMethod::ValueIteration, false, 1},
+                {"value-iteration", storm::solver::MinMaxMethod::ValueIteration, false, hardwareThreads},
+                {"sound-value-iteration", storm::solver::MinMaxMethod::ValueIteration, true, 1},
+                {"policy-iteration", storm::solver::MinMaxMethod::PolicyIteration, false, 1},
+                {"topological", storm::solver::MinMaxMethod::Topological, false, 1}
+            };
+            for (auto const& configuration : configurations) {
+                storm::Environment env;
+                env.solver().minMax().setMethod(configuration.method);
+                env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+                env.solver().minMax().setNumberOfThreads(configuration.numberOfThreads);
+                env.solver().setForceSoundness(configuration.sound);
+
+                Parameters solverParameters = parameters;
+                solverParameters["threads"] = std::to_string(configuration.numberOfThreads);
+                suite.run(group, configuration.name, solverParameters, "states", [&] () {
+                    storm::solver::GeneralMinMaxLinearEquationSolverFactory<double> factory;
+                    auto solver = factory.create(env, matrix);
+                    solver->setHasUniqueSolution(true);
+                    solver->setBounds(storm::utility::zero<double>(), storm::utility::one<double>());
+                    solver->setRequirementsChecked();
+                    std::vector<double> x(numberOfStates);
+                    solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b);
+                    return numberOfStates;
+                });
+            }
+
+            storm::storage::BitVector allStates(numberOfStates, true);
+            for (uint64_t numberOfThreads : {uint64_t(1), hardwareThreads}) {
+                Parameters sccParameters = parameters;
+                sccParameters["threads"] = std::to_string(numberOfThreads);
+                suite.run(group, "scc-decomposition", sccParameters, "states", [&] () {
+                    storm::storage::StronglyConnectedComponentDecomposition<double> decomposition(matrix, allStates, false, false, numberOfThreads);
+                    return numberOfStates;
+                });
+            }
+        }
+
+    }
+}
@@ -0,0 +1,53 @@
+#include "storm-benchmarks/BenchmarkSuite.h"
+
+#include "storm-config.h"
+
+#include "storm/api/builder.h"
+#include "storm/api/model_descriptions.h"
+#include "storm/models/symbolic/Model.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/dd/DdType.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/utility/dd.h"
+
+namespace storm {
+    namespace benchmarks {
+
+        namespace {
+            template<storm::dd::DdType DdType>
+            void runSymbolicBenchmarksForLibrary(BenchmarkSuite& suite, std::string const& library, std::vector<std::string> const& models) {
+                std::string const group = "symbolic";
+                for (auto const& model : models) {
+                    storm::storage::SymbolicModelDescription program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/" + model);
+                    Parameters parameters = {{"model", model}, {"library", library}};
+                    suite.run(group, "build", parameters, "states", [&] () {
+                        return storm::api::buildSymbolicModel<DdType, double>(program, {}, true)->getNumberOfStates();
+                    });
+
+                    // Explore the state space of the built model again to measure the reachability analysis alone.
+                    auto symbolicModel = storm::api::buildSymbolicModel<DdType, double>(program, {}, true);
+                    storm::dd::Bdd<DdType> transitions = symbolicModel->getQualitativeTransitionMatrix(false);
+                    suite.run(group, "reachability", parameters, "states", [&] () {
+                        return storm::utility::dd::computeReachableStates(symbolicModel->getInitialStates(), transitions, symbolicModel->getRowVariables(), symbolicModel->getColumnVariables()).getNonZeroCount();
+                    });
+                }
+            }
+        }
+
+        void runSymbolicBenchmarks(BenchmarkSuite& suite) {
+            if (!suite.isGroupSelected("symbolic")) {
+                return;
+            }
+
+            std::vector<std::string> models;
+            if (suite.isQuick()) {
+                models = {"dtmc/die.pm", "mdp/two_dice.nm"};
+            } else {
+                models = {"dtmc/crowds-5-5.pm", "dtmc/brp-16-2.pm", "dtmc/nand-5-2.pm", "mdp/leader4.nm", "mdp/csma2-2.nm", "mdp/wlan0-2-2.nm", "mdp/firewire3-0.5.nm"};
+            }
+            runSymbolicBenchmarksForLibrary<storm::dd::DdType::CUDD>(suite, "cudd", models);
+            runSymbolicBenchmarksForLibrary<storm::dd::DdType::Sylvan>(suite, "sylvan", models);
+        }
+
+    }
+}
@@ -0,0 +1,73 @@
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+
+#include "storm-benchmarks/BenchmarkSuite.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/utility/initialize.h"
+#include "storm/utility/file.h"
+
+namespace {
+    void printUsage() {
+        std::cout << "Usage: storm-benchmarks [--quick] [--repetitions <count>] [--groups <group>,...] [--json <filename>]" << std::endl << std::endl;
+        std::cout << "  --quick                 Use small inputs, e.g. to check that all benchmarks work." << std::endl;
+        std::cout << "  --repetitions <count>   The number of measured repetitions of every benchmark (default: 5)." << std::endl;
+        std::cout << "  --groups <group>,...    Only run the given groups of benchmarks. Available groups are" << std::endl;
+        std::cout << "                          matrix, bitvector, builder, solver, symbolic and parametric." << std::endl;
+        std::cout << "  --json <filename>       Write the results to the given file (see result.schema.json)." << std::endl;
+    }
+}
+
+/*!
+ * Runs benchmarks of the performance-critical parts of storm and optionally writes the results to a JSON file, such that
+ * the results of different versions can be compared.
+ */
+int main(const int argc, const char** argv) {
+    uint64_t repetitions = 5;
+    bool quick = false;
+    std::set<std::string> groups;
+    std::string jsonFilename;
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        if (argument == "--quick") {
+            quick = true;
+        } else if (argument == "--repetitions" && i + 1 < argc) {
+            repetitions = std::stoull(argv[++i]);
+        } else if (argument == "--groups" && i + 1 < argc) {
+            std::stringstream groupStream(argv[++i]);
+            std::string group;
+            while (std::getline(groupStream, group, ',')) {
+                groups.insert(group);
+            }
+        } else if (argument == "--json" && i + 1 < argc) {
+            jsonFilename = argv[++i];
+        } else {
+            printUsage();
+            return argument == "--help" ? 0 : -1;
+        }
+    }
+
+    storm::utility::setUp();
+    storm::settings::initializeAll("Storm-benchmarks", "storm-benchmarks");
+
+    storm::benchmarks::BenchmarkSuite suite(repetitions, quick, groups);
+    storm::benchmarks::runMatrixBenchmarks(suite);
+    storm::benchmarks::runBitVectorBenchmarks(suite);
+    storm::benchmarks::runBuilderBenchmarks(suite);
+    storm::benchmarks::runSolverBenchmarks(suite);
+    storm::benchmarks::runSymbolicBenchmarks(suite);
+    storm::benchmarks::runParametricBenchmarks(suite);
+
+    if (!jsonFilename.empty()) {
+        std::ofstream stream;
+        storm::utility::openFile(jsonFilename, stream);
+        suite.exportToJson(stream);
+        storm::utility::closeFile(stream);
+    }
+
+    storm::utility::cleanUp();
+    return 0;
+}
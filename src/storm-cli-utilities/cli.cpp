@@ -8,6 +8,7 @@
 
 #include "storm/utility/initialize.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/Instrumentation.h"
 
 #include <type_traits>
 #include <ctime>
@@ -53,12 +54,23 @@ namespace storm {
                 return -1;
             }
 
+            auto const& resourceSettings = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+            if (resourceSettings.isProfileSet()) {
+                storm::utility::instrumentation::enable();
+            }
+
             processOptions();
 
             totalTimer.stop();
-            if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintTimeAndMemorySet()) {
+            if (resourceSettings.isPrintTimeAndMemorySet()) {
                 storm::cli::printTimeAndMemoryStatistics(totalTimer.getTimeInMilliseconds());
             }
+            if (resourceSettings.isProfileSet()) {
+                std::ofstream stream;
+                storm::utility::openFile(resourceSettings.getProfileFilename(), stream);
+                storm::utility::instrumentation::exportToJson(stream);
+                storm::utility::closeFile(stream);
+            }
 
             storm::utility::cleanUp();
             return 0;
@@ -9,7 +9,9 @@
 
 #include "storm/utility/initialize.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/Instrumentation.h"
 
+#include <map>
 #include <type_traits>
 
 
@@ -86,6 +88,7 @@ namespace storm {
         }
         
         SymbolicInput parseSymbolicInput() {
+            storm::utility::instrumentation::Scope scope("parsing");
             auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
             
             // Parse the property filter, if any is given.
@@ -202,6 +205,8 @@ namespace storm {
                 result = storm::api::buildExplicitModel<ValueType>(ioSettings.getTransitionFilename(), ioSettings.getLabelingFilename(), ioSettings.isStateRewardsSet() ? boost::optional<std::string>(ioSettings.getStateRewardsFilename()) : boost::none, ioSettings.isTransitionRewardsSet() ? boost::optional<std::string>(ioSettings.getTransitionRewardsFilename()) : boost::none, ioSettings.isChoiceLabelingSet() ? boost::optional<std::string>(ioSettings.getChoiceLabelingFilename()) : boost::none);
             } else if (ioSettings.isExplicitDRNSet()) {
                 result = storm::api::buildExplicitDRNModel<ValueType>(ioSettings.getExplicitDRNFilename());
+            } else if (ioSettings.isExplicitBinarySet()) {
+                result = storm::api::buildExplicitBinaryModel<ValueType>(ioSettings.getExplicitBinaryFilename());
             } else {
                 STORM_LOG_THROW(ioSettings.isExplicitIMCASet(), storm::exceptions::InvalidSettingsException, "Unexpected explicit model input type.");
                 result = storm::api::buildExplicitIMCAModel<ValueType>(ioSettings.getExplicitIMCAFilename());
@@ -211,6 +216,7 @@ namespace storm {
         
         template <storm::dd::DdType DdType, typename ValueType>
         std::shared_ptr<storm::models::ModelBase> buildModel(storm::settings::modules::CoreSettings::Engine const& engine, SymbolicInput const& input, storm::settings::modules::IOSettings const& ioSettings) {
+            storm::utility::instrumentation::Scope scope("model construction");
             storm::utility::Stopwatch modelBuildingWatch(true);
 
             auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
@@ -221,7 +227,7 @@ namespace storm {
                 } else if (engine == storm::settings::modules::CoreSettings::Engine::Sparse) {
                     result = buildModelSparse<ValueType>(input, buildSettings);
                 }
-            } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitIMCASet()) {
+            } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitBinarySet() || ioSettings.isExplicitIMCASet()) {
                 STORM_LOG_THROW(engine == storm::settings::modules::CoreSettings::Engine::Sparse, storm::exceptions::InvalidSettingsException, "Can only use sparse engine with explicit input.");
                 result = buildModelExplicit<ValueType>(ioSettings);
             }
@@ -282,7 +288,11 @@ namespace storm {
             auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
             
             if (ioSettings.isExportExplicitSet()) {
-                storm::api::exportSparseModelAsDrn(model, ioSettings.getExportExplicitFilename(), input.model ? input.model.get().getParameterNames() : std::vector<std::string>());
+                storm::api::exportSparseModelAsDrn(model, ioSettings.getExportExplicitFilename(), input.model ? input.model.get().getParameterNames() : std::vector<std::string>(), ioSettings.getNumberOfExportThreads());
+            }
+            
+            if (ioSettings.isExportBinarySet()) {
+                storm::api::exportSparseModelAsBinary(model, ioSettings.getExportBinaryFilename());
             }
             
             if (ioSettings.isExportDotSet()) {
@@ -328,6 +338,7 @@ namespace storm {
         
         template <storm::dd::DdType DdType, typename ValueType>
         std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input) {
+            storm::utility::instrumentation::Scope scope("model preprocessing");
             storm::utility::Stopwatch preprocessingWatch(true);
             
             std::pair<std::shared_ptr<storm::models::ModelBase>, bool> result = std::make_pair(model, false);
@@ -489,7 +500,11 @@ namespace storm {
             for (auto const& property : properties) {
                 printModelCheckingProperty(property);
                 storm::utility::Stopwatch watch(true);
-                std::unique_ptr<storm::modelchecker::CheckResult> result = verificationCallback(property.getRawFormula(), property.getFilter().getStatesFormula());
+                std::unique_ptr<storm::modelchecker::CheckResult> result;
+                {
+                    storm::utility::instrumentation::Scope scope("model checking");
+                    result = verificationCallback(property.getRawFormula(), property.getFilter().getStatesFormula());
+                }
                 watch.stop();
                 postprocessingCallback(result);
                 printResult<ValueType>(result, property, &watch);
@@ -518,11 +533,50 @@ namespace storm {
         template <typename ValueType>
         void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input) {
             auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
+            
+            // If requested, the properties share a cache of results such that later properties can reuse the analysis of earlier ones.
+            auto coreSettings = storm::settings::getModule<storm::settings::modules::CoreSettings>();
+            std::shared_ptr<storm::modelchecker::ExplicitModelCheckerHintCache<ValueType>> hintCache;
+            if (coreSettings.isHintCacheSet()) {
+                hintCache = std::make_shared<storm::modelchecker::ExplicitModelCheckerHintCache<ValueType>>(coreSettings.getHintCacheSize());
+            }
+            
+            // If requested, time-bounded reachability probabilities of CTMCs (e.g. for several time points) are checked
+            // together upfront, as they can share the transient analysis.
+            std::map<storm::logic::Formula const*, std::unique_ptr<storm::modelchecker::CheckResult>> batchedResults;
+            if (coreSettings.isBatchTimeBoundsSet() && sparseModel->isOfType(storm::models::ModelType::Ctmc)) {
+                STORM_LOG_WARN_COND((std::is_same<ValueType, double>::value), "Batching time-bounded properties is only supported for models with double values.");
+            }
+            if (coreSettings.isBatchTimeBoundsSet() && sparseModel->isOfType(storm::models::ModelType::Ctmc) && std::is_same<ValueType, double>::value) {
+                std::vector<std::shared_ptr<storm::logic::Formula const>> batchableFormulas;
+                for (auto const& property : input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties) {
+                    if (storm::api::isBatchableTimeBoundedReachabilityFormula(*property.getRawFormula())) {
+                        batchableFormulas.push_back(property.getRawFormula());
+                    }
+                }
+                if (batchableFormulas.size() > 1) {
+                    storm::utility::Stopwatch watch(true);
+                    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results = storm::api::verifyTimeBoundedReachabilityWithSparseEngine<ValueType>(sparseModel->template as<storm::models::sparse::Ctmc<ValueType>>(), batchableFormulas);
+                    watch.stop();
+                    STORM_PRINT_AND_LOG("Checked " << batchableFormulas.size() << " time-bounded reachability properties together in " << watch << "s." << std::endl);
+                    for (uint64_t index = 0; index < batchableFormulas.size(); ++index) {
+                        batchedResults[batchableFormulas[index].get()] = std::move(results[index]);
+                    }
+                }
+            }
+            
             verifyProperties<ValueType>(input,
-                                        [&sparseModel] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+                                        [&sparseModel,&hintCache,&batchedResults] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
                                             bool filterForInitialStates = states->isInitialFormula();
-                                            auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
-                                            std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(sparseModel, task);
+                                            std::unique_ptr<storm::modelchecker::CheckResult> result;
+                                            auto batchedResultIt = batchedResults.find(formula.get());
+                                            if (batchedResultIt != batchedResults.end()) {
+                                                result = std::move(batchedResultIt->second);
+                                                batchedResults.erase(batchedResultIt);
+                                            } else {
+                                                auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
+                                                result = storm::api::verifyWithSparseEngine<ValueType>(sparseModel, task, hintCache);
+                                            }
                                             
                                             std::unique_ptr<storm::modelchecker::CheckResult> filter;
                                             if (filterForInitialStates) {
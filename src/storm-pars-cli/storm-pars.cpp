@@ -3,6 +3,8 @@
 #include "storm-pars/settings/ParsSettings.h"
 #include "storm-pars/settings/modules/ParametricSettings.h"
 #include "storm-pars/settings/modules/RegionSettings.h"
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm-pars/modelchecker/instantiation/SparseMdpInstantiationModelChecker.h"
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/api/storm.h"
@@ -29,8 +31,6 @@ namespace storm {
     
         typedef typename storm::cli::SymbolicInput SymbolicInput;
 
-
-        
         template <typename ValueType>
         std::vector<storm::storage::ParameterRegion<ValueType>> parseRegions(std::shared_ptr<storm::models::ModelBase> const& model) {
             std::vector<storm::storage::ParameterRegion<ValueType>> result;
@@ -41,6 +41,16 @@ namespace storm {
             return result;
         }
         
+        template <typename ValueType>
+        storm::api::SampleInformation<ValueType> parseSamples(std::shared_ptr<storm::models::ModelBase> const& model) {
+            auto parametricSettings = storm::settings::getModule<storm::settings::modules::ParametricSettings>();
+            storm::api::SampleInformation<ValueType> result(parametricSettings.isSamplesAreGraphPreservingSet());
+            if (parametricSettings.isSamplesSet() && model) {
+                result = storm::api::parseSamples<ValueType>(parametricSettings.getSamples(), *model, parametricSettings.isSamplesAreGraphPreservingSet());
+            }
+            return result;
+        }
+        
         template <typename ValueType>
         std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessSparseModel(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, SymbolicInput const& input) {
             auto generalSettings = storm::settings::getModule<storm::settings::modules::GeneralSettings>();
@@ -106,9 +116,23 @@ namespace storm {
         }
         
         template<typename ValueType>
-        void printInitialStatesResult(std::unique_ptr<storm::modelchecker::CheckResult> const& result, storm::jani::Property const& property, storm::utility::Stopwatch* watch = nullptr) {
+        void printInitialStatesResult(std::unique_ptr<storm::modelchecker::CheckResult> const& result, storm::jani::Property const& property, storm::utility::Stopwatch* watch = nullptr, storm::utility::parametric::Valuation<ValueType> const* valuation = nullptr) {
             if (result) {
-                STORM_PRINT_AND_LOG("Result (initial states): " << std::endl);
+                STORM_PRINT_AND_LOG("Result (initial states)");
+                if (valuation) {
+                    bool first = true;
+                    std::stringstream ss;
+                    for (auto const& entry : *valuation) {
+                        if (!first) {
+                            ss << ", ";
+                        } else {
+                            first = false;
+                        }
+                        ss << entry.first << "=" << entry.second;
+                    }
+                    STORM_PRINT_AND_LOG(" for instance [" << ss.str() << "]");
+                }
+                STORM_PRINT_AND_LOG(": " << std::endl);
                 
                 auto const* regionCheckResult = dynamic_cast<storm::modelchecker::RegionCheckResult<ValueType> const*>(result.get());
                 if (regionCheckResult != nullptr) {
@@ -171,6 +195,47 @@ namespace storm {
                                         });
         }
         
+        template <template<typename, typename> class ModelCheckerType, typename ModelType, typename ValueType, typename SolveValueType = double>
+        void verifyPropertiesAtSamplePoints(ModelType const& model, SymbolicInput const& input, storm::api::SampleInformation<ValueType> const& samples) {
+            // The model is instantiated for every sample point, which avoids rebuilding it from the symbolic description.
+            // Results of previous instantiations are kept as hints by the instantiation model checker.
+            ModelCheckerType<ModelType, SolveValueType> modelchecker(model);
+            std::vector<storm::utility::parametric::Valuation<ValueType>> samplePoints = storm::api::getSamplePoints(samples);
+            
+            for (auto const& property : input.properties) {
+                storm::cli::printModelCheckingProperty(property);
+                
+                modelchecker.specifyFormula(storm::api::createTask<ValueType>(property.getRawFormula(), true));
+                modelchecker.setInstantiationsAreGraphPreserving(samples.graphPreserving);
+                
+                storm::utility::Stopwatch watch(true);
+                for (auto const& valuation : samplePoints) {
+                    storm::utility::Stopwatch valuationWatch(true);
+                    std::unique_ptr<storm::modelchecker::CheckResult> result = modelchecker.check(Environment(), valuation);
+                    valuationWatch.stop();
+                    
+                    if (result) {
+                        result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
+                    }
+                    printInitialStatesResult<ValueType>(result, property, &valuationWatch, &valuation);
+                }
+                
+                watch.stop();
+                STORM_PRINT_AND_LOG("Overall time for sampling all instances: " << watch << std::endl << std::endl);
+            }
+        }
+        
+        template <typename ValueType, typename SolveValueType = double>
+        void verifyPropertiesAtSamplePoints(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, SymbolicInput const& input, storm::api::SampleInformation<ValueType> const& samples) {
+            if (model->isOfType(storm::models::ModelType::Dtmc)) {
+                verifyPropertiesAtSamplePoints<storm::modelchecker::SparseDtmcInstantiationModelChecker, storm::models::sparse::Dtmc<ValueType>, ValueType, SolveValueType>(*model->template as<storm::models::sparse::Dtmc<ValueType>>(), input, samples);
+            } else if (model->isOfType(storm::models::ModelType::Mdp)) {
+                verifyPropertiesAtSamplePoints<storm::modelchecker::SparseMdpInstantiationModelChecker, storm::models::sparse::Mdp<ValueType>, ValueType, SolveValueType>(*model->template as<storm::models::sparse::Mdp<ValueType>>(), input, samples);
+            } else {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Sampling is currently only supported for DTMCs and MDPs.");
+            }
+        }
+        
         template <typename ValueType>
         void verifyRegionsWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, SymbolicInput const& input, std::vector<storm::storage::ParameterRegion<ValueType>> const& regions) {
             STORM_LOG_ASSERT(!regions.empty(), "Can not analyze an empty set of regions.");
@@ -205,7 +270,7 @@ namespace storm {
                                         if (regionSettings.isDepthLimitSet()) {
                                             optionalDepthLimit = regionSettings.getDepthLimit();
                                         }
-                                        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(model, storm::api::createTask<ValueType>(formula, true), regions.front(), engine, refinementThreshold, optionalDepthLimit, regionSettings.getHypothesis());
+                                        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(model, storm::api::createTask<ValueType>(formula, true), regions.front(), engine, refinementThreshold, optionalDepthLimit, regionSettings.getHypothesis(), regionSettings.getNumberOfThreads());
                                         return result;
                                     };
             } else {
@@ -226,8 +291,11 @@ namespace storm {
         }
         
         template <typename ValueType>
-        void verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, SymbolicInput const& input, std::vector<storm::storage::ParameterRegion<ValueType>> const& regions) {
-            if (regions.empty()) {
+        void verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, SymbolicInput const& input, std::vector<storm::storage::ParameterRegion<ValueType>> const& regions, storm::api::SampleInformation<ValueType> const& samples) {
+            if (!samples.empty()) {
+                STORM_LOG_THROW(regions.empty(), storm::exceptions::InvalidSettingsException, "Sampling and region analysis can not be combined.");
+                storm::pars::verifyPropertiesAtSamplePoints(model, input, samples);
+            } else if (regions.empty()) {
                 storm::pars::verifyPropertiesWithSparseEngine(model, input);
             } else {
                 storm::pars::verifyRegionsWithSparseEngine(model, input, regions);
@@ -235,9 +303,9 @@ namespace storm {
         }
         
         template <storm::dd::DdType DdType, typename ValueType>
-        void verifyParametricModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, std::vector<storm::storage::ParameterRegion<ValueType>> const& regions) {
+        void verifyParametricModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, std::vector<storm::storage::ParameterRegion<ValueType>> const& regions, storm::api::SampleInformation<ValueType> const& samples) {
             STORM_LOG_ASSERT(model->isSparseModel(), "Unexpected model type.");
-            storm::pars::verifyWithSparseEngine<ValueType>(model->as<storm::models::sparse::Model<ValueType>>(), input, regions);
+            storm::pars::verifyWithSparseEngine<ValueType>(model->as<storm::models::sparse::Model<ValueType>>(), input, regions, samples);
         }
         
         template <storm::dd::DdType DdType, typename ValueType>
@@ -271,6 +339,7 @@ namespace storm {
             }
             
             std::vector<storm::storage::ParameterRegion<ValueType>> regions = parseRegions<ValueType>(model);
+            storm::api::SampleInformation<ValueType> samples = parseSamples<ValueType>(model);
 
 
 
@@ -285,7 +354,7 @@ namespace storm {
             }
 
             if (model) {
-                verifyParametricModel<DdType, ValueType>(model, input, regions);
+                verifyParametricModel<DdType, ValueType>(model, input, regions, samples);
             }
         }
         
@@ -4,8 +4,11 @@
 #include <set>
 #include <vector>
 #include <memory>
+#include <thread>
 #include <boost/optional.hpp>
 
+#include "storm-config.h"
+
 #include "storm-pars/modelchecker/results/RegionCheckResult.h"
 #include "storm-pars/modelchecker/results/RegionRefinementCheckResult.h"
 #include "storm-pars/modelchecker/region/RegionCheckEngine.h"
@@ -180,12 +183,30 @@ namespace storm {
          * @param coverageThreshold if given, the refinement stops as soon as the fraction of the area of the subregions with inconclusive result is less then this threshold
          * @param refinementDepthThreshold if given, the refinement stops at the given depth. depth=0 means no refinement.
          * @param hypothesis if not 'unknown', it is only checked whether the hypothesis holds (and NOT the complementary result).
+         * @param numberOfThreads the number of threads that analyze regions concurrently (0 for the number of hardware threads). The result does not depend on this number.
+         * As the threads work on rational functions, several threads are only used if carl was built thread-safe (STORM_CARL_THREAD_SAFE).
          */
         template <typename ValueType>
-        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> checkAndRefineRegionWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, storm::storage::ParameterRegion<ValueType> const& region, storm::modelchecker::RegionCheckEngine engine, boost::optional<ValueType> const& coverageThreshold, boost::optional<uint64_t> const& refinementDepthThreshold = boost::none, storm::modelchecker::RegionResultHypothesis hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown) {
+        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> checkAndRefineRegionWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, storm::storage::ParameterRegion<ValueType> const& region, storm::modelchecker::RegionCheckEngine engine, boost::optional<ValueType> const& coverageThreshold, boost::optional<uint64_t> const& refinementDepthThreshold = boost::none, storm::modelchecker::RegionResultHypothesis hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown, uint64_t numberOfThreads = 1) {
             Environment env;
             auto regionChecker = initializeRegionModelChecker(env, model, task, engine);
-            return regionChecker->performRegionRefinement(env, region, coverageThreshold, refinementDepthThreshold, hypothesis);
+            
+            // Every thread gets its own checker, as the checkers store the data of the most recent analysis.
+            if (numberOfThreads == 0) {
+                numberOfThreads = std::max<uint64_t>(std::thread::hardware_concurrency(), 1);
+            }
+#ifndef STORM_CARL_THREAD_SAFE
+            // Rational functions share caches (e.g. of factorized polynomials) that are only protected in thread-safe builds of carl.
+            if (numberOfThreads > 1) {
+                STORM_LOG_WARN("Analyzing regions concurrently requires carl to be built thread-safe. Falling back to a single thread.");
+                numberOfThreads = 1;
+            }
+#endif
+            std::vector<std::shared_ptr<storm::modelchecker::RegionModelChecker<ValueType>>> additionalCheckers;
+            for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+                additionalCheckers.push_back(initializeRegionModelChecker(env, model, task, engine));
+            }
+            return regionChecker->performRegionRefinement(env, region, coverageThreshold, refinementDepthThreshold, hypothesis, additionalCheckers);
         }
         
         template <typename ValueType>
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <boost/algorithm/string.hpp>
+
+#include "storm-pars/utility/parametric.h"
+
+#include "storm/models/sparse/Model.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+
+    namespace api {
+
+        /*!
+         * The sample points at which a parametric model is to be checked.
+         */
+        template <typename ValueType>
+        struct SampleInformation {
+            SampleInformation(bool graphPreserving = false) : graphPreserving(graphPreserving) {
+                // Intentionally left empty.
+            }
+
+            bool empty() const {
+                return cartesianProducts.empty();
+            }
+
+            // Every entry maps the parameters to the values they take. The sample points are given by the cartesian product.
+            std::vector<std::map<typename storm::utility::parametric::VariableType<ValueType>::type, std::vector<typename storm::utility::parametric::CoefficientType<ValueType>::type>>> cartesianProducts;
+
+            // Whether all samples are assumed to induce the same graph structure.
+            bool graphPreserving;
+        };
+
+        /*!
+         * Parses sample points for the parameters of the given model from a string of semicolon-separated cartesian
+         * products of the form 'p=0.1:0.2:0.3,q=0.5'. Every product has to assign values to all parameters of the model.
+         *
+         * Note that the parameters are the constants that were left undefined when building the model, so only constants
+         * that occur in the probabilities and rewards can be sampled. Constants that influence the structure of the
+         * model (e.g. the bounds of variables) have to be defined when building it.
+         */
+        template <typename ValueType>
+        SampleInformation<ValueType> parseSamples(std::string const& sampleString, storm::models::ModelBase const& model, bool graphPreserving = false) {
+            SampleInformation<ValueType> sampleInfo(graphPreserving);
+            if (sampleString.empty()) {
+                return sampleInfo;
+            }
+            STORM_LOG_THROW(model.isSparseModel(), storm::exceptions::NotSupportedException, "Sampling is only supported for sparse models.");
+
+            // Get all parameters from the model.
+            auto const& sparseModel = dynamic_cast<storm::models::sparse::Model<ValueType> const&>(model);
+            std::set<typename storm::utility::parametric::VariableType<ValueType>::type> modelParameters = storm::models::sparse::getProbabilityParameters(sparseModel);
+            auto rewParameters = storm::models::sparse::getRewardParameters(sparseModel);
+            modelParameters.insert(rewParameters.begin(), rewParameters.end());
+
+            std::vector<std::string> cartesianProducts;
+            boost::split(cartesianProducts, sampleString, boost::is_any_of(";"));
+            for (auto& product : cartesianProducts) {
+                boost::trim(product);
+
+                // Get the values string for each variable.
+                std::vector<std::string> valuesForVariables;
+                boost::split(valuesForVariables, product, boost::is_any_of(","));
+
+                std::set<typename storm::utility::parametric::VariableType<ValueType>::type> encounteredParameters;
+                sampleInfo.cartesianProducts.emplace_back();
+                auto& newCartesianProduct = sampleInfo.cartesianProducts.back();
+                for (auto const& varValues : valuesForVariables) {
+                    auto equalsPosition = varValues.find("=");
+                    STORM_LOG_THROW(equalsPosition != varValues.npos, storm::exceptions::WrongFormatException, "Incorrect format of samples: '" << varValues << "'.");
+                    std::string variableName = varValues.substr(0, equalsPosition);
+                    boost::trim(variableName);
+                    std::string values = varValues.substr(equalsPosition + 1);
+                    boost::trim(values);
+
+                    bool foundParameter = false;
+                    typename storm::utility::parametric::VariableType<ValueType>::type theParameter;
+                    for (auto const& parameter : modelParameters) {
+                        std::stringstream parameterStream;
+                        parameterStream << parameter;
+                        if (parameterStream.str() == variableName) {
+                            foundParameter = true;
+                            theParameter = parameter;
+                            encounteredParameters.insert(parameter);
+                        }
+                    }
+                    STORM_LOG_THROW(foundParameter, storm::exceptions::WrongFormatException, "Unknown parameter '" << variableName << "'. Only constants that occur in probabilities or rewards and were left undefined can be sampled.");
+
+                    std::vector<std::string> splitValues;
+                    boost::split(splitValues, values, boost::is_any_of(":"));
+                    STORM_LOG_THROW(!splitValues.empty(), storm::exceptions::WrongFormatException, "Expecting at least one value per parameter.");
+
+                    auto& list = newCartesianProduct[theParameter];
+                    for (auto& value : splitValues) {
+                        boost::trim(value);
+                        list.push_back(storm::utility::convertNumber<typename storm::utility::parametric::CoefficientType<ValueType>::type>(value));
+                    }
+                }
+
+                STORM_LOG_THROW(encounteredParameters == modelParameters, storm::exceptions::WrongFormatException, "Variables for all parameters are required when providing samples.");
+            }
+
+            return sampleInfo;
+        }
+
+        /*!
+         * Enumerates the sample points of all cartesian products in the given sample information.
+         */
+        template <typename ValueType>
+        std::vector<storm::utility::parametric::Valuation<ValueType>> getSamplePoints(SampleInformation<ValueType> const& samples) {
+            std::vector<storm::utility::parametric::Valuation<ValueType>> result;
+            for (auto const& product : samples.cartesianProducts) {
+                std::vector<typename storm::utility::parametric::VariableType<ValueType>::type> parameters;
+                std::vector<typename std::vector<typename storm::utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iterators;
+                std::vector<typename std::vector<typename storm::utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iteratorEnds;
+                for (auto const& entry : product) {
+                    parameters.push_back(entry.first);
+                    iterators.push_back(entry.second.cbegin());
+                    iteratorEnds.push_back(entry.second.cend());
+                }
+
+                bool done = false;
+                while (!done) {
+                    // Read off valuation.
+                    storm::utility::parametric::Valuation<ValueType> valuation;
+                    for (uint64_t i = 0; i < parameters.size(); ++i) {
+                        valuation[parameters[i]] = *iterators[i];
+                    }
+                    result.push_back(std::move(valuation));
+
+                    // Move on to the next sample point. If all iterators wrapped around, we are done.
+                    done = true;
+                    for (uint64_t i = 0; i < parameters.size(); ++i) {
+                        ++iterators[i];
+                        if (iterators[i] == iteratorEnds[i]) {
+                            iterators[i] = product.at(parameters[i]).cbegin();
+                        } else {
+                            done = false;
+                            break;
+                        }
+                    }
+                }
+            }
+            return result;
+        }
+
+    }
+}
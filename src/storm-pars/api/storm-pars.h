@@ -1,4 +1,5 @@
 #pragma once
 
 #include "storm-pars/api/region.h"
+#include "storm-pars/api/samples.h"
 #include "storm-pars/api/export.h"
\ No newline at end of file
@@ -1,18 +1,31 @@
 #include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
 
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+#include "storm-pars/utility/CompiledRationalFunctions.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/EigenSolverEnvironment.h"
+#include "storm/environment/solver/GmmxxSolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/logic/FragmentSpecification.h"
+#include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/utility/graph.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidStateException.h"
+#include "storm/exceptions/NotSupportedException.h"
 namespace storm {
     namespace modelchecker {
         
         template <typename SparseModelType, typename ConstantType>
-        SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::SparseDtmcInstantiationModelChecker(SparseModelType const& parametricModel) : SparseInstantiationModelChecker<SparseModelType, ConstantType>(parametricModel), modelInstantiator(parametricModel) {
+        SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::SparseDtmcInstantiationModelChecker(SparseModelType const& parametricModel) : SparseInstantiationModelChecker<SparseModelType, ConstantType>(parametricModel), modelInstantiator(parametricModel, std::is_same<ConstantType, double>::value) {
             //Intentionally left empty
         }
 
@@ -35,6 +48,166 @@ namespace storm {
             }
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<std::vector<ConstantType>> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+            STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+            // The valuations are checked together with value iteration, which needs a precision. The elimination solver has none.
+            if (std::is_same<ConstantType, double>::value && this->currentCheckTask->getFormula().isInFragment(storm::logic::reachability()) && env.solver().getPrecisionOfCurrentLinearEquationSolver()) {
+                return checkReachabilityProbabilityFormulaBatch(env, valuations);
+            }
+            
+            std::vector<std::vector<ConstantType>> result;
+            result.reserve(valuations.size());
+            for (auto const& valuation : valuations) {
+                std::unique_ptr<CheckResult> checkResult = check(env, valuation);
+                STORM_LOG_THROW(checkResult->isExplicitQuantitativeCheckResult(), storm::exceptions::NotSupportedException, "Checking a batch of valuations is not supported for properties with a qualitative result other than reachability probabilities.");
+                result.push_back(std::move(checkResult->template asExplicitQuantitativeCheckResult<ConstantType>().getValueVector()));
+            }
+            return result;
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<std::vector<ConstantType>> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkReachabilityProbabilityFormulaBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+            auto const& transitionMatrix = this->parametricModel.getTransitionMatrix();
+            uint64_t numberOfStates = this->parametricModel.getNumberOfStates();
+            
+            // Obtain the phi and psi states of the (unbounded) until formula.
+            storm::logic::Formula const& subformula = this->currentCheckTask->getFormula().asOperatorFormula().getSubformula();
+            storm::modelchecker::SparsePropositionalModelChecker<SparseModelType> propositionalChecker(this->parametricModel);
+            storm::storage::BitVector phiStates, psiStates;
+            if (subformula.isUntilFormula()) {
+                phiStates = propositionalChecker.check(subformula.asUntilFormula().getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                psiStates = propositionalChecker.check(subformula.asUntilFormula().getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            } else {
+                STORM_LOG_THROW(subformula.isEventuallyFormula(), storm::exceptions::NotSupportedException, "Unexpected subformula " << subformula << ".");
+                phiStates = storm::storage::BitVector(numberOfStates, true);
+                psiStates = propositionalChecker.check(subformula.asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            }
+            
+            // Perform the graph analysis once for all valuations.
+            storm::storage::BitVector statesWithProbability0, statesWithProbability1;
+            if (this->getInstantiationsAreGraphPreserving()) {
+                std::tie(statesWithProbability0, statesWithProbability1) = storm::utility::graph::performProb01(this->parametricModel.getBackwardTransitions(), phiStates, psiStates);
+            } else {
+                // A valuation might remove transitions of the parametric model. This can only add states with probability zero,
+                // so the states with probability zero in the parametric model have probability zero for all valuations.
+                // The remaining states are solved numerically which is correct (but slower) for the additional states.
+                statesWithProbability0 = ~storm::utility::graph::performProbGreater0(this->parametricModel.getBackwardTransitions(), phiStates, psiStates);
+                statesWithProbability1 = psiStates;
+            }
+            storm::storage::BitVector maybeStates = ~(statesWithProbability0 | statesWithProbability1);
+            STORM_LOG_INFO("Checking " << valuations.size() << " valuations with " << maybeStates.getNumberOfSetBits() << " maybe states.");
+            
+            // Compile the transition probabilities between maybe states and the probabilities to reach a state with probability one.
+            storm::storage::SparseMatrix<typename SparseModelType::ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates);
+            std::vector<typename SparseModelType::ValueType> b = transitionMatrix.getConstrainedRowSumVector(maybeStates, statesWithProbability1);
+            storm::utility::CompiledRationalFunctions functions;
+            std::vector<uint64_t> rowStarts, columns, entryFunctions, bFunctions;
+            rowStarts.reserve(submatrix.getRowCount() + 1);
+            columns.reserve(submatrix.getEntryCount());
+            entryFunctions.reserve(submatrix.getEntryCount());
+            bFunctions.reserve(b.size());
+            for (uint64_t row = 0; row < submatrix.getRowCount(); ++row) {
+                rowStarts.push_back(columns.size());
+                for (auto const& entry : submatrix.getRow(row)) {
+                    columns.push_back(entry.getColumn());
+                    entryFunctions.push_back(functions.addFunction(entry.getValue()));
+                }
+                bFunctions.push_back(functions.addFunction(b[row]));
+            }
+            rowStarts.push_back(columns.size());
+            
+            std::vector<std::vector<double>> variableValues;
+            variableValues.reserve(valuations.size());
+            for (auto const& valuation : valuations) {
+                variableValues.push_back(functions.getVariableValues(valuation));
+            }
+            
+            // Use the termination criterion of the linear equation solver selected in the environment. The solvers of gmm++ and
+            // Eigen consider the relative residual.
+            double precision = storm::utility::convertNumber<double>(env.solver().getPrecisionOfCurrentLinearEquationSolver().get());
+            bool relative = true;
+            uint64_t maxIterations;
+            switch (env.solver().getLinearEquationSolverType()) {
+                case storm::solver::EquationSolverType::Gmmxx:
+                    maxIterations = env.solver().gmmxx().getMaximalNumberOfIterations();
+                    break;
+                case storm::solver::EquationSolverType::Eigen:
+                    maxIterations = env.solver().eigen().getMaximalNumberOfIterations();
+                    break;
+                default:
+                    relative = env.solver().native().getRelativeTerminationCriterion();
+                    maxIterations = env.solver().native().getMaximalNumberOfIterations();
+                    break;
+            }
+            
+            std::vector<std::vector<ConstantType>> result(valuations.size(), std::vector<ConstantType>(numberOfStates, storm::utility::zero<ConstantType>()));
+            for (auto& values : result) {
+                storm::utility::vector::setVectorValues(values, statesWithProbability1, storm::utility::one<ConstantType>());
+            }
+            if (maybeStates.empty()) {
+                return result;
+            }
+            
+            // The valuations are processed in chunks such that the values of one state for all valuations of a chunk are stored
+            // next to each other and can be updated together. The chunk size bounds the memory for the instantiated matrices.
+            uint64_t const maxChunkSize = 8 * storm::utility::CompiledRationalFunctions::batchBlockSize;
+            uint64_t numberOfVariables = functions.getVariables().size();
+            uint64_t numberOfMaybeStates = submatrix.getRowCount();
+            for (uint64_t chunkStart = 0; chunkStart < valuations.size(); chunkStart += maxChunkSize) {
+                uint64_t chunkSize = std::min<uint64_t>(maxChunkSize, valuations.size() - chunkStart);
+                
+                // Instantiate the matrix and the right-hand side for all valuations of the chunk.
+                std::vector<double> chunkVariableValues(numberOfVariables * chunkSize);
+                for (uint64_t lane = 0; lane < chunkSize; ++lane) {
+                    for (uint64_t variable = 0; variable < numberOfVariables; ++variable) {
+                        chunkVariableValues[variable * chunkSize + lane] = variableValues[chunkStart + lane][variable];
+                    }
+                }
+                std::vector<double> functionValues(functions.getNumberOfFunctions() * chunkSize);
+                functions.evaluateBatch(chunkSize, chunkVariableValues.data(), functionValues.data());
+
+                // Solve the equation systems with Gauss-Seidel value iteration, starting from zero (i.e., from below).
+                // We stop as soon as the values for all valuations have converged.
+                std::vector<double> x(numberOfMaybeStates * chunkSize, 0.0);
+                std::vector<double> newValues(chunkSize);
+                bool converged = false;
+                uint64_t iterations = 0;
+                while (!converged && iterations < maxIterations) {
+                    converged = true;
+                    for (uint64_t row = 0; row < numberOfMaybeStates; ++row) {
+                        std::copy_n(functionValues.begin() + bFunctions[row] * chunkSize, chunkSize, newValues.begin());
+                        for (uint64_t entry = rowStarts[row]; entry < rowStarts[row + 1]; ++entry) {
+                            double const* entryValues = functionValues.data() + entryFunctions[entry] * chunkSize;
+                            double const* columnValues = x.data() + columns[entry] * chunkSize;
+                            for (uint64_t lane = 0; lane < chunkSize; ++lane) {
+                                newValues[lane] += entryValues[lane] * columnValues[lane];
+                            }
+                        }
+                        double* rowValues = x.data() + row * chunkSize;
+                        for (uint64_t lane = 0; lane < chunkSize; ++lane) {
+                            double difference = std::abs(newValues[lane] - rowValues[lane]);
+                            if (relative ? difference > precision * std::abs(newValues[lane]) : difference > precision) {
+                                converged = false;
+                            }
+                            rowValues[lane] = newValues[lane];
+                        }
+                    }
+                    ++iterations;
+                }
+                STORM_LOG_WARN_COND(converged, "Value iteration for a batch of valuations did not converge within " << iterations << " iterations.");
+                
+                uint64_t row = 0;
+                for (auto state : maybeStates) {
+                    for (uint64_t lane = 0; lane < chunkSize; ++lane) {
+                        result[chunkStart + lane][state] = storm::utility::convertNumber<ConstantType>(x[row * chunkSize + lane]);
+                    }
+                    ++row;
+                }
+            }
+            return result;
+        }
+        
         template <typename SparseModelType, typename ConstantType>
         std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkReachabilityProbabilityFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker) {
             
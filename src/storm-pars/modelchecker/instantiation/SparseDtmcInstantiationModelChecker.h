@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 #include <boost/optional.hpp>
 
 #include "storm-pars/modelchecker/instantiation/SparseInstantiationModelChecker.h"
@@ -22,12 +23,25 @@ namespace storm {
             
             virtual std::unique_ptr<CheckResult> check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) override;
 
+            /*!
+             * Checks the specified formula for all given valuations at once.
+             * For reachability probabilities (and if ConstantType is double), the graph analysis is performed only once on
+             * the parametric model and the equation systems of all valuations are solved together, i.e., every iteration
+             * sweeps once over the shared sparsity pattern and updates the values of all valuations. Other properties are
+             * checked for one valuation after another.
+             *
+             * @return A matrix whose i-th row holds the values of all states for the i-th valuation. If the formula has a
+             * bound, the values of its subformula are returned.
+             */
+            std::vector<std::vector<ConstantType>> checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations);
+
         protected:
             
             // Optimizations for the different formula types
             std::unique_ptr<CheckResult> checkReachabilityProbabilityFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
             std::unique_ptr<CheckResult> checkReachabilityRewardFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
             std::unique_ptr<CheckResult> checkBoundedUntilFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
+            std::vector<std::vector<ConstantType>> checkReachabilityProbabilityFormulaBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations);
             
             storm::utility::ModelInstantiator<SparseModelType, storm::models::sparse::Dtmc<ConstantType>> modelInstantiator;
         };
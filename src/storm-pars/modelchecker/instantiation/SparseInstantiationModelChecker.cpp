@@ -5,7 +5,11 @@
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/utility/macros.h"
+
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidStateException.h"
 
 namespace storm {
     namespace modelchecker {
@@ -32,6 +36,26 @@ namespace storm {
             return instantiationsAreGraphPreserving;
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        std::shared_ptr<ModelCheckerHint const> SparseInstantiationModelChecker<SparseModelType, ConstantType>::getHint() const {
+            if (!currentCheckTask || !currentCheckTask->getHint().isExplicitModelCheckerHint()) {
+                return nullptr;
+            }
+            return std::make_shared<ExplicitModelCheckerHint<ConstantType>>(currentCheckTask->getHint().template asExplicitModelCheckerHint<ConstantType>());
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        void SparseInstantiationModelChecker<SparseModelType, ConstantType>::setHint(std::shared_ptr<ModelCheckerHint const> const& hint) {
+            STORM_LOG_THROW(currentCheckTask, storm::exceptions::InvalidStateException, "Can not set a hint as no formula has been specified.");
+            if (hint) {
+                STORM_LOG_THROW(hint->isExplicitModelCheckerHint(), storm::exceptions::InvalidArgumentException, "The given hint has not been obtained from an instantiation model checker.");
+                // The checks modify the hint, so the given one is copied.
+                currentCheckTask->setHint(std::make_shared<ExplicitModelCheckerHint<ConstantType>>(hint->template asExplicitModelCheckerHint<ConstantType>()));
+            } else {
+                currentCheckTask->setHint(std::make_shared<ModelCheckerHint>());
+            }
+        }
+        
         template class SparseInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double>;
         template class SparseInstantiationModelChecker<storm::models::sparse::Mdp<storm::RationalFunction>, double>;
         
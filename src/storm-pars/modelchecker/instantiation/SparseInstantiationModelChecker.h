@@ -30,6 +30,19 @@ namespace storm {
             void setInstantiationsAreGraphPreserving(bool value);
             bool getInstantiationsAreGraphPreserving() const;
             
+            /*!
+             * Retrieves a copy of the hint with which the next check is warm-started, i.e., the data of the most recent
+             * check. Returns a null pointer if there is no such data.
+             */
+            std::shared_ptr<ModelCheckerHint const> getHint() const;
+            
+            /*!
+             * Sets the hint with which the next check is warm-started. The hint has to be obtained from an instantiation
+             * model checker of the same type that is specified for the same model and formula. A null pointer lets the
+             * next check start from scratch.
+             */
+            void setHint(std::shared_ptr<ModelCheckerHint const> const& hint);
+            
         protected:
             
             SparseModelType const& parametricModel;
@@ -1,12 +1,15 @@
 #include <sstream>
-#include <queue>
+#include <deque>
 
 #include "storm-pars/modelchecker/region/RegionModelChecker.h"
 
+#include "storm-config.h"
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 
 #include "storm/utility/vector.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
@@ -51,7 +54,17 @@ namespace storm {
             }
         
             template <typename ParametricType>
-            std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> RegionModelChecker<ParametricType>::performRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis) {
+            std::shared_ptr<RegionWarmStartData const> RegionModelChecker<ParametricType>::getWarmStartData() const {
+                return nullptr;
+            }
+        
+            template <typename ParametricType>
+            void RegionModelChecker<ParametricType>::setWarmStartData(std::shared_ptr<RegionWarmStartData const> const&) {
+                // Intentionally left empty
+            }
+        
+            template <typename ParametricType>
+            std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> RegionModelChecker<ParametricType>::performRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis, std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& additionalCheckers) {
                 STORM_LOG_INFO("Applying refinement on region: " << region.toString(true) << " .");
                 
                 auto thresholdAsCoefficient = coverageThreshold ? storm::utility::convertNumber<CoefficientType>(coverageThreshold.get()) : storm::utility::zero<CoefficientType>();
@@ -63,11 +76,30 @@ namespace storm {
                 // The resulting (sub-)regions
                 std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> result;
                 
-                // FIFO queues storing the data for the regions that we still need to process.
-                std::queue<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> unprocessedRegions;
-                std::queue<uint64_t> refinementDepths;
-                unprocessedRegions.emplace(region, RegionResult::Unknown);
-                refinementDepths.push(0);
+                // FIFO queue storing the data for the regions that we still need to process.
+                struct UnprocessedRegion {
+                    storm::storage::ParameterRegion<ParametricType> region;
+                    RegionResult result;
+                    uint64_t refinementDepth;
+                    // The data with which the analysis is warm-started, i.e., the data of the analysis of the parent region.
+                    std::shared_ptr<RegionWarmStartData const> warmStartData;
+                };
+                std::deque<UnprocessedRegion> unprocessedRegions;
+                unprocessedRegions.push_back(UnprocessedRegion{region, RegionResult::Unknown, 0, nullptr});
+                
+#ifndef STORM_CARL_THREAD_SAFE
+                STORM_LOG_THROW(additionalCheckers.empty(), storm::exceptions::NotSupportedException, "Analyzing regions concurrently requires carl to be built thread-safe.");
+#endif
+                
+                // The checkers that analyze regions concurrently. The checker with the index of a thread is only used by that thread.
+                std::vector<RegionModelChecker<ParametricType>*> checkers = {this};
+                for (auto const& checker : additionalCheckers) {
+                    checkers.push_back(checker.get());
+                }
+                std::unique_ptr<storm::utility::ThreadPool> threadPool;
+                if (checkers.size() > 1) {
+                    threadPool = std::make_unique<storm::utility::ThreadPool>(checkers.size());
+                }
                 
                 uint_fast64_t numOfAnalyzedRegions = 0;
                 CoefficientType displayedProgress = storm::utility::zero<CoefficientType>();
@@ -86,56 +118,72 @@ namespace storm {
                 }
 
                 while (fractionOfUndiscoveredArea > thresholdAsCoefficient && !unprocessedRegions.empty()) {
-                    assert(unprocessedRegions.size() == refinementDepths.size());
-                    uint64_t currentDepth = refinementDepths.front();
-                    STORM_LOG_INFO("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << currentDepth << "; " << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
-                    auto& currentRegion = unprocessedRegions.front().first;
-                    auto& res = unprocessedRegions.front().second;
-                    res = analyzeRegion(env, currentRegion, hypothesis, res, false);
-                    switch (res) {
-                        case RegionResult::AllSat:
-                            fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
-                            fractionOfAllSatArea += currentRegion.area() / areaOfParameterSpace;
-                            result.push_back(std::move(unprocessedRegions.front()));
-                            break;
-                        case RegionResult::AllViolated:
-                            fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
-                            fractionOfAllViolatedArea += currentRegion.area() / areaOfParameterSpace;
-                            result.push_back(std::move(unprocessedRegions.front()));
-                            break;
-                        default:
-                            // Split the region as long as the desired refinement depth is not reached.
-                            if (!depthThreshold || currentDepth < depthThreshold.get()) {
-                                std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
-                                currentRegion.split(currentRegion.getCenterPoint(), newRegions);
-                                RegionResult initResForNewRegions = (res == RegionResult::CenterSat) ? RegionResult::ExistsSat :
-                                                                         ((res == RegionResult::CenterViolated) ? RegionResult::ExistsViolated :
-                                                                          RegionResult::Unknown);
-                                for (auto& newRegion : newRegions) {
-                                    unprocessedRegions.emplace(std::move(newRegion), initResForNewRegions);
-                                    refinementDepths.push(currentDepth + 1);
+                    // Analyze the next regions of the queue concurrently. As every analysis is warm-started with the data
+                    // of the parent region (and not with the data of the region the checker analyzed before), the results
+                    // do not depend on which checker analyzes which region.
+                    uint64_t batchSize = std::min<uint64_t>(unprocessedRegions.size(), checkers.size() * (checkers.size() > 1 ? 4 : 1));
+                    std::vector<RegionResult> batchResults(batchSize);
+                    std::vector<std::shared_ptr<RegionWarmStartData const>> batchWarmStartData(batchSize);
+                    auto analyze = [&] (uint64_t index, uint64_t thread) {
+                        UnprocessedRegion const& unprocessedRegion = unprocessedRegions[index];
+                        STORM_LOG_INFO("Analyzing region #" << (numOfAnalyzedRegions + index) << " (Refinement depth " << unprocessedRegion.refinementDepth << ")");
+                        checkers[thread]->setWarmStartData(unprocessedRegion.warmStartData);
+                        batchResults[index] = checkers[thread]->analyzeRegion(env, unprocessedRegion.region, hypothesis, unprocessedRegion.result, false);
+                        batchWarmStartData[index] = checkers[thread]->getWarmStartData();
+                    };
+                    if (threadPool) {
+                        threadPool->execute(batchSize, analyze);
+                    } else {
+                        analyze(0, 0);
+                    }
+                    
+                    // Process the results in the order of the queue, as if the regions were analyzed one after another.
+                    // In particular, the refinement stops at the same region irrespective of the number of threads.
+                    for (uint64_t index = 0; index < batchSize && fractionOfUndiscoveredArea > thresholdAsCoefficient; ++index) {
+                        UnprocessedRegion currentRegion = std::move(unprocessedRegions.front());
+                        unprocessedRegions.pop_front();
+                        currentRegion.result = batchResults[index];
+                        switch (currentRegion.result) {
+                            case RegionResult::AllSat:
+                                fractionOfUndiscoveredArea -= currentRegion.region.area() / areaOfParameterSpace;
+                                fractionOfAllSatArea += currentRegion.region.area() / areaOfParameterSpace;
+                                result.emplace_back(std::move(currentRegion.region), currentRegion.result);
+                                break;
+                            case RegionResult::AllViolated:
+                                fractionOfUndiscoveredArea -= currentRegion.region.area() / areaOfParameterSpace;
+                                fractionOfAllViolatedArea += currentRegion.region.area() / areaOfParameterSpace;
+                                result.emplace_back(std::move(currentRegion.region), currentRegion.result);
+                                break;
+                            default:
+                                // Split the region as long as the desired refinement depth is not reached.
+                                if (!depthThreshold || currentRegion.refinementDepth < depthThreshold.get()) {
+                                    std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
+                                    currentRegion.region.split(currentRegion.region.getCenterPoint(), newRegions);
+                                    RegionResult initResForNewRegions = (currentRegion.result == RegionResult::CenterSat) ? RegionResult::ExistsSat :
+                                                                             ((currentRegion.result == RegionResult::CenterViolated) ? RegionResult::ExistsViolated :
+                                                                              RegionResult::Unknown);
+                                    for (auto& newRegion : newRegions) {
+                                        unprocessedRegions.push_back(UnprocessedRegion{std::move(newRegion), initResForNewRegions, currentRegion.refinementDepth + 1, batchWarmStartData[index]});
+                                    }
+                                } else {
+                                    // If the region is not further refined, it is still added to the result
+                                    result.emplace_back(std::move(currentRegion.region), currentRegion.result);
                                 }
-                            } else {
-                                // If the region is not further refined, it is still added to the result
-                                result.push_back(std::move(unprocessedRegions.front()));
+                                break;
+                        }
+                        ++numOfAnalyzedRegions;
+                        if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                            while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
+                                STORM_PRINT_AND_LOG("#");
+                                displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
                             }
-                            break;
-                    }
-                    ++numOfAnalyzedRegions;
-                    unprocessedRegions.pop();
-                    refinementDepths.pop();
-                    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
-                        while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
-                            STORM_PRINT_AND_LOG("#");
-                            displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
                         }
                     }
                 }
                 
                 // Add the still unprocessed regions to the result
-                while (!unprocessedRegions.empty()) {
-                    result.push_back(std::move(unprocessedRegions.front()));
-                    unprocessedRegions.pop();
+                for (auto& unprocessedRegion : unprocessedRegions) {
+                    result.emplace_back(std::move(unprocessedRegion.region), unprocessedRegion.result);
                 }
                 
                 if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
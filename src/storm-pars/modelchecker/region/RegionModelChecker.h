@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "storm-pars/modelchecker/results/RegionCheckResult.h"
 #include "storm-pars/modelchecker/results/RegionRefinementCheckResult.h"
@@ -17,6 +18,13 @@ namespace storm {
     
     namespace modelchecker{
         
+        /*!
+         * Base class for the data of a region analysis with which the analysis of its subregions can be warm-started.
+         */
+        struct RegionWarmStartData {
+            virtual ~RegionWarmStartData() = default;
+        };
+        
         template<typename ParametricType>
         class RegionModelChecker {
         public:
@@ -53,9 +61,24 @@ namespace storm {
              * @param coverageThreshold if given, the refinement stops as soon as the fraction of the area of the subregions with inconclusive result is less then this threshold
              * @param depthThreshold if given, the refinement stops at the given depth. depth=0 means no refinement.
              * @param hypothesis if not 'unknown', it is only checked whether the hypothesis holds within the given region.
+             * @param additionalCheckers if given, these checkers (which have to be specified for the same model and property) analyze regions in parallel to this checker, one thread per checker.
+             * The result does not depend on the number of checkers, as every region is analyzed with the warm-start data of its parent region (including the hints for checking instantiations) and the results are processed in the same order.
+             * As the checkers work on rational functions concurrently, additional checkers may only be given if carl was built thread-safe (STORM_CARL_THREAD_SAFE).
              *
              */
-            std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> performRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold = boost::none, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown);
+            std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> performRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold = boost::none, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown, std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& additionalCheckers = {});
+            
+            /*!
+             * Retrieves the data of the most recent region analysis with which the analysis of its subregions can be warm-started.
+             * The default implementation returns a null pointer, i.e., no data.
+             */
+            virtual std::shared_ptr<RegionWarmStartData const> getWarmStartData() const;
+            
+            /*!
+             * Sets the data with which the next region analysis is warm-started. A null pointer lets the next analysis start from scratch.
+             * The data has to be obtained from a region model checker of the same type that is specified for the same model and property.
+             */
+            virtual void setWarmStartData(std::shared_ptr<RegionWarmStartData const> const& data);
             
         };
 
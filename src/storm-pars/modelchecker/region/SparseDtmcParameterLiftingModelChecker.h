@@ -28,6 +28,9 @@ namespace storm {
             
             boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentMinScheduler();
             boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentMaxScheduler();
+            
+            virtual std::shared_ptr<RegionWarmStartData const> getWarmStartData() const override;
+            virtual void setWarmStartData(std::shared_ptr<RegionWarmStartData const> const& data) override;
 
         protected:
                 
@@ -43,6 +46,14 @@ namespace storm {
             virtual void reset() override;
                 
         private:
+            // The results of a solver call that are used to warm-start the analysis of subregions.
+            struct WarmStartData : public RegionWarmStartData {
+                boost::optional<std::vector<uint_fast64_t>> minSchedChoices, maxSchedChoices;
+                std::vector<ConstantType> x;
+                // The hint of the instantiation checker that is used for the center point and the vertices.
+                std::shared_ptr<ModelCheckerHint const> instantiationHint;
+            };
+            
 
             
             storm::storage::BitVector maybeStates;
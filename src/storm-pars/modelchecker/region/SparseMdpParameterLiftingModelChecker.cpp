@@ -347,6 +347,40 @@ namespace storm {
             applyPreviousResultAsHint = false;
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        std::shared_ptr<RegionWarmStartData const> SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::getWarmStartData() const {
+            auto data = std::make_shared<WarmStartData>();
+            data->minSchedChoices = minSchedChoices;
+            data->maxSchedChoices = maxSchedChoices;
+            data->player1SchedChoices = player1SchedChoices;
+            data->x = x;
+            data->instantiationHint = instantiationChecker ? instantiationChecker->getHint() : nullptr;
+            return data;
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        void SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::setWarmStartData(std::shared_ptr<RegionWarmStartData const> const& data) {
+            if (data) {
+                auto warmStartData = std::dynamic_pointer_cast<WarmStartData const>(data);
+                STORM_LOG_THROW(warmStartData, storm::exceptions::InvalidArgumentException, "The given warm-start data has not been obtained from a checker of the same type.");
+                minSchedChoices = warmStartData->minSchedChoices;
+                maxSchedChoices = warmStartData->maxSchedChoices;
+                player1SchedChoices = warmStartData->player1SchedChoices;
+                x = warmStartData->x;
+                if (warmStartData->instantiationHint || instantiationChecker) {
+                    getInstantiationChecker().setHint(warmStartData->instantiationHint);
+                }
+            } else {
+                minSchedChoices = boost::none;
+                maxSchedChoices = boost::none;
+                player1SchedChoices = boost::none;
+                x.clear();
+                if (instantiationChecker) {
+                    instantiationChecker->setHint(nullptr);
+                }
+            }
+        }
+        
         template <typename SparseModelType, typename ConstantType>
         boost::optional<storm::storage::Scheduler<ConstantType>> SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::getCurrentMinScheduler() {
             if (!minSchedChoices) {
@@ -31,6 +31,9 @@ namespace storm {
             boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentMinScheduler();
             boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentMaxScheduler();
             boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentPlayer1Scheduler();
+            
+            virtual std::shared_ptr<RegionWarmStartData const> getWarmStartData() const override;
+            virtual void setWarmStartData(std::shared_ptr<RegionWarmStartData const> const& data) override;
                 
         protected:
                 
@@ -47,6 +50,15 @@ namespace storm {
                 
 
         private:
+            // The results of a solver call that are used to warm-start the analysis of subregions.
+            struct WarmStartData : public RegionWarmStartData {
+                boost::optional<std::vector<uint_fast64_t>> minSchedChoices, maxSchedChoices;
+                boost::optional<std::vector<uint_fast64_t>> player1SchedChoices;
+                std::vector<ConstantType> x;
+                // The hint of the instantiation checker that is used for the center point and the vertices.
+                std::shared_ptr<ModelCheckerHint const> instantiationHint;
+            };
+            
             void computePlayer1Matrix(boost::optional<storm::storage::BitVector> const& selectedRows = boost::none);
             
             storm::storage::BitVector maybeStates;
@@ -69,6 +69,16 @@ namespace storm {
             return currentResult;
         }
 
+        template <typename SparseModelType, typename ImpreciseType, typename PreciseType>
+        std::shared_ptr<RegionWarmStartData const> ValidatingSparseParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::getWarmStartData() const {
+            return getImpreciseChecker().getWarmStartData();
+        }
+        
+        template <typename SparseModelType, typename ImpreciseType, typename PreciseType>
+        void ValidatingSparseParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::setWarmStartData(std::shared_ptr<RegionWarmStartData const> const& data) {
+            getImpreciseChecker().setWarmStartData(data);
+        }
+        
         template class ValidatingSparseParameterLiftingModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double, storm::RationalNumber>;
         template class ValidatingSparseParameterLiftingModelChecker<storm::models::sparse::Mdp<storm::RationalFunction>, double, storm::RationalNumber>;
 
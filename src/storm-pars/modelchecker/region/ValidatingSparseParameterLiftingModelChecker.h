@@ -24,6 +24,13 @@ namespace storm {
              * by means of exact and soud methods.
              */
             virtual RegionResult analyzeRegion(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown, RegionResult const& initialResult = RegionResult::Unknown, bool sampleVerticesOfRegion = false) override;
+            
+            /*!
+             * The warm-start data is the one of the imprecise checker. The precise checker obtains its hints from the
+             * imprecise checker and computes exact results, so it does not depend on previous analyses.
+             */
+            virtual std::shared_ptr<RegionWarmStartData const> getWarmStartData() const override;
+            virtual void setWarmStartData(std::shared_ptr<RegionWarmStartData const> const& data) override;
 
         protected:
             
@@ -18,6 +18,8 @@ namespace storm {
             const std::string ParametricSettings::transformContinuousOptionName = "transformcontinuous";
             const std::string ParametricSettings::transformContinuousShortOptionName = "tc";
             const std::string ParametricSettings::onlyWellformednessConstraintsOptionName = "onlyconstraints";
+            const std::string ParametricSettings::samplesOptionName = "samples";
+            const std::string ParametricSettings::samplesGraphPreservingOptionName = "samples-graph-preserving";
             
             ParametricSettings::ParametricSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportResultOptionName, false, "A path to a file where the parametric result should be saved.")
@@ -25,6 +27,9 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, derivativesOptionName, false, "Sets whether to generate the derivatives of the resulting rational function.").build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, transformContinuousOptionName, false, "Sets whether to transform a continuous time input model to a discrete time model.").setShortName(transformContinuousShortOptionName).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, onlyWellformednessConstraintsOptionName, false, "Sets whether you only want to obtain the wellformedness constraints").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, samplesOptionName, false, "The points at which to sample the model. The model is only built once and instantiated for every sample point. Only constants that occur in probabilities or rewards can be sampled; constants that influence the structure of the model (e.g. bounds of variables) need to be defined with --constants.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("samples", "The samples are semicolon-separated entries of the form 'p=0.1:0.2:0.3,q=0.5' that span the sample spaces.").setDefaultValueString("").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, samplesGraphPreservingOptionName, false, "Sets whether it can be assumed that the samples are graph-preserving, i.e. that the qualitative analysis of the first sample can be reused for all others.").build());
             }
             
             bool ParametricSettings::exportResultToFile() const {
@@ -47,6 +52,18 @@ namespace storm {
                 return this->getOption(onlyWellformednessConstraintsOptionName).getHasOptionBeenSet();
             }
 
+            bool ParametricSettings::isSamplesSet() const {
+                return this->getOption(samplesOptionName).getHasOptionBeenSet();
+            }
+
+            std::string ParametricSettings::getSamples() const {
+                return this->getOption(samplesOptionName).getArgumentByName("samples").getValueAsString();
+            }
+
+            bool ParametricSettings::isSamplesAreGraphPreservingSet() const {
+                return this->getOption(samplesGraphPreservingOptionName).getHasOptionBeenSet();
+            }
+
         } // namespace modules
     } // namespace settings
 } // namespace storm
@@ -46,6 +46,21 @@ namespace storm {
                  * Retrieves whether instead of model checking, only the wellformedness constraints should be obtained.
                  */
                 bool onlyObtainConstraints() const;
+
+                /*!
+                 * Retrieves whether samples of the parameters are given at which the model is to be checked.
+                 */
+                bool isSamplesSet() const;
+
+                /*!
+                 * Retrieves the samples of the parameters in the format 'Var1=Val1:Val2:...:Valk,Var2=...;...'.
+                 */
+                std::string getSamples() const;
+
+                /*!
+                 * Retrieves whether it can be assumed that all samples induce the same graph structure.
+                 */
+                bool isSamplesAreGraphPreservingSet() const;
 				
                 const static std::string moduleName;
                 
@@ -55,6 +70,8 @@ namespace storm {
                 const static std::string transformContinuousOptionName;
                 const static std::string transformContinuousShortOptionName;
                 const static std::string onlyWellformednessConstraintsOptionName;
+                const static std::string samplesOptionName;
+                const static std::string samplesGraphPreservingOptionName;
             };
             
         } // namespace modules
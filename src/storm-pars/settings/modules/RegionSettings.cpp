@@ -21,6 +21,7 @@ namespace storm {
             const std::string RegionSettings::hypothesisShortOptionName = "hyp";
             const std::string RegionSettings::refineOptionName = "refine";
             const std::string RegionSettings::checkEngineOptionName = "engine";
+            const std::string RegionSettings::threadsOptionName = "threads";
             const std::string RegionSettings::printNoIllustrationOptionName = "noillustration";
             const std::string RegionSettings::printFullResultOptionName = "printfullresult";
             
@@ -40,6 +41,9 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, checkEngineOptionName, true, "Sets which engine is used for analyzing regions.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the engine to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(engines)).setDefaultValueString("pl").build()).build());
 
+                this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true, "Sets the number of threads that analyze regions concurrently during refinement. Several threads are only used if carl was built thread-safe.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 for the number of hardware threads).").setDefaultValueUnsignedInteger(1).build()).build());
+
                 this->addOption(storm::settings::OptionBuilder(moduleName, printNoIllustrationOptionName, false, "If set, no illustration of the result is printed.").build());
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, printFullResultOptionName, false, "If set, the full result for every region is printed.").build());
@@ -93,6 +97,10 @@ namespace storm {
                 return (uint64_t) depth;
             }
             
+            uint64_t RegionSettings::getNumberOfThreads() const {
+                return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
             storm::modelchecker::RegionCheckEngine RegionSettings::getRegionCheckEngine() const {
                 std::string engineString = this->getOption(checkEngineOptionName).getArgumentByName("name").getValueAsString();
                 
@@ -61,6 +61,13 @@ namespace storm {
                  */
                 uint64_t getDepthLimit() const;
                 
+                /*!
+                 * Retrieves the number of threads that analyze regions concurrently during refinement.
+                 *
+                 * @return The number of threads (zero for the number of hardware threads).
+                 */
+                uint64_t getNumberOfThreads() const;
+                
 				/*!
 				 * Retrieves which type of region check should be performed
 				 */
@@ -85,6 +92,7 @@ namespace storm {
 				const static std::string hypothesisShortOptionName;
 				const static std::string refineOptionName;
 				const static std::string checkEngineOptionName;
+				const static std::string threadsOptionName;
 				const static std::string printNoIllustrationOptionName;
 				const static std::string printFullResultOptionName;
             };
@@ -1,5 +1,7 @@
 #include "storm-pars/transformer/ParameterLifter.h"
 
+#include <type_traits>
+
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -191,6 +193,21 @@ namespace storm {
             unspecifiedPars.insert(var);
         }
         
+        template<typename ParametricType, typename ConstantType>
+        std::set<typename ParameterLifter<ParametricType, ConstantType>::VariableType> const& ParameterLifter<ParametricType, ConstantType>::AbstractValuation::getLowerParameters() const {
+            return lowerPars;
+        }
+        
+        template<typename ParametricType, typename ConstantType>
+        std::set<typename ParameterLifter<ParametricType, ConstantType>::VariableType> const& ParameterLifter<ParametricType, ConstantType>::AbstractValuation::getUpperParameters() const {
+            return upperPars;
+        }
+        
+        template<typename ParametricType, typename ConstantType>
+        std::set<typename ParameterLifter<ParametricType, ConstantType>::VariableType> const& ParameterLifter<ParametricType, ConstantType>::AbstractValuation::getUnspecifiedParameters() const {
+            return unspecifiedPars;
+        }
+        
         template<typename ParametricType, typename ConstantType>
         std::size_t ParameterLifter<ParametricType, ConstantType>::AbstractValuation::getHashValue() const {
             std::size_t seed = 0;
@@ -247,11 +264,81 @@ namespace storm {
             // insert the function and the valuation
             //Note that references to elements of an unordered map remain valid after calling unordered_map::insert.
             auto insertionRes = collectedFunctions.insert(std::pair<FunctionValuation, ConstantType>(FunctionValuation(std::move(simplifiedFunction), std::move(simplifiedValuation)), storm::utility::one<ConstantType>()));
+            // The compiled functions are outdated.
+            compiledFunctions = nullptr;
             return insertionRes.first->second;
         }
+        
+        template<typename ParametricType, typename ConstantType>
+        void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::compileCollectedFunctions() {
+            compiledFunctions = std::make_unique<storm::utility::CompiledRationalFunctions>();
+            compiledFunctionValuations.clear();
+            compiledFunctionValuations.reserve(collectedFunctions.size());
+            for (auto& collectedFunctionValuationPlaceholder : collectedFunctions) {
+                AbstractValuation const& abstrValuation = collectedFunctionValuationPlaceholder.first.second;
+                CompiledFunctionValuation compiledFunctionValuation;
+                compiledFunctionValuation.function = compiledFunctions->addFunction(collectedFunctionValuationPlaceholder.first.first);
+                for (auto const& var : abstrValuation.getLowerParameters()) {
+                    compiledFunctionValuation.lowerVariables.push_back(compiledFunctions->getVariableIndex(var));
+                }
+                for (auto const& var : abstrValuation.getUpperParameters()) {
+                    compiledFunctionValuation.upperVariables.push_back(compiledFunctions->getVariableIndex(var));
+                }
+                for (auto const& var : abstrValuation.getUnspecifiedParameters()) {
+                    compiledFunctionValuation.unspecifiedVariables.push_back(compiledFunctions->getVariableIndex(var));
+                }
+                compiledFunctionValuation.placeholder = &collectedFunctionValuationPlaceholder.second;
+                compiledFunctionValuations.push_back(std::move(compiledFunctionValuation));
+            }
+        }
     
         template<typename ParametricType, typename ConstantType>
         void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
+            if (std::is_same<ConstantType, double>::value) {
+                if (!compiledFunctions) {
+                    compileCollectedFunctions();
+                }
+                
+                // Evaluate the compiled functions at the vertices of the region.
+                auto const& variables = compiledFunctions->getVariables();
+                std::vector<double> lowerBounds, upperBounds;
+                lowerBounds.reserve(variables.size());
+                upperBounds.reserve(variables.size());
+                for (auto const& var : variables) {
+                    lowerBounds.push_back(storm::utility::convertNumber<double>(region.getLowerBoundary(var)));
+                    upperBounds.push_back(storm::utility::convertNumber<double>(region.getUpperBoundary(var)));
+                }
+                std::vector<double> variableValues(variables.size());
+                std::vector<double> registers = compiledFunctions->createRegisters();
+                for (auto const& compiledFunctionValuation : compiledFunctionValuations) {
+                    for (auto const& var : compiledFunctionValuation.lowerVariables) {
+                        variableValues[var] = lowerBounds[var];
+                    }
+                    for (auto const& var : compiledFunctionValuation.upperVariables) {
+                        variableValues[var] = upperBounds[var];
+                    }
+                    // Every vertex of the unspecified parameters is represented by a bit sequence (0 = lower bound, 1 = upper bound).
+                    uint64_t numOfVertices = 1ull << compiledFunctionValuation.unspecifiedVariables.size();
+                    double result = 0.0;
+                    for (uint64_t vertexId = 0; vertexId < numOfVertices; ++vertexId) {
+                        for (uint64_t variableIndex = 0; variableIndex < compiledFunctionValuation.unspecifiedVariables.size(); ++variableIndex) {
+                            uint64_t var = compiledFunctionValuation.unspecifiedVariables[variableIndex];
+                            variableValues[var] = ((vertexId >> variableIndex) % 2 == 0) ? lowerBounds[var] : upperBounds[var];
+                        }
+                        double currentResult = compiledFunctions->evaluate(compiledFunctionValuation.function, variableValues.data(), registers);
+                        if (vertexId == 0) {
+                            result = currentResult;
+                        } else if (storm::solver::minimize(dirForUnspecifiedParameters)) {
+                            result = std::min(result, currentResult);
+                        } else {
+                            result = std::max(result, currentResult);
+                        }
+                    }
+                    *compiledFunctionValuation.placeholder = storm::utility::convertNumber<ConstantType>(result);
+                }
+                return;
+            }
+            
             for (auto& collectedFunctionValuationPlaceholder : collectedFunctions) {
                 ParametricType const& function = collectedFunctionValuationPlaceholder.first.first;
                 AbstractValuation const& abstrValuation = collectedFunctionValuationPlaceholder.first.second;
@@ -8,6 +8,7 @@
 
 #include "storm-pars/storage/ParameterRegion.h"
 #include "storm-pars/utility/parametric.h"
+#include "storm-pars/utility/CompiledRationalFunctions.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/solver/OptimizationDirection.h"
@@ -70,6 +71,10 @@ namespace storm {
                 void addParameterUpper(VariableType const& var);
                 void addParameterUnspecified(VariableType const& var);
                 
+                std::set<VariableType> const& getLowerParameters() const;
+                std::set<VariableType> const& getUpperParameters() const;
+                std::set<VariableType> const& getUnspecifiedParameters() const;
+                
                 std::size_t getHashValue() const;
                 AbstractValuation getSubValuation(std::set<VariableType> const& pars) const;
                 
@@ -114,6 +119,22 @@ namespace storm {
                 
                 // Stores the collected functions with the valuations together with a placeholder for the result.
                 std::unordered_map<FunctionValuation, ConstantType, FuncValHash> collectedFunctions;
+                
+                /*!
+                 * Compiles the collected functions. This is done when the functions are evaluated for the first time.
+                 */
+                void compileCollectedFunctions();
+                
+                // If the results are computed in double precision, the collected functions are compiled (see CompiledRationalFunctions).
+                // For every collected pair of function and valuation, we store the index of the compiled function, the indices of the
+                // variables that are set to the lower bound, the upper bound or that are unspecified, and the placeholder for the result.
+                struct CompiledFunctionValuation {
+                    uint64_t function;
+                    std::vector<uint64_t> lowerVariables, upperVariables, unspecifiedVariables;
+                    ConstantType* placeholder;
+                };
+                std::unique_ptr<storm::utility::CompiledRationalFunctions> compiledFunctions;
+                std::vector<CompiledFunctionValuation> compiledFunctionValuations;
             };
             
             FunctionValuationCollector functionValuationCollector;
@@ -0,0 +1,344 @@
+#include "storm-pars/utility/CompiledRationalFunctions.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_set>
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/simd.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace utility {
+
+        const uint64_t CompiledRationalFunctions::batchBlockSize;
+
+        namespace detail {
+
+            // Applies the instructions to all valuations of a block. The loops over the valuations have a fixed length,
+            // so the compiler turns them into vector instructions of the targeted instruction set.
+            template<typename InstructionType>
+            inline void executeBlock(std::vector<InstructionType> const& instructions, double* registers) {
+                uint64_t const blockSize = CompiledRationalFunctions::batchBlockSize;
+                for (auto const& instruction : instructions) {
+                    double* result = registers + instruction.result * blockSize;
+                    double const* left = registers + instruction.left * blockSize;
+                    double const* right = registers + instruction.right * blockSize;
+                    switch (instruction.opCode) {
+                        case decltype(instruction.opCode)::Add:
+                            for (uint64_t lane = 0; lane < blockSize; ++lane) {
+                                result[lane] = left[lane] + right[lane];
+                            }
+                            break;
+                        case decltype(instruction.opCode)::Subtract:
+                            for (uint64_t lane = 0; lane < blockSize; ++lane) {
+                                result[lane] = left[lane] - right[lane];
+                            }
+                            break;
+                        case decltype(instruction.opCode)::Multiply:
+                            for (uint64_t lane = 0; lane < blockSize; ++lane) {
+                                result[lane] = left[lane] * right[lane];
+                            }
+                            break;
+                        case decltype(instruction.opCode)::Divide:
+                            for (uint64_t lane = 0; lane < blockSize; ++lane) {
+                                result[lane] = left[lane] / right[lane];
+                            }
+                            break;
+                    }
+                }
+            }
+
+#ifdef STORM_HAVE_X86_SIMD_KERNELS
+            template<typename InstructionType>
+            __attribute__((target("avx2,fma"), flatten))
+            void executeBlockAvx2(std::vector<InstructionType> const& instructions, double* registers) {
+                executeBlock(instructions, registers);
+            }
+
+            template<typename InstructionType>
+            __attribute__((target("avx512f"), flatten))
+            void executeBlockAvx512(std::vector<InstructionType> const& instructions, double* registers) {
+                executeBlock(instructions, registers);
+            }
+#endif
+
+            template<typename InstructionType>
+            void dispatchExecuteBlock(storm::utility::simd::SimdKernel const& kernel, std::vector<InstructionType> const& instructions, double* registers) {
+                switch (kernel) {
+#ifdef STORM_HAVE_X86_SIMD_KERNELS
+                    case storm::utility::simd::SimdKernel::Avx512:
+                        executeBlockAvx512(instructions, registers);
+                        return;
+                    case storm::utility::simd::SimdKernel::Avx2:
+                        executeBlockAvx2(instructions, registers);
+                        return;
+#endif
+                    default:
+                        executeBlock(instructions, registers);
+                }
+            }
+
+            template<typename InstructionType>
+            inline void execute(InstructionType const& instruction, double* registers) {
+                switch (instruction.opCode) {
+                    case decltype(instruction.opCode)::Add:
+                        registers[instruction.result] = registers[instruction.left] + registers[instruction.right];
+                        break;
+                    case decltype(instruction.opCode)::Subtract:
+                        registers[instruction.result] = registers[instruction.left] - registers[instruction.right];
+                        break;
+                    case decltype(instruction.opCode)::Multiply:
+                        registers[instruction.result] = registers[instruction.left] * registers[instruction.right];
+                        break;
+                    case decltype(instruction.opCode)::Divide:
+                        registers[instruction.result] = registers[instruction.left] / registers[instruction.right];
+                        break;
+                }
+            }
+        }
+
+        uint64_t CompiledRationalFunctions::addFunction(storm::RationalFunction const& function) {
+            auto functionIt = functionIndices.find(function);
+            if (functionIt != functionIndices.end()) {
+                return functionIt->second;
+            }
+
+            uint32_t resultRegister;
+            if (function.isConstant()) {
+                resultRegister = getConstantRegister(storm::utility::convertNumber<double>(function.constantPart()));
+            } else {
+                resultRegister = getPolynomialRegister(function.nominator().polynomialWithCoefficient());
+                storm::RawPolynomial denominator = function.denominator().polynomialWithCoefficient();
+                if (!denominator.isOne()) {
+                    resultRegister = getInstructionRegister(OpCode::Divide, resultRegister, getPolynomialRegister(denominator));
+                }
+            }
+
+            uint64_t index = functionRegisters.size();
+            functionRegisters.push_back(resultRegister);
+            functionDependencies.emplace_back();
+            functionDependenciesComputed.push_back(std::make_unique<std::once_flag>());
+            functionIndices.emplace(function, index);
+            return index;
+        }
+
+        uint64_t CompiledRationalFunctions::getNumberOfFunctions() const {
+            return functionRegisters.size();
+        }
+
+        uint64_t CompiledRationalFunctions::getNumberOfInstructions() const {
+            return instructions.size();
+        }
+
+        std::vector<typename CompiledRationalFunctions::VariableType> const& CompiledRationalFunctions::getVariables() const {
+            return variables;
+        }
+
+        uint64_t CompiledRationalFunctions::getVariableIndex(VariableType const& variable) const {
+            auto variableIt = variableIndices.find(variable);
+            STORM_LOG_THROW(variableIt != variableIndices.end(), storm::exceptions::InvalidArgumentException, "The variable " << variable << " does not occur in the compiled functions.");
+            return variableIt->second;
+        }
+
+        std::vector<double> CompiledRationalFunctions::getVariableValues(storm::utility::parametric::Valuation<storm::RationalFunction> const& valuation) const {
+            std::vector<double> result;
+            result.reserve(variables.size());
+            for (auto const& variable : variables) {
+                auto valuationIt = valuation.find(variable);
+                STORM_LOG_THROW(valuationIt != valuation.end(), storm::exceptions::InvalidArgumentException, "The valuation does not assign a value to the variable " << variable << ".");
+                result.push_back(storm::utility::convertNumber<double>(valuationIt->second));
+            }
+            return result;
+        }
+
+        std::vector<double> CompiledRationalFunctions::createRegisters() const {
+            return initialRegisters;
+        }
+
+        void CompiledRationalFunctions::evaluate(double const* variableValues, std::vector<double>& registers, double* results) const {
+            STORM_LOG_ASSERT(registers.size() == initialRegisters.size(), "Unexpected number of registers.");
+            for (uint64_t variable = 0; variable < variables.size(); ++variable) {
+                registers[variableRegisters[variable]] = variableValues[variable];
+            }
+            for (auto const& instruction : instructions) {
+                detail::execute(instruction, registers.data());
+            }
+            for (uint64_t function = 0; function < functionRegisters.size(); ++function) {
+                results[function] = registers[functionRegisters[function]];
+            }
+        }
+
+        double CompiledRationalFunctions::evaluate(uint64_t function, double const* variableValues, std::vector<double>& registers) const {
+            STORM_LOG_ASSERT(registers.size() == initialRegisters.size(), "Unexpected number of registers.");
+            for (uint64_t variable = 0; variable < variables.size(); ++variable) {
+                registers[variableRegisters[variable]] = variableValues[variable];
+            }
+            std::call_once(*functionDependenciesComputed[function], [&] () { functionDependencies[function] = getDependencies(functionRegisters[function]); });
+            for (auto const& instructionIndex : functionDependencies[function]) {
+                detail::execute(instructions[instructionIndex], registers.data());
+            }
+            return registers[functionRegisters[function]];
+        }
+
+        void CompiledRationalFunctions::evaluateBatch(uint64_t numberOfValuations, double const* variableValues, double* results) const {
+            storm::utility::simd::SimdKernel kernel = storm::utility::simd::getBestSupportedKernel();
+
+            // The registers of a block hold the values of all its valuations next to each other. The constants are never
+            // overwritten, so they only have to be set once.
+            std::vector<double> registers(initialRegisters.size() * batchBlockSize);
+            for (uint64_t reg = 0; reg < initialRegisters.size(); ++reg) {
+                std::fill(registers.begin() + reg * batchBlockSize, registers.begin() + (reg + 1) * batchBlockSize, initialRegisters[reg]);
+            }
+
+            for (uint64_t blockStart = 0; blockStart < numberOfValuations; blockStart += batchBlockSize) {
+                uint64_t blockEnd = std::min(blockStart + batchBlockSize, numberOfValuations);
+                for (uint64_t variable = 0; variable < variables.size(); ++variable) {
+                    double const* values = variableValues + variable * numberOfValuations;
+                    double* variableRegister = registers.data() + variableRegisters[variable] * batchBlockSize;
+                    for (uint64_t lane = 0; lane < batchBlockSize; ++lane) {
+                        // The unused lanes of the last block repeat the first valuation of the block.
+                        variableRegister[lane] = values[blockStart + lane < blockEnd ? blockStart + lane : blockStart];
+                    }
+                }
+                detail::dispatchExecuteBlock(kernel, instructions, registers.data());
+                for (uint64_t function = 0; function < functionRegisters.size(); ++function) {
+                    double const* functionRegister = registers.data() + functionRegisters[function] * batchBlockSize;
+                    std::copy(functionRegister, functionRegister + (blockEnd - blockStart), results + function * numberOfValuations + blockStart);
+                }
+            }
+        }
+
+        uint32_t CompiledRationalFunctions::getVariableRegister(VariableType const& variable) {
+            auto variableIt = variableIndices.find(variable);
+            if (variableIt != variableIndices.end()) {
+                return variableRegisters[variableIt->second];
+            }
+            STORM_LOG_THROW(initialRegisters.size() < std::numeric_limits<uint32_t>::max(), storm::exceptions::NotSupportedException, "Too many registers.");
+            uint32_t result = initialRegisters.size();
+            initialRegisters.push_back(storm::utility::zero<double>());
+            registerInstructions.push_back(-1);
+            variableIndices.emplace(variable, variables.size());
+            variables.push_back(variable);
+            variableRegisters.push_back(result);
+            return result;
+        }
+
+        uint32_t CompiledRationalFunctions::getConstantRegister(double value) {
+            auto constantIt = constantRegisters.find(value);
+            if (constantIt != constantRegisters.end()) {
+                return constantIt->second;
+            }
+            STORM_LOG_THROW(initialRegisters.size() < std::numeric_limits<uint32_t>::max(), storm::exceptions::NotSupportedException, "Too many registers.");
+            uint32_t result = initialRegisters.size();
+            initialRegisters.push_back(value);
+            registerInstructions.push_back(-1);
+            constantRegisters.emplace(value, result);
+            return result;
+        }
+
+        uint32_t CompiledRationalFunctions::getInstructionRegister(OpCode opCode, uint32_t left, uint32_t right) {
+            if ((opCode == OpCode::Add || opCode == OpCode::Multiply) && right < left) {
+                std::swap(left, right);
+            }
+            auto key = std::make_tuple(opCode, left, right);
+            auto instructionIt = instructionRegisters.find(key);
+            if (instructionIt != instructionRegisters.end()) {
+                return instructionIt->second;
+            }
+            STORM_LOG_THROW(initialRegisters.size() < std::numeric_limits<uint32_t>::max(), storm::exceptions::NotSupportedException, "Too many registers.");
+            uint32_t result = initialRegisters.size();
+            initialRegisters.push_back(storm::utility::zero<double>());
+            registerInstructions.push_back(instructions.size());
+            instructions.push_back(Instruction{opCode, result, left, right});
+            instructionRegisters.emplace(key, result);
+            return result;
+        }
+
+        uint32_t CompiledRationalFunctions::getPowerRegister(VariableType const& variable, uint64_t exponent) {
+            STORM_LOG_ASSERT(exponent > 0, "Unexpected exponent.");
+            if (exponent == 1) {
+                return getVariableRegister(variable);
+            }
+            // Compute the power by repeated squaring. As the instructions are cached, lower powers are shared.
+            uint32_t halfPower = getPowerRegister(variable, exponent / 2);
+            uint32_t result = getInstructionRegister(OpCode::Multiply, halfPower, halfPower);
+            if (exponent % 2 == 1) {
+                result = getInstructionRegister(OpCode::Multiply, result, getVariableRegister(variable));
+            }
+            return result;
+        }
+
+        uint32_t CompiledRationalFunctions::getPolynomialRegister(storm::RawPolynomial const& polynomial) {
+            auto polynomialIt = polynomialRegisters.find(polynomial);
+            if (polynomialIt != polynomialRegisters.end()) {
+                return polynomialIt->second;
+            }
+
+            bool first = true;
+            uint32_t result = 0;
+            for (auto const& term : polynomial) {
+                double coefficient = storm::utility::convertNumber<double>(term.coeff());
+                // Negative coefficients (except for the first term) are subtracted to avoid storing both signs of a constant.
+                bool subtract = !first && coefficient < 0;
+                if (subtract) {
+                    coefficient = -coefficient;
+                }
+
+                uint32_t termRegister = 0;
+                if (term.isConstant()) {
+                    termRegister = getConstantRegister(coefficient);
+                } else {
+                    // Multiply the powers of the variables from left to right, such that monomials share their prefixes.
+                    bool firstFactor = true;
+                    for (auto const& variableWithExponent : *term.monomial()) {
+                        uint32_t power = getPowerRegister(variableWithExponent.first, variableWithExponent.second);
+                        termRegister = firstFactor ? power : getInstructionRegister(OpCode::Multiply, termRegister, power);
+                        firstFactor = false;
+                    }
+                    if (coefficient != storm::utility::one<double>()) {
+                        termRegister = getInstructionRegister(OpCode::Multiply, getConstantRegister(coefficient), termRegister);
+                    }
+                }
+
+                if (first) {
+                    result = termRegister;
+                } else {
+                    result = getInstructionRegister(subtract ? OpCode::Subtract : OpCode::Add, result, termRegister);
+                }
+                first = false;
+            }
+            if (first) {
+                // The polynomial is zero.
+                result = getConstantRegister(storm::utility::zero<double>());
+            }
+            polynomialRegisters.emplace(polynomial, result);
+            return result;
+        }
+
+        std::vector<uint32_t> CompiledRationalFunctions::getDependencies(uint32_t targetRegister) const {
+            std::vector<uint32_t> result;
+            std::unordered_set<uint32_t> isDependency;
+            std::vector<uint32_t> stack = {targetRegister};
+            while (!stack.empty()) {
+                uint32_t reg = stack.back();
+                stack.pop_back();
+                int64_t instructionIndex = registerInstructions[reg];
+                if (instructionIndex >= 0 && isDependency.insert(instructionIndex).second) {
+                    result.push_back(instructionIndex);
+                    stack.push_back(instructions[instructionIndex].left);
+                    stack.push_back(instructions[instructionIndex].right);
+                }
+            }
+
+            // The operands of an instruction are computed by instructions with a smaller index.
+            std::sort(result.begin(), result.end());
+            return result;
+        }
+
+    }
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "storm-pars/utility/parametric.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+namespace storm {
+    namespace utility {
+
+        /*!
+         * This class compiles a set of rational functions into a straight-line program that evaluates them in double
+         * precision. The program consists of additions, subtractions, multiplications and divisions whose operands are
+         * variables, constants or results of previous instructions. Common subterms, i.e., powers of variables,
+         * monomials, polynomials and functions that occur several times, are computed only once.
+         *
+         * Compared to evaluating the functions with carl, this avoids the exact arithmetic and the traversal of the
+         * polynomial data structures. Note that the results may differ from the (rounded) exact results due to the
+         * floating point arithmetic.
+         */
+        class CompiledRationalFunctions {
+        public:
+            typedef storm::RationalFunctionVariable VariableType;
+
+            CompiledRationalFunctions() = default;
+
+            /*!
+             * Adds the given function to the program.
+             *
+             * @return The index of the function. Adding the same function twice yields the same index.
+             */
+            uint64_t addFunction(storm::RationalFunction const& function);
+
+            uint64_t getNumberOfFunctions() const;
+            uint64_t getNumberOfInstructions() const;
+
+            /*!
+             * Retrieves the variables occurring in the added functions. The values of the variables are passed to the
+             * evaluation methods in this order.
+             */
+            std::vector<VariableType> const& getVariables() const;
+
+            /*!
+             * Retrieves the index of the given variable in getVariables().
+             */
+            uint64_t getVariableIndex(VariableType const& variable) const;
+
+            /*!
+             * Converts the given valuation to the values of the variables in the order of getVariables().
+             * The valuation has to assign a value to every variable of the program.
+             */
+            std::vector<double> getVariableValues(storm::utility::parametric::Valuation<storm::RationalFunction> const& valuation) const;
+
+            /*!
+             * Creates the registers that the evaluation of a single valuation works on. The registers can be reused for
+             * many evaluations, but they must not be shared by concurrent evaluations.
+             */
+            std::vector<double> createRegisters() const;
+
+            /*!
+             * Evaluates all functions for the given values of the variables.
+             *
+             * @param variableValues The values of the variables in the order of getVariables().
+             * @param registers The registers obtained via createRegisters().
+             * @param results The results, where the result of the function with index i is written to results[i].
+             */
+            void evaluate(double const* variableValues, std::vector<double>& registers, double* results) const;
+
+            /*!
+             * Evaluates the function with the given index for the given values of the variables. Only the instructions
+             * on which the function depends are executed. These are determined on the first evaluation of the function.
+             *
+             * @param variableValues The values of the variables in the order of getVariables(). Only the values of the
+             * variables occurring in the function are read.
+             * @param registers The registers obtained via createRegisters().
+             */
+            double evaluate(uint64_t function, double const* variableValues, std::vector<double>& registers) const;
+
+            /*!
+             * Evaluates all functions for several valuations at once. The valuations are processed in blocks, where the
+             * instructions are applied to all valuations of a block with vector instructions (if available).
+             *
+             * @param numberOfValuations The number of valuations.
+             * @param variableValues The values of the variables, where the value of the variable with index v in the
+             * valuation with index i is variableValues[v * numberOfValuations + i].
+             * @param results The results, where the result of the function with index f for the valuation with index i
+             * is written to results[f * numberOfValuations + i].
+             */
+            void evaluateBatch(uint64_t numberOfValuations, double const* variableValues, double* results) const;
+
+            // The number of valuations that evaluateBatch processes together.
+            static const uint64_t batchBlockSize = 8;
+
+        private:
+            enum class OpCode : uint8_t { Add, Subtract, Multiply, Divide };
+
+            struct Instruction {
+                OpCode opCode;
+                uint32_t result;
+                uint32_t left;
+                uint32_t right;
+            };
+
+            uint32_t getVariableRegister(VariableType const& variable);
+            uint32_t getConstantRegister(double value);
+            uint32_t getInstructionRegister(OpCode opCode, uint32_t left, uint32_t right);
+            uint32_t getPowerRegister(VariableType const& variable, uint64_t exponent);
+            uint32_t getPolynomialRegister(storm::RawPolynomial const& polynomial);
+
+            /*!
+             * Computes the indices of the instructions that the given register depends on (in the order of execution).
+             */
+            std::vector<uint32_t> getDependencies(uint32_t targetRegister) const;
+
+            // The instructions in the order of their execution. The operands of an instruction are always computed
+            // before the instruction itself.
+            std::vector<Instruction> instructions;
+
+            // For every register, the index of the instruction that computes it (or -1 for variables and constants).
+            std::vector<int64_t> registerInstructions;
+
+            // The values of the registers that hold constants (and zero for all other registers).
+            std::vector<double> initialRegisters;
+
+            std::vector<VariableType> variables;
+            std::vector<uint32_t> variableRegisters;
+            std::map<VariableType, uint64_t> variableIndices;
+
+            // For every function, the register holding its result.
+            std::vector<uint32_t> functionRegisters;
+
+            // For every function, the instructions on which it depends. As they are only needed when evaluating single
+            // functions, they are computed on the first such evaluation (which may happen concurrently).
+            mutable std::vector<std::vector<uint32_t>> functionDependencies;
+            mutable std::vector<std::unique_ptr<std::once_flag>> functionDependenciesComputed;
+
+            // Caches to share common subterms.
+            std::unordered_map<storm::RationalFunction, uint64_t> functionIndices;
+            std::unordered_map<storm::RawPolynomial, uint32_t> polynomialRegisters;
+            std::map<double, uint32_t> constantRegisters;
+            std::map<std::tuple<OpCode, uint32_t, uint32_t>, uint32_t> instructionRegisters;
+        };
+
+    }
+}
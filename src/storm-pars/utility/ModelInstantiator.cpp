@@ -5,7 +5,7 @@ namespace storm {
     namespace utility {
         
             template<typename ParametricSparseModelType, typename ConstantSparseModelType>
-            ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::ModelInstantiator(ParametricSparseModelType const& parametricModel){
+            ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::ModelInstantiator(ParametricSparseModelType const& parametricModel, bool compileFunctions){
                 //Now pre-compute the information for the equation system.
                 initializeModelSpecificData(parametricModel);
                 initializeMatrixMapping(this->instantiatedModel->getTransitionMatrix(), this->functions, this->matrixMapping, parametricModel.getTransitionMatrix());
@@ -21,6 +21,17 @@ namespace storm {
                         initializeMatrixMapping(rewModel.second.getTransitionRewardMatrix(), this->functions, this->matrixMapping, parametricModel.getRewardModel(rewModel.first).getTransitionRewardMatrix());
                     }
                 }
+                
+                if (compileFunctions && std::is_same<ConstantType, double>::value) {
+                    compiledFunctions = std::make_unique<CompiledRationalFunctions>();
+                    for (auto& functionResult : this->functions) {
+                        uint64_t functionIndex = compiledFunctions->addFunction(functionResult.first);
+                        STORM_LOG_ASSERT(functionIndex == compiledFunctionPlaceholders.size(), "Unexpected index of compiled function.");
+                        compiledFunctionPlaceholders.push_back(&functionResult.second);
+                    }
+                    compiledFunctionRegisters = compiledFunctions->createRegisters();
+                    compiledFunctionResults.resize(compiledFunctions->getNumberOfFunctions());
+                }
             }
             
             template<typename ParametricSparseModelType, typename ConstantType>
@@ -137,9 +148,17 @@ namespace storm {
             template<typename ParametricSparseModelType, typename ConstantSparseModelType>
             ConstantSparseModelType const& ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiate(storm::utility::parametric::Valuation<ParametricType> const& valuation){
                 //Write results into the placeholders
-                for(auto& functionResult : this->functions){
-                    functionResult.second=storm::utility::convertNumber<ConstantType>(
-                            storm::utility::parametric::evaluate(functionResult.first, valuation));
+                if (compiledFunctions) {
+                    std::vector<double> variableValues = compiledFunctions->getVariableValues(valuation);
+                    compiledFunctions->evaluate(variableValues.data(), compiledFunctionRegisters, compiledFunctionResults.data());
+                    for (uint64_t functionIndex = 0; functionIndex < compiledFunctionPlaceholders.size(); ++functionIndex) {
+                        *compiledFunctionPlaceholders[functionIndex] = storm::utility::convertNumber<ConstantType>(compiledFunctionResults[functionIndex]);
+                    }
+                } else {
+                    for(auto& functionResult : this->functions){
+                        functionResult.second=storm::utility::convertNumber<ConstantType>(
+                                storm::utility::parametric::evaluate(functionResult.first, valuation));
+                    }
                 }
                 
                 //Write the instantiated values to the matrices and vectors according to the stored mappings
@@ -6,6 +6,7 @@
 #include <type_traits>
 
 #include "storm-pars/utility/parametric.h"
+#include "storm-pars/utility/CompiledRationalFunctions.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -21,6 +22,7 @@ namespace storm {
          * This class allows efficient instantiation of the given parametric model.
          * The key to efficiency is to evaluate every distinct transition- (or reward-) function only once
          * instead of evaluating the same function for each occurrence in the model. 
+         * If the model is instantiated with doubles, the functions can be compiled into a straight-line program (see CompiledRationalFunctions).
          */
         template<typename ParametricSparseModelType, typename ConstantSparseModelType>
             class ModelInstantiator {
@@ -33,8 +35,10 @@ namespace storm {
                 /*!
                  * Constructs a ModelInstantiator
                  * @param parametricModel The model that is to be instantiated
+                 * @param compileFunctions If set and the model is instantiated with doubles, the functions are compiled and evaluated in double precision
+                 * instead of evaluating them exactly and rounding the result.
                  */
-                ModelInstantiator(ParametricSparseModelType const& parametricModel);
+                ModelInstantiator(ParametricSparseModelType const& parametricModel, bool compileFunctions = false);
                 
                 /*!
                  * Destructs the ModelInstantiator
@@ -167,6 +171,12 @@ namespace storm {
                 std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>> matrixMapping; 
                 /// Connection of Vector entries with placeholders
                 std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>> vectorMapping; 
+                /// The compiled functions (if enabled)
+                std::unique_ptr<CompiledRationalFunctions> compiledFunctions;
+                /// The placeholders of the compiled functions (in the order of their indices)
+                std::vector<ConstantType*> compiledFunctionPlaceholders;
+                /// Memory for the evaluation of the compiled functions
+                std::vector<double> compiledFunctionRegisters, compiledFunctionResults;
                 
                 
             };
@@ -20,6 +20,10 @@ namespace storm {
             }
             options.setType(type);
             
+            auto const& bisimulationSettings = storm::settings::getModule<storm::settings::modules::BisimulationSettings>();
+            options.refinementMethod = bisimulationSettings.getSparseRefinementMethod();
+            options.numberOfThreads = bisimulationSettings.getNumberOfThreads();
+            
             storm::storage::DeterministicModelBisimulationDecomposition<ModelType> bisimulationDecomposition(*model, options);
             bisimulationDecomposition.computeBisimulationDecomposition();
             return bisimulationDecomposition.getQuotient();
@@ -33,6 +37,10 @@ namespace storm {
             }
             options.setType(type);
             
+            auto const& bisimulationSettings = storm::settings::getModule<storm::settings::modules::BisimulationSettings>();
+            options.refinementMethod = bisimulationSettings.getSparseRefinementMethod();
+            options.numberOfThreads = bisimulationSettings.getNumberOfThreads();
+            
             storm::storage::NondeterministicModelBisimulationDecomposition<ModelType> bisimulationDecomposition(*model, options);
             bisimulationDecomposition.computeBisimulationDecomposition();
             return bisimulationDecomposition.getQuotient();
@@ -2,6 +2,7 @@
 
 #include "storm/parser/AutoParser.h"
 #include "storm/parser/DirectEncodingParser.h"
+#include "storm/parser/BinaryEncodingParser.h"
 #include "storm/parser/ImcaMarkovAutomatonParser.h"
 
 #include "storm/storage/SymbolicModelDescription.h"
@@ -138,6 +139,16 @@ namespace storm {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact models with direct encoding are not supported.");
         }
         
+        template<typename ValueType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitBinaryModel(std::string const&) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact or parametric models in the binary format are not supported.");
+        }
+        
+        template<>
+        inline std::shared_ptr<storm::models::sparse::Model<double>> buildExplicitBinaryModel(std::string const& binaryFile) {
+            return storm::parser::BinaryEncodingParser<double>::parseModel(binaryFile);
+        }
+        
         template<typename ValueType>
         std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitIMCAModel(std::string const&) {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact models with direct encoding are not supported.");
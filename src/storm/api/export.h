@@ -1,5 +1,7 @@
 #pragma once
 
+#include <boost/algorithm/string/predicate.hpp>
+
 #include "storm/storage/jani/JSONExporter.h"
 
 
@@ -7,9 +9,13 @@
 #include "storm/settings/modules/JaniExportSettings.h"
 
 #include "storm/utility/DirectEncodingExporter.h"
+#include "storm/utility/BinaryEncodingExporter.h"
 #include "storm/utility/file.h"
+#include "storm/utility/GzipOutputStream.h"
 #include "storm/utility/macros.h"
 
+#include "storm/exceptions/NotSupportedException.h"
+
 namespace storm {
     namespace api {
         
@@ -18,10 +24,34 @@ namespace storm {
         void exportJaniModelAsDot(storm::jani::Model const& model, std::string const& filename);
 
         template <typename ValueType>
-        void exportSparseModelAsDrn(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename, std::vector<std::string> const& parameterNames) {
+        void exportSparseModelAsDrn(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename, std::vector<std::string> const& parameterNames, uint64_t numberOfThreads = 1) {
             std::ofstream stream;
-            storm::utility::openFile(filename, stream);
-            storm::exporter::explicitExportSparseModel(stream, model, parameterNames);
+            if (boost::algorithm::ends_with(filename, ".gz")) {
+                stream.open(filename, std::ios::out | std::ios::binary);
+                STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+                STORM_PRINT_AND_LOG("Write to file " << filename << "." << std::endl);
+                storm::utility::GzipOutputStream compressedStream(stream);
+                storm::exporter::explicitExportSparseModel(compressedStream, model, parameterNames, numberOfThreads);
+                compressedStream.finish();
+            } else {
+                storm::utility::openFile(filename, stream);
+                storm::exporter::explicitExportSparseModel(stream, model, parameterNames, numberOfThreads);
+            }
+            STORM_LOG_THROW(stream.good(), storm::exceptions::FileIoException, "Writing to file " << filename << " failed.");
+            storm::utility::closeFile(stream);
+        }
+        
+        template <typename ValueType>
+        void exportSparseModelAsBinary(std::shared_ptr<storm::models::sparse::Model<ValueType>> const&, std::string const&) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact or parametric models can not be exported in the binary format.");
+        }
+        
+        template <>
+        inline void exportSparseModelAsBinary(std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::string const& filename) {
+            std::ofstream stream(filename, std::ios::out | std::ios::binary);
+            STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+            STORM_PRINT_AND_LOG("Write to file " << filename << "." << std::endl);
+            storm::exporter::binaryExportSparseModel(stream, model);
             storm::utility::closeFile(stream);
         }
         
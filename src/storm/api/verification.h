@@ -1,5 +1,6 @@
 #pragma once
 
+#include <map>
 #include <type_traits>
 
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
@@ -22,6 +23,8 @@
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 
+#include "storm/environment/Environment.h"
+
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/EliminationSettings.h"
 
@@ -141,10 +144,59 @@ namespace storm {
             return result;
         }
         
+        /*!
+         * Retrieves whether the given formula is a time-bounded reachability probability P=? [phi U[a,b] psi] that can
+         * be checked together with others by verifyTimeBoundedReachabilityWithSparseEngine.
+         */
+        inline bool isBatchableTimeBoundedReachabilityFormula(storm::logic::Formula const& formula) {
+            if (!formula.isProbabilityOperatorFormula() || formula.asProbabilityOperatorFormula().hasBound()) {
+                return false;
+            }
+            storm::logic::Formula const& subformula = formula.asProbabilityOperatorFormula().getSubformula();
+            return subformula.isBoundedUntilFormula() && !subformula.asBoundedUntilFormula().isMultiDimensional() && subformula.asBoundedUntilFormula().getTimeBoundReference().isTimeBound();
+        }
+        
+        /*!
+         * Checks the given time-bounded reachability probabilities on the CTMC. Formulas that share their left and right
+         * subformulas (e.g. the same reachability property for several time points) are checked with one batched
+         * transient analysis.
+         *
+         * @param formulas The formulas to check, all of which need to satisfy isBatchableTimeBoundedReachabilityFormula.
+         * @return The results for all states, in the order of the formulas.
+         */
+        template<typename ValueType>
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> verifyTimeBoundedReachabilityWithSparseEngine(std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmc, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+            // Group the formulas by their subformulas.
+            std::map<std::string, std::vector<uint64_t>> formulasBySubformulas;
+            for (uint64_t index = 0; index < formulas.size(); ++index) {
+                STORM_LOG_THROW(isBatchableTimeBoundedReachabilityFormula(*formulas[index]), storm::exceptions::NotSupportedException, "The formula " << *formulas[index] << " is not a time-bounded reachability probability.");
+                storm::logic::BoundedUntilFormula const& pathFormula = formulas[index]->asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula();
+                formulasBySubformulas[pathFormula.getLeftSubformula().toString() + " U " + pathFormula.getRightSubformula().toString()].push_back(index);
+            }
+            
+            storm::Environment env;
+            storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<ValueType>> modelchecker(*ctmc);
+            std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results(formulas.size());
+            for (auto const& group : formulasBySubformulas) {
+                std::vector<storm::modelchecker::CheckTask<storm::logic::BoundedUntilFormula, ValueType>> tasks;
+                for (auto const& index : group.second) {
+                    tasks.emplace_back(formulas[index]->asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula());
+                }
+                std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> groupResults = modelchecker.computeBatchedBoundedUntilProbabilities(env, tasks);
+                for (uint64_t position = 0; position < group.second.size(); ++position) {
+                    results[group.second[position]] = std::move(groupResults[position]);
+                }
+            }
+            return results;
+        }
+        
         template<typename ValueType>
-        typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+        typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::shared_ptr<storm::modelchecker::ExplicitModelCheckerHintCache<ValueType>> const& hintCache = nullptr) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
             storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>> modelchecker(*mdp);
+            if (hintCache) {
+                modelchecker.setHintCache(hintCache);
+            }
             if (modelchecker.canHandle(task)) {
                 result = modelchecker.check(task);
             }
@@ -152,7 +204,7 @@ namespace storm {
         }
         
         template<typename ValueType>
-        typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&) {
+        typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&, std::shared_ptr<storm::modelchecker::ExplicitModelCheckerHintCache<ValueType>> const& = nullptr) {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Sparse engine cannot verify MDPs with this data type.");
         }
         
@@ -179,12 +231,12 @@ namespace storm {
         }
         
         template<typename ValueType>
-        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::shared_ptr<storm::modelchecker::ExplicitModelCheckerHintCache<ValueType>> const& hintCache = nullptr) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
             if (model->getType() == storm::models::ModelType::Dtmc) {
                 result = verifyWithSparseEngine(model->template as<storm::models::sparse::Dtmc<ValueType>>(), task);
             } else if (model->getType() == storm::models::ModelType::Mdp) {
-                result = verifyWithSparseEngine(model->template as<storm::models::sparse::Mdp<ValueType>>(), task);
+                result = verifyWithSparseEngine(model->template as<storm::models::sparse::Mdp<ValueType>>(), task, hintCache);
             } else if (model->getType() == storm::models::ModelType::Ctmc) {
                 result = verifyWithSparseEngine(model->template as<storm::models::sparse::Ctmc<ValueType>>(), task);
             } else if (model->getType() == storm::models::ModelType::MarkovAutomaton) {
@@ -1,6 +1,12 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
 #include <map>
+#include <algorithm>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <exception>
+#include <type_traits>
 
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -13,6 +19,8 @@
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/BuildSettings.h"
 
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
 #include "storm/builder/RewardModelBuilder.h"
 #include "storm/builder/ChoiceInformationBuilder.h"
 
@@ -43,7 +51,7 @@ namespace storm {
     namespace builder {
                         
         template <typename ValueType, typename RewardModelType, typename StateType>
-        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()) {
+        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()), numberOfThreads(storm::settings::getModule<storm::settings::modules::BuildSettings>().getNumberOfBuildThreads()) {
             // Intentionally left empty.
         }
         
@@ -54,12 +62,16 @@ namespace storm {
         
         template <typename ValueType, typename RewardModelType, typename StateType>
         ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(storm::prism::Program const& program, storm::generator::NextStateGeneratorOptions const& generatorOptions, Options const& builderOptions) : ExplicitModelBuilder(std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions), builderOptions) {
-            // Intentionally left empty.
+            if (this->getNumberOfExplorationThreads() > 1) {
+                generatorFactory = [program, generatorOptions] () { return std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions); };
+            }
         }
         
         template <typename ValueType, typename RewardModelType, typename StateType>
         ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(storm::jani::Model const& model, storm::generator::NextStateGeneratorOptions const& generatorOptions, Options const& builderOptions) : ExplicitModelBuilder(std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions), builderOptions) {
-            // Intentionally left empty.
+            if (this->getNumberOfExplorationThreads() > 1) {
+                generatorFactory = [model, generatorOptions] () { return std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions); };
+            }
         }
         
         template <typename ValueType, typename RewardModelType, typename StateType>
@@ -138,6 +150,21 @@ namespace storm {
             uint64_t numberOfExploredStates = 0;
             uint64_t numberOfExploredStatesSinceLastMessage = 0;
             
+            // If requested and possible, explore the model in parallel.
+            uint64_t numberOfThreads = this->getNumberOfExplorationThreads();
+            if (numberOfThreads > 1 && (!generatorFactory || options.explorationOrder != ExplorationOrder::Bfs)) {
+                STORM_LOG_WARN("Parallel exploration requires breadth-first exploration of a PRISM program or JANI model. Falling back to sequential exploration.");
+                numberOfThreads = 1;
+            }
+            if (numberOfThreads > 1 && !std::is_same<ValueType, double>::value) {
+                // The behaviors of exact and parametric models are computed with carl, which we do not assume to be thread-safe.
+                STORM_LOG_WARN("Parallel exploration is only supported for models with double values. Falling back to sequential exploration.");
+                numberOfThreads = 1;
+            }
+            if (numberOfThreads > 1) {
+                exploreStatesInParallel(numberOfThreads, currentRowGroup, currentRow, transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates);
+            }
+            
             // Perform a search through the model.
             while (!statesToExplore.empty()) {
                 // Get the first state in the queue.
@@ -157,92 +184,7 @@ namespace storm {
                 
                 generator->load(currentState);
                 storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
-                
-                // If there is no behavior, we might have to introduce a self-loop.
-                if (behavior.empty()) {
-                    if (!storm::settings::getModule<storm::settings::modules::CoreSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
-                        // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
-                        if (behavior.wasExpanded()) {
-                            this->stateStorage.deadlockStateIndices.push_back(currentIndex);
-                        }
-                        
-                        if (markovianStates) {
-                            markovianStates.get().grow(currentRowGroup + 1, false);
-                            markovianStates.get().set(currentRowGroup);
-                        }
-                        
-                        if (!generator->isDeterministicModel()) {
-                            transitionMatrixBuilder.newRowGroup(currentRow);
-                        }
-                        
-                        transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
-                        
-                        for (auto& rewardModelBuilder : rewardModelBuilders) {
-                            if (rewardModelBuilder.hasStateRewards()) {
-                                rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
-                            }
-                            
-                            if (rewardModelBuilder.hasStateActionRewards()) {
-                                rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
-                            }
-                        }
-                        
-                        ++currentRow;
-                        ++currentRowGroup;
-                    } else {
-                        STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Error while creating sparse matrix from probabilistic program: found deadlock state (" << generator->toValuation(currentState).toString(true) << "). For fixing these, please provide the appropriate option.");
-                    }
-                } else {
-                    // Add the state rewards to the corresponding reward models.
-                    auto stateRewardIt = behavior.getStateRewards().begin();
-                    for (auto& rewardModelBuilder : rewardModelBuilders) {
-                        if (rewardModelBuilder.hasStateRewards()) {
-                            rewardModelBuilder.addStateReward(*stateRewardIt);
-                        }
-                        ++stateRewardIt;
-                    }
-                    
-                    // If the model is nondeterministic, we need to open a row group.
-                    if (!generator->isDeterministicModel()) {
-                        transitionMatrixBuilder.newRowGroup(currentRow);
-                    }
-                    
-                    // Now add all choices.
-                    for (auto const& choice : behavior) {
-                        
-                        // add the generated choice information
-                        if (choice.hasLabels()) {
-                            for (auto const& label : choice.getLabels()) {
-                                choiceInformationBuilder.addLabel(label, currentRow);
-                            }
-                        }
-                        if (choice.hasOriginData()) {
-                            choiceInformationBuilder.addOriginData(choice.getOriginData(), currentRow);
-                        }
-                        
-                        // If we keep track of the Markovian choices, store whether the current one is Markovian.
-                        if (markovianStates && choice.isMarkovian()) {
-                            markovianStates.get().grow(currentRowGroup + 1, false);
-                            markovianStates.get().set(currentRowGroup);
-                        }
-                        
-                        // Add the probabilistic behavior to the matrix.
-                        for (auto const& stateProbabilityPair : choice) {
-                            transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
-                        }
-                        
-                        // Add the rewards to the reward models.
-                        auto choiceRewardIt = choice.getRewards().begin();
-                        for (auto& rewardModelBuilder : rewardModelBuilders) {
-                            if (rewardModelBuilder.hasStateActionRewards()) {
-                                rewardModelBuilder.addStateActionReward(*choiceRewardIt);
-                            }
-                            ++choiceRewardIt;
-                        }
-                        ++currentRow;
-                    }
-                    ++currentRowGroup;
-                }
+                addStateBehavior(currentState, currentIndex, behavior, currentRowGroup, currentRow, transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates);
                 
                 if (generator->getOptions().isShowProgressSet()) {
                     ++numberOfExploredStatesSinceLastMessage;
@@ -290,6 +232,210 @@ namespace storm {
             }
         }
         
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::addStateBehavior(CompressedState const& currentState, StateType currentIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior, uint_fast64_t& currentRowGroup, uint_fast64_t& currentRow, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianStates) {
+            // If there is no behavior, we might have to introduce a self-loop.
+            if (behavior.empty()) {
+                if (!storm::settings::getModule<storm::settings::modules::CoreSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
+                    // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
+                    if (behavior.wasExpanded()) {
+                        this->stateStorage.deadlockStateIndices.push_back(currentIndex);
+                    }
+                    
+                    if (markovianStates) {
+                        markovianStates.get().grow(currentRowGroup + 1, false);
+                        markovianStates.get().set(currentRowGroup);
+                    }
+                    
+                    if (!generator->isDeterministicModel()) {
+                        transitionMatrixBuilder.newRowGroup(currentRow);
+                    }
+                    
+                    transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
+                    
+                    for (auto& rewardModelBuilder : rewardModelBuilders) {
+                        if (rewardModelBuilder.hasStateRewards()) {
+                            rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+                        }
+                        
+                        if (rewardModelBuilder.hasStateActionRewards()) {
+                            rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                        }
+                    }
+                    
+                    ++currentRow;
+                    ++currentRowGroup;
+                } else {
+                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Error while creating sparse matrix from probabilistic program: found deadlock state (" << generator->toValuation(currentState).toString(true) << "). For fixing these, please provide the appropriate option.");
+                }
+            } else {
+                // Add the state rewards to the corresponding reward models.
+                auto stateRewardIt = behavior.getStateRewards().begin();
+                for (auto& rewardModelBuilder : rewardModelBuilders) {
+                    if (rewardModelBuilder.hasStateRewards()) {
+                        rewardModelBuilder.addStateReward(*stateRewardIt);
+                    }
+                    ++stateRewardIt;
+                }
+                
+                // If the model is nondeterministic, we need to open a row group.
+                if (!generator->isDeterministicModel()) {
+                    transitionMatrixBuilder.newRowGroup(currentRow);
+                }
+                
+                // Now add all choices.
+                for (auto const& choice : behavior) {
+                    
+                    // add the generated choice information
+                    if (choice.hasLabels()) {
+                        for (auto const& label : choice.getLabels()) {
+                            choiceInformationBuilder.addLabel(label, currentRow);
+                        }
+                    }
+                    if (choice.hasOriginData()) {
+                        choiceInformationBuilder.addOriginData(choice.getOriginData(), currentRow);
+                    }
+                    
+                    // If we keep track of the Markovian choices, store whether the current one is Markovian.
+                    if (markovianStates && choice.isMarkovian()) {
+                        markovianStates.get().grow(currentRowGroup + 1, false);
+                        markovianStates.get().set(currentRowGroup);
+                    }
+                    
+                    // Add the probabilistic behavior to the matrix.
+                    for (auto const& stateProbabilityPair : choice) {
+                        transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                    }
+                    
+                    // Add the rewards to the reward models.
+                    auto choiceRewardIt = choice.getRewards().begin();
+                    for (auto& rewardModelBuilder : rewardModelBuilders) {
+                        if (rewardModelBuilder.hasStateActionRewards()) {
+                            rewardModelBuilder.addStateActionReward(*choiceRewardIt);
+                        }
+                        ++choiceRewardIt;
+                    }
+                    ++currentRow;
+                }
+                ++currentRowGroup;
+            }
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        uint64_t ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getNumberOfExplorationThreads() const {
+            if (options.numberOfThreads == 0) {
+                return std::max(1u, std::thread::hardware_concurrency());
+            }
+            return options.numberOfThreads;
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::exploreStatesInParallel(uint64_t numberOfThreads, uint_fast64_t& currentRowGroup, uint_fast64_t& currentRow, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianStates) {
+            STORM_LOG_DEBUG("Exploring state space using " << numberOfThreads << " threads.");
+            
+            // Every thread gets its own generator, because generators carry the state that is currently expanded.
+            std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> generators;
+            generators.push_back(generator);
+            for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+                generators.push_back(generatorFactory());
+            }
+            
+            // The threads share a concurrent state storage that assigns consecutive indices in the order in which the
+            // states are discovered. Since the exploration is breadth-first, the states that still need to be explored
+            // are exactly the ones whose indices exceed the ones of the states explored so far. We start by inserting
+            // the states that were already found (i.e. the initial states) in the order of their indices.
+            storm::storage::ConcurrentBitVectorHashMap<StateType> concurrentStateToId(stateStorage.bitsPerState, 100000);
+            STORM_LOG_ASSERT(statesToExplore.size() == stateStorage.getNumberOfStates(), "Expected all known states to be unexplored.");
+            for (auto const& stateIndexPair : statesToExplore) {
+                STORM_LOG_ASSERT(concurrentStateToId.size() == stateIndexPair.second, "Expected states to be ordered by their indices.");
+                concurrentStateToId.findOrAdd(stateIndexPair.first);
+            }
+            statesToExplore.clear();
+            std::function<StateType (CompressedState const&)> stateToIdCallback = [&concurrentStateToId] (CompressedState const& state) {
+                return concurrentStateToId.findOrAdd(state).first;
+            };
+            
+            // The number of states a thread claims at once and the maximal number of states in one batch.
+            uint64_t const chunkSize = 64;
+            uint64_t const maximalBatchSize = numberOfThreads * 4096;
+            
+            auto timeOfStart = std::chrono::high_resolution_clock::now();
+            auto timeOfLastMessage = std::chrono::high_resolution_clock::now();
+            uint64_t numberOfExploredStatesAtLastMessage = currentRowGroup;
+            
+            std::vector<CompressedState> batch;
+            std::vector<storm::generator::StateBehavior<ValueType, StateType>> behaviors;
+            while (currentRowGroup < concurrentStateToId.size()) {
+                // Since no thread is running at this point, the keys of all states are available.
+                uint64_t batchStart = currentRowGroup;
+                uint64_t batchSize = std::min<uint64_t>(concurrentStateToId.size() - batchStart, maximalBatchSize);
+                batch.clear();
+                for (uint64_t index = batchStart; index < batchStart + batchSize; ++index) {
+                    batch.push_back(concurrentStateToId.getKey(static_cast<StateType>(index)));
+                }
+                behaviors.clear();
+                behaviors.resize(batchSize);
+                
+                // Expand the states of the batch concurrently.
+                std::atomic<uint64_t> nextChunk(0);
+                std::exception_ptr workerException;
+                std::mutex workerExceptionMutex;
+                auto expandStates = [&] (uint64_t thread) {
+                    try {
+                        auto& threadGenerator = *generators[thread];
+                        for (uint64_t chunkStart = nextChunk.fetch_add(chunkSize); chunkStart < batchSize; chunkStart = nextChunk.fetch_add(chunkSize)) {
+                            uint64_t chunkEnd = std::min(chunkStart + chunkSize, batchSize);
+                            for (uint64_t index = chunkStart; index < chunkEnd; ++index) {
+                                threadGenerator.load(batch[index]);
+                                behaviors[index] = threadGenerator.expand(stateToIdCallback);
+                            }
+                        }
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(workerExceptionMutex);
+                        if (!workerException) {
+                            workerException = std::current_exception();
+                        }
+                    }
+                };
+                
+                // Only use as many threads as there are chunks to expand.
+                uint64_t numberOfWorkers = std::min(numberOfThreads, (batchSize + chunkSize - 1) / chunkSize);
+                std::vector<std::thread> workers;
+                for (uint64_t thread = 1; thread < numberOfWorkers; ++thread) {
+                    workers.emplace_back(expandStates, thread);
+                }
+                expandStates(0);
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+                if (workerException) {
+                    std::rethrow_exception(workerException);
+                }
+                
+                // Add the behaviors in the order of the state indices.
+                for (uint64_t index = 0; index < batchSize; ++index) {
+                    addStateBehavior(batch[index], static_cast<StateType>(batchStart + index), behaviors[index], currentRowGroup, currentRow, transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates);
+                }
+                
+                if (generator->getOptions().isShowProgressSet()) {
+                    auto now = std::chrono::high_resolution_clock::now();
+                    auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
+                    if (static_cast<uint64_t>(durationSinceLastMessage) >= generator->getOptions().getShowProgressDelay()) {
+                        auto statesPerSecond = (currentRowGroup - numberOfExploredStatesAtLastMessage) / std::max<uint64_t>(durationSinceLastMessage, 1);
+                        auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfStart).count();
+                        std::cout << "Explored " << currentRowGroup << " states in " << durationSinceStart << " seconds (currently " << statesPerSecond << " states per second)." << std::endl;
+                        timeOfLastMessage = std::chrono::high_resolution_clock::now();
+                        numberOfExploredStatesAtLastMessage = currentRowGroup;
+                    }
+                }
+            }
+            
+            // Finally, transfer the states to the (sequential) state storage that is used by the remaining steps.
+            for (auto const& stateIndexPair : concurrentStateToId) {
+                stateStorage.stateToId.findOrAdd(stateIndexPair.first, stateIndexPair.second);
+            }
+        }
+        
         template <typename ValueType, typename RewardModelType, typename StateType>
         storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildModelComponents() {
             
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 #include <deque>
+#include <functional>
 #include <cstdint>
 #include <boost/functional/hash.hpp>
 #include <boost/container/flat_set.hpp>
@@ -58,6 +59,9 @@ namespace storm {
                 
                 // The order in which to explore the model.
                 ExplorationOrder explorationOrder;
+                
+                // The number of threads used to explore the model (where 0 means that it is detected automatically).
+                uint64_t numberOfThreads;
             };
             
             /*!
@@ -102,6 +106,35 @@ namespace storm {
              */
             StateType getOrAddStateIndex(CompressedState const& state);
     
+            /*!
+             * Adds the given behavior of the state with the given index to the component builders. The behavior is
+             * added as the next row group.
+             *
+             * @param state The state whose behavior is added.
+             * @param stateIndex The index of the state whose behavior is added.
+             * @param behavior The behavior of the state.
+             * @param currentRowGroup The index of the next row group. This is increased by the method.
+             * @param currentRow The index of the next row. This is increased by the method.
+             */
+            void addStateBehavior(CompressedState const& state, StateType stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior, uint_fast64_t& currentRowGroup, uint_fast64_t& currentRow, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianStates);
+            
+            /*!
+             * Retrieves the number of threads that are to be used for exploring the state space. If the exploration
+             * cannot be performed in parallel, this is one.
+             */
+            uint64_t getNumberOfExplorationThreads() const;
+            
+            /*!
+             * Explores the states that are currently waiting to be explored (and all states reachable from them) using
+             * multiple threads, each of which uses its own next-state generator. The threads share a concurrent state
+             * storage. The states are expanded in batches and the behaviors of a batch are added to the component
+             * builders in the order of the state indices, so the row groups coincide with the state indices. Only
+             * breadth-first exploration is supported.
+             *
+             * @param numberOfThreads The number of threads to use.
+             */
+            void exploreStatesInParallel(uint64_t numberOfThreads, uint_fast64_t& currentRowGroup, uint_fast64_t& currentRow, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianStates);
+            
             /*!
              * Builds the transition matrix and the transition reward matrix based for the given program.
              *
@@ -129,6 +162,10 @@ namespace storm {
             /// The generator to use for the building process.
             std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
             
+            /// A function that creates additional generators for the input model (if available). These are used by
+            /// the worker threads of a parallel exploration.
+            std::function<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>()> generatorFactory;
+            
             /// The options to be used for the building process.
             Options options;
 
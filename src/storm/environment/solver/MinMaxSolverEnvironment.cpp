@@ -17,6 +17,8 @@ namespace storm {
         considerRelativeTerminationCriterion = minMaxSettings.getConvergenceCriterion() == storm::settings::modules::MinMaxEquationSolverSettings::ConvergenceCriterion::Relative;
         STORM_LOG_ASSERT(considerRelativeTerminationCriterion || minMaxSettings.getConvergenceCriterion() == storm::settings::modules::MinMaxEquationSolverSettings::ConvergenceCriterion::Absolute, "Unknown convergence criterion");
         multiplicationStyle = minMaxSettings.getValueIterationMultiplicationStyle();
+        numberOfThreads = minMaxSettings.getNumberOfValueIterationThreads();
+        valueIterationArithmetic = minMaxSettings.getValueIterationArithmetic();
     }
 
     MinMaxSolverEnvironment::~MinMaxSolverEnvironment() {
@@ -69,6 +71,22 @@ namespace storm {
         multiplicationStyle = value;
     }
     
+    uint64_t const& MinMaxSolverEnvironment::getNumberOfThreads() const {
+        return numberOfThreads;
+    }
+    
+    void MinMaxSolverEnvironment::setNumberOfThreads(uint64_t value) {
+        numberOfThreads = value;
+    }
+    
+    storm::solver::ValueIterationArithmetic const& MinMaxSolverEnvironment::getValueIterationArithmetic() const {
+        return valueIterationArithmetic;
+    }
+    
+    void MinMaxSolverEnvironment::setValueIterationArithmetic(storm::solver::ValueIterationArithmetic value) {
+        valueIterationArithmetic = value;
+    }
+    
 
 
 }
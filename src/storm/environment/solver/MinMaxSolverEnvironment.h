@@ -5,6 +5,7 @@
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/MultiplicationStyle.h"
+#include "storm/solver/ValueIterationArithmetic.h"
 
 namespace storm {
     
@@ -25,6 +26,10 @@ namespace storm {
         void setRelativeTerminationCriterion(bool value);
         storm::solver::MultiplicationStyle const& getMultiplicationStyle() const;
         void setMultiplicationStyle(storm::solver::MultiplicationStyle value);
+        uint64_t const& getNumberOfThreads() const;
+        void setNumberOfThreads(uint64_t value);
+        storm::solver::ValueIterationArithmetic const& getValueIterationArithmetic() const;
+        void setValueIterationArithmetic(storm::solver::ValueIterationArithmetic value);
         
     private:
         storm::solver::MinMaxMethod minMaxMethod;
@@ -33,6 +38,8 @@ namespace storm {
         storm::RationalNumber precision;
         bool considerRelativeTerminationCriterion;
         storm::solver::MultiplicationStyle multiplicationStyle;
+        uint64_t numberOfThreads;
+        storm::solver::ValueIterationArithmetic valueIterationArithmetic;
     
     };
 }
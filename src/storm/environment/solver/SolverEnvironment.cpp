@@ -20,6 +20,8 @@ namespace storm {
         forceSoundness = storm::settings::getModule<storm::settings::modules::GeneralSettings>().isSoundSet();
         linearEquationSolverType = storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver();
         linearEquationSolverTypeSetFromDefault = storm::settings::getModule<storm::settings::modules::CoreSettings>().isEquationSolverSetFromDefaultValue();
+        hybridBlockwise = storm::settings::getModule<storm::settings::modules::CoreSettings>().isHybridBlockwiseSet();
+        hybridMaximalBlockSize = storm::settings::getModule<storm::settings::modules::CoreSettings>().getHybridMaximalBlockSize();
     }
     
     SolverEnvironment::~SolverEnvironment() {
@@ -123,6 +125,23 @@ namespace storm {
         native().setRelativeTerminationCriterion(value);
         // Elimination, gmm and eigen solver do not have an option for relative termination criterion
     }
+    
+    bool SolverEnvironment::isHybridBlockwise() const {
+        return hybridBlockwise;
+    }
+    
+    void SolverEnvironment::setHybridBlockwise(bool value) {
+        hybridBlockwise = value;
+    }
+    
+    uint64_t SolverEnvironment::getHybridMaximalBlockSize() const {
+        return hybridMaximalBlockSize;
+    }
+    
+    void SolverEnvironment::setHybridMaximalBlockSize(uint64_t value) {
+        STORM_LOG_THROW(value > 0, storm::exceptions::InvalidEnvironmentException, "The maximal block size must be positive.");
+        hybridMaximalBlockSize = value;
+    }
 
     
 }
@@ -44,6 +44,11 @@ namespace storm {
         boost::optional<storm::RationalNumber> getPrecisionOfCurrentLinearEquationSolver() const;
         void setLinearEquationSolverPrecision(storm::RationalNumber const& value);
         void setLinearEquationSolverRelativeTerminationCriterion(bool value);
+        
+        bool isHybridBlockwise() const;
+        void setHybridBlockwise(bool value);
+        uint64_t getHybridMaximalBlockSize() const;
+        void setHybridMaximalBlockSize(uint64_t value);
     
     private:
         SubEnvironment<EigenSolverEnvironment> eigenSolverEnvironment;
@@ -55,6 +60,8 @@ namespace storm {
         storm::solver::EquationSolverType linearEquationSolverType;
         bool linearEquationSolverTypeSetFromDefault;
         bool forceSoundness;
+        bool hybridBlockwise;
+        uint64_t hybridMaximalBlockSize;
     };
 }
 
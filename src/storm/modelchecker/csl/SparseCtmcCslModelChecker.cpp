@@ -76,6 +76,41 @@ namespace storm {
             return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
         }
         
+        template <typename SparseCtmcModelType>
+        std::vector<std::unique_ptr<CheckResult>> SparseCtmcCslModelChecker<SparseCtmcModelType>::computeBatchedBoundedUntilProbabilities(Environment const& env, std::vector<CheckTask<storm::logic::BoundedUntilFormula, ValueType>> const& checkTasks) {
+            STORM_LOG_THROW(!checkTasks.empty(), storm::exceptions::InvalidPropertyException, "Expected at least one time-bounded until formula.");
+            storm::logic::BoundedUntilFormula const& firstFormula = checkTasks.front().getFormula();
+            std::unique_ptr<CheckResult> leftResultPointer = this->check(env, firstFormula.getLeftSubformula());
+            std::unique_ptr<CheckResult> rightResultPointer = this->check(env, firstFormula.getRightSubformula());
+            ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
+            ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
+
+            std::vector<std::pair<double, double>> timeBounds;
+            bool qualitative = true;
+            for (auto const& checkTask : checkTasks) {
+                storm::logic::BoundedUntilFormula const& pathFormula = checkTask.getFormula();
+                STORM_LOG_THROW(!pathFormula.isMultiDimensional() && pathFormula.getTimeBoundReference().isTimeBound(), storm::exceptions::NotImplementedException, "Currently step-bounded or reward-bounded properties on CTMCs are not supported.");
+                STORM_LOG_ASSERT(pathFormula.getLeftSubformula().toString() == firstFormula.getLeftSubformula().toString() && pathFormula.getRightSubformula().toString() == firstFormula.getRightSubformula().toString(), "The batched formulas have different subformulas.");
+                double lowerBound = pathFormula.hasLowerBound() ? pathFormula.getLowerBound<double>() : 0.0;
+                double upperBound = pathFormula.hasUpperBound() ? pathFormula.getNonStrictUpperBound<double>() : storm::utility::infinity<double>();
+                timeBounds.emplace_back(lowerBound, upperBound);
+                qualitative &= checkTask.isQualitativeSet();
+            }
+
+            // The helper yields the values of all time bounds per state, so we split them up into one vector per time bound.
+            std::vector<std::vector<ValueType>> numericResults = storm::modelchecker::helper::SparseCtmcCslHelper::computeBatchedBoundedUntilProbabilities(env, this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), this->getModel().getExitRateVector(), qualitative, timeBounds, *linearEquationSolverFactory);
+            std::vector<std::unique_ptr<CheckResult>> results;
+            for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+                std::vector<ValueType> numericResult;
+                numericResult.reserve(numericResults.size());
+                for (auto const& stateValues : numericResults) {
+                    numericResult.push_back(stateValues[boundIndex]);
+                }
+                results.push_back(std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult))));
+            }
+            return results;
+        }
+        
         template <typename SparseCtmcModelType>
         std::unique_ptr<CheckResult> SparseCtmcCslModelChecker<SparseCtmcModelType>::computeNextProbabilities(Environment const& env, CheckTask<storm::logic::NextFormula, ValueType> const& checkTask) {
             storm::logic::NextFormula const& pathFormula = checkTask.getFormula();
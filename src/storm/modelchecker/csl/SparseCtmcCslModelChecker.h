@@ -1,6 +1,8 @@
 #ifndef STORM_MODELCHECKER_SPARSECTMCCSLMODELCHECKER_H_
 #define STORM_MODELCHECKER_SPARSECTMCCSLMODELCHECKER_H_
 
+#include <vector>
+
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
 
 #include "storm/models/sparse/Ctmc.h"
@@ -35,6 +37,14 @@ namespace storm {
             virtual std::unique_ptr<CheckResult> computeInstantaneousRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::InstantaneousRewardFormula, ValueType> const& checkTask) override;
             virtual std::unique_ptr<CheckResult> computeReachabilityRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) override;
 
+            /*!
+             * Computes the probabilities of several time-bounded until formulas with one batched transient analysis.
+             * All formulas need to have the same left and right subformulas.
+             *
+             * @return The results of the check tasks in the given order.
+             */
+            std::vector<std::unique_ptr<CheckResult>> computeBatchedBoundedUntilProbabilities(Environment const& env, std::vector<CheckTask<storm::logic::BoundedUntilFormula, ValueType>> const& checkTasks);
+
         private:
             template<typename CValueType = ValueType, typename std::enable_if<storm::NumberTraits<CValueType>::SupportsExponential, int>::type = 0>
             bool canHandleImplementation(CheckTask<storm::logic::Formula, CValueType> const& checkTask) const;
@@ -1,5 +1,7 @@
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 
+#include <map>
+
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 
@@ -20,6 +22,7 @@
 #include "storm/utility/numerical.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/FormatUnsupportedBySolverException.h"
@@ -199,6 +202,146 @@ namespace storm {
             std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<ValueType> const&, bool, double, double, storm::solver::LinearEquationSolverFactory<ValueType> const&) {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
             }
+            
+            template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBatchedBoundedUntilProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, std::vector<std::pair<double, double>> const& timeBounds, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, bool detectSteadyState) {
+                
+                uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+                std::vector<std::vector<ValueType>> resultsPerTimeBound(timeBounds.size());
+                
+                storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates);
+                storm::storage::BitVector statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 & ~psiStates;
+                storm::storage::BitVector relevantStates = statesWithProbabilityGreater0 & phiStates;
+                
+                // Sort the time bounds into those whose computations can share the matrix-vector multiplications. The
+                // remaining (cheap or untimed) cases are handled individually.
+                std::vector<uint64_t> intervalBounds;
+                std::vector<uint64_t> pointBounds;
+                for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+                    double lowerBound = timeBounds[boundIndex].first;
+                    double upperBound = timeBounds[boundIndex].second;
+                    STORM_LOG_THROW(lowerBound >= 0 && lowerBound <= upperBound, storm::exceptions::InvalidArgumentException, "Invalid time interval [" << lowerBound << ", " << upperBound << "].");
+                    if (statesWithProbabilityGreater0NonPsi.empty() || storm::utility::isZero(upperBound) || upperBound == storm::utility::infinity<double>()) {
+                        resultsPerTimeBound[boundIndex] = computeBoundedUntilProbabilities(env, storm::solver::SolveGoal<ValueType>(), rateMatrix, backwardTransitions, phiStates, psiStates, exitRates, qualitative, lowerBound, upperBound, linearEquationSolverFactory);
+                    } else if (lowerBound == upperBound) {
+                        pointBounds.push_back(boundIndex);
+                    } else {
+                        intervalBounds.push_back(boundIndex);
+                    }
+                }
+                
+                if (!intervalBounds.empty()) {
+                    // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
+                    ValueType uniformizationRate = storm::utility::zero<ValueType>();
+                    for (auto const& state : statesWithProbabilityGreater0NonPsi) {
+                        uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+                    }
+                    uniformizationRate *= 1.02;
+                    STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+                    
+                    storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+                    
+                    // Compute the vector that is to be added as a compensation for removing the absorbing states.
+                    std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
+                    for (auto& element : b) {
+                        element /= uniformizationRate;
+                    }
+                    
+                    // Compute the transient probabilities of reaching a psi state within t' - t for all intervals [t, t'] at once.
+                    std::vector<ValueType> durations;
+                    for (auto const& boundIndex : intervalBounds) {
+                        durations.push_back(storm::utility::convertNumber<ValueType>(timeBounds[boundIndex].second - timeBounds[boundIndex].first));
+                    }
+                    std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+                    std::vector<std::vector<ValueType>> subresults = computeBatchedTransientProbabilities(env, uniformizedMatrix, &b, durations, uniformizationRate, values, linearEquationSolverFactory, detectSteadyState);
+                    
+                    // For intervals of the form [0, t], these are already the results. Intervals [t, t'] with t != 0 need
+                    // the transient probabilities of being in a state with this probability after t time units. Intervals
+                    // that share the same duration t' - t also share the initial vector of this second phase, so we group
+                    // them by their duration.
+                    std::map<double, std::vector<uint64_t>> secondPhaseBounds;
+                    for (uint64_t index = 0; index < intervalBounds.size(); ++index) {
+                        uint64_t boundIndex = intervalBounds[index];
+                        if (storm::utility::isZero(timeBounds[boundIndex].first)) {
+                            std::vector<ValueType>& result = resultsPerTimeBound[boundIndex];
+                            result = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
+                            storm::utility::vector::setVectorValues(result, statesWithProbabilityGreater0NonPsi, subresults[index]);
+                            storm::utility::vector::setVectorValues(result, psiStates, storm::utility::one<ValueType>());
+                        } else {
+                            secondPhaseBounds[timeBounds[boundIndex].second - timeBounds[boundIndex].first].push_back(index);
+                        }
+                    }
+                    
+                    if (!secondPhaseBounds.empty()) {
+                        // We must re-uniformize the CTMC, so we need to compute the second uniformized matrix.
+                        uniformizationRate = storm::utility::zero<ValueType>();
+                        for (auto const& state : relevantStates) {
+                            uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+                        }
+                        uniformizationRate *= 1.02;
+                        STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+                        uniformizedMatrix = computeUniformizedMatrix(rateMatrix, relevantStates, uniformizationRate, exitRates);
+                        
+                        for (auto const& durationAndIndices : secondPhaseBounds) {
+                            std::vector<ValueType> newSubresult(relevantStates.getNumberOfSetBits());
+                            storm::utility::vector::setVectorValues(newSubresult, statesWithProbabilityGreater0NonPsi % relevantStates, subresults[durationAndIndices.second.front()]);
+                            storm::utility::vector::setVectorValues(newSubresult, psiStates % relevantStates, storm::utility::one<ValueType>());
+                            
+                            std::vector<ValueType> lowerBounds;
+                            for (auto const& index : durationAndIndices.second) {
+                                lowerBounds.push_back(storm::utility::convertNumber<ValueType>(timeBounds[intervalBounds[index]].first));
+                            }
+                            std::vector<std::vector<ValueType>> newSubresults = computeBatchedTransientProbabilities(env, uniformizedMatrix, nullptr, lowerBounds, uniformizationRate, newSubresult, linearEquationSolverFactory, detectSteadyState);
+                            
+                            for (uint64_t index = 0; index < durationAndIndices.second.size(); ++index) {
+                                std::vector<ValueType>& result = resultsPerTimeBound[intervalBounds[durationAndIndices.second[index]]];
+                                result = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
+                                storm::utility::vector::setVectorValues(result, relevantStates, newSubresults[index]);
+                            }
+                        }
+                    }
+                }
+                
+                if (!pointBounds.empty()) {
+                    // All intervals of the form [t, t] start from the indicator vector of the psi states.
+                    std::vector<ValueType> values(statesWithProbabilityGreater0.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+                    storm::utility::vector::setVectorValues(values, psiStates % statesWithProbabilityGreater0, storm::utility::one<ValueType>());
+                    
+                    ValueType uniformizationRate = storm::utility::zero<ValueType>();
+                    for (auto const& state : statesWithProbabilityGreater0) {
+                        uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+                    }
+                    uniformizationRate *= 1.02;
+                    STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+                    storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0, uniformizationRate, exitRates);
+                    
+                    std::vector<ValueType> timePoints;
+                    for (auto const& boundIndex : pointBounds) {
+                        timePoints.push_back(storm::utility::convertNumber<ValueType>(timeBounds[boundIndex].first));
+                    }
+                    std::vector<std::vector<ValueType>> subresults = computeBatchedTransientProbabilities(env, uniformizedMatrix, nullptr, timePoints, uniformizationRate, values, linearEquationSolverFactory, detectSteadyState);
+                    
+                    for (uint64_t index = 0; index < pointBounds.size(); ++index) {
+                        std::vector<ValueType>& result = resultsPerTimeBound[pointBounds[index]];
+                        result = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
+                        storm::utility::vector::setVectorValues(result, statesWithProbabilityGreater0, subresults[index]);
+                    }
+                }
+                
+                // Finally, turn the results into a time series for every state.
+                std::vector<std::vector<ValueType>> result(numberOfStates, std::vector<ValueType>(timeBounds.size()));
+                for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+                    for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+                        result[state][boundIndex] = resultsPerTimeBound[boundIndex][state];
+                    }
+                }
+                return result;
+            }
+            
+            template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBatchedBoundedUntilProbabilities(Environment const&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<ValueType> const&, bool, std::vector<std::pair<double, double>> const&, storm::solver::LinearEquationSolverFactory<ValueType> const&, bool) {
+                STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
+            }
 
             template <typename ValueType>
             std::vector<ValueType> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory) {
@@ -701,6 +844,88 @@ namespace storm {
                 return result;
             }
             
+            template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBatchedTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> values, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, bool detectSteadyState) {
+                ValueType precision = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision() / 8.0;
+                
+                // Use Fox-Glynn to get the truncation points and the weights for every time bound.
+                std::vector<storm::utility::numerical::FoxGlynnResult<ValueType>> foxGlynnResults;
+                std::vector<std::vector<ValueType>> results(timeBounds.size());
+                std::vector<uint64_t> pendingBounds;
+                uint_fast64_t maximalRightTruncationPoint = 0;
+                for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+                    ValueType lambda = timeBounds[boundIndex] * uniformizationRate;
+                    foxGlynnResults.emplace_back();
+                    
+                    // If no time can pass, the current values are the result.
+                    if (storm::utility::isZero(lambda)) {
+                        results[boundIndex] = values;
+                        continue;
+                    }
+                    
+                    auto& foxGlynnResult = foxGlynnResults.back();
+                    foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, precision);
+                    STORM_LOG_DEBUG("Fox-Glynn cutoff points for time bound " << timeBounds[boundIndex] << ": left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
+                    
+                    // Scale the weights so they add up to one.
+                    for (auto& element : foxGlynnResult.weights) {
+                        element /= foxGlynnResult.totalWeight;
+                    }
+                    
+                    results[boundIndex] = std::vector<ValueType>(values.size(), storm::utility::zero<ValueType>());
+                    if (foxGlynnResult.left == 0) {
+                        storm::utility::vector::addScaledVector(results[boundIndex], values, foxGlynnResult.weights.front());
+                    }
+                    maximalRightTruncationPoint = std::max<uint_fast64_t>(maximalRightTruncationPoint, foxGlynnResult.right);
+                    pendingBounds.push_back(boundIndex);
+                }
+                
+                if (pendingBounds.empty()) {
+                    return results;
+                }
+                
+                STORM_LOG_DEBUG("Starting " << maximalRightTruncationPoint << " iterations for " << pendingBounds.size() << " time bounds with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount() << " matrix.");
+                
+                std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, uniformizedMatrix, storm::solver::LinearEquationSolverTask::Multiply);
+                solver->setCachingEnabled(true);
+                
+                // Every iterate is weighted with the Poisson probabilities of all time bounds whose truncation points
+                // enclose the current iteration.
+                std::vector<ValueType> nextValues(values.size());
+                for (uint_fast64_t iteration = 1; iteration <= maximalRightTruncationPoint; ++iteration) {
+                    solver->multiply(values, addVector, nextValues);
+                    bool steadyStateReached = detectSteadyState && storm::utility::vector::equalModuloPrecision(values, nextValues, precision, false);
+                    std::swap(values, nextValues);
+                    
+                    if (steadyStateReached) {
+                        // All further iterates are (up to the precision) equal to the current one, so we add it with the
+                        // remaining weight to the results.
+                        STORM_LOG_INFO("Reached steady state after " << iteration << " of " << maximalRightTruncationPoint << " iterations.");
+                        for (auto const& boundIndex : pendingBounds) {
+                            auto const& foxGlynnResult = foxGlynnResults[boundIndex];
+                            if (iteration > foxGlynnResult.right) {
+                                continue;
+                            }
+                            ValueType remainingWeight = storm::utility::zero<ValueType>();
+                            for (uint_fast64_t index = std::max<uint_fast64_t>(iteration, foxGlynnResult.left); index <= foxGlynnResult.right; ++index) {
+                                remainingWeight += foxGlynnResult.weights[index - foxGlynnResult.left];
+                            }
+                            storm::utility::vector::addScaledVector(results[boundIndex], values, remainingWeight);
+                        }
+                        break;
+                    }
+                    
+                    for (auto const& boundIndex : pendingBounds) {
+                        auto const& foxGlynnResult = foxGlynnResults[boundIndex];
+                        if (foxGlynnResult.left <= iteration && iteration <= foxGlynnResult.right) {
+                            storm::utility::vector::addScaledVector(results[boundIndex], values, foxGlynnResult.weights[iteration - foxGlynnResult.left]);
+                        }
+                    }
+                }
+                
+                return results;
+            }
+            
             template <typename ValueType>
             storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeProbabilityMatrix(storm::storage::SparseMatrix<ValueType> const& rateMatrix, std::vector<ValueType> const& exitRates) {
                 // Turn the rates into probabilities by scaling each row with the exit rate of the state.
@@ -748,13 +973,18 @@ namespace storm {
             
             template std::vector<double> SparseCtmcCslHelper::computeCumulativeRewards(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, std::vector<double> const& exitRateVector, storm::models::sparse::StandardRewardModel<double> const& rewardModel, double timeBound, storm::solver::LinearEquationSolverFactory<double> const& linearEquationSolverFactory);
             
+            template std::vector<std::vector<double>> SparseCtmcCslHelper::computeBatchedBoundedUntilProbabilities(Environment const& env, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, bool qualitative, std::vector<std::pair<double, double>> const& timeBounds, storm::solver::LinearEquationSolverFactory<double> const& linearEquationSolverFactory, bool detectSteadyState);
+            
             template storm::storage::SparseMatrix<double> SparseCtmcCslHelper::computeUniformizedMatrix(storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::BitVector const& maybeStates, double uniformizationRate, std::vector<double> const& exitRates);
             
             template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, double timeBound, double uniformizationRate, std::vector<double> values, storm::solver::LinearEquationSolverFactory<double> const& linearEquationSolverFactory);
+            template std::vector<std::vector<double>> SparseCtmcCslHelper::computeBatchedTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, std::vector<double> const& timeBounds, double uniformizationRate, std::vector<double> values, storm::solver::LinearEquationSolverFactory<double> const& linearEquationSolverFactory, bool detectSteadyState);
 
 #ifdef STORM_HAVE_CARL
             template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, bool qualitative, double lowerBound, double upperBound, storm::solver::LinearEquationSolverFactory<storm::RationalNumber> const& linearEquationSolverFactory);
             template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, bool qualitative, double lowerBound, double upperBound, storm::solver::LinearEquationSolverFactory<storm::RationalFunction> const& linearEquationSolverFactory);
+            template std::vector<std::vector<storm::RationalNumber>> SparseCtmcCslHelper::computeBatchedBoundedUntilProbabilities(Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, bool qualitative, std::vector<std::pair<double, double>> const& timeBounds, storm::solver::LinearEquationSolverFactory<storm::RationalNumber> const& linearEquationSolverFactory, bool detectSteadyState);
+            template std::vector<std::vector<storm::RationalFunction>> SparseCtmcCslHelper::computeBatchedBoundedUntilProbabilities(Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, bool qualitative, std::vector<std::pair<double, double>> const& timeBounds, storm::solver::LinearEquationSolverFactory<storm::RationalFunction> const& linearEquationSolverFactory, bool detectSteadyState);
 
             template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::solver::LinearEquationSolverFactory<storm::RationalNumber> const& linearEquationSolverFactory);
             template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::solver::LinearEquationSolverFactory<storm::RationalFunction> const& linearEquationSolverFactory);
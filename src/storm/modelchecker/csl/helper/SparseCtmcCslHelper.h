@@ -1,6 +1,8 @@
 #ifndef STORM_MODELCHECKER_SPARSE_CTMC_CSL_MODELCHECKER_HELPER_H_
 #define STORM_MODELCHECKER_SPARSE_CTMC_CSL_MODELCHECKER_HELPER_H_
 
+#include <utility>
+
 #include "storm/storage/BitVector.h"
 
 #include "storm/solver/LinearEquationSolver.h"
@@ -24,6 +26,23 @@ namespace storm {
                 template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
                 static std::vector<ValueType> computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound, double upperBound, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory);
                 
+                /*!
+                 * Computes the bounded until probabilities for several time bounds at once. All bounds of the form [0, t]
+                 * (and the first phase of the bounds [t, t']) as well as all bounds of the form [t, t] share the
+                 * matrix-vector multiplications of one uniformization sweep, respectively.
+                 *
+                 * @param timeBounds The time intervals for which to compute the probabilities.
+                 * @param detectSteadyState If set, the sweeps stop as soon as the iterates no longer change (with respect
+                 * to the precision) and use the current iterate for all remaining Poisson weights.
+                 * @return A vector that maps each state to the time series of its probabilities, i.e. the i-th entry of
+                 * the vector of a state is the probability with respect to the i-th time bound.
+                 */
+                template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<std::vector<ValueType>> computeBatchedBoundedUntilProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, std::vector<std::pair<double, double>> const& timeBounds, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, bool detectSteadyState = true);
+
+                template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<std::vector<ValueType>> computeBatchedBoundedUntilProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, std::vector<std::pair<double, double>> const& timeBounds, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, bool detectSteadyState = true);
+
                 template <typename ValueType>
                 static std::vector<ValueType> computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory);
 
@@ -86,6 +105,23 @@ namespace storm {
                 template<typename ValueType, bool useMixedPoissonProbabilities = false, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
                 static std::vector<ValueType> computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate, std::vector<ValueType> values, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory);
                 
+                /*!
+                 * Computes the transient probabilities for several time bounds in one sequence of matrix-vector
+                 * multiplications. The number of multiplications is given by the largest right truncation point.
+                 *
+                 * @param uniformizedMatrix The uniformized transition matrix.
+                 * @param addVector A vector that is added in each step as a possible compensation for removing absorbing states
+                 * with a non-zero initial value. If this is not supposed to be used, it can be set to nullptr.
+                 * @param timeBounds The time bounds to use. They need not be sorted.
+                 * @param uniformizationRate The used uniformization rate.
+                 * @param values A vector mapping each state to an initial probability.
+                 * @param linearEquationSolverFactory The factory to use when instantiating new linear equation solvers.
+                 * @param detectSteadyState If set, the multiplications stop once the iterates have converged.
+                 * @return For each time bound, the vector of transient probabilities.
+                 */
+                template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<std::vector<ValueType>> computeBatchedTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> values, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, bool detectSteadyState = true);
+                
                 /*!
                  * Converts the given rate-matrix into a time-abstract probability matrix.
                  *
@@ -17,6 +17,7 @@
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 #include "storm/utility/graph.h"
+#include "storm/utility/ThreadPool.h"
 
 #include "storm/storage/expressions/Variable.h"
 #include "storm/storage/expressions/Expression.h"
@@ -159,166 +160,62 @@ namespace storm {
             }
 
             template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
-            void SparseMarkovAutomatonCslHelper::calculateVu(Environment const& env, std::vector<std::vector<ValueType>> const& relativeReachability, OptimizationDirection dir,
-                                                             uint64_t k, uint64_t node, uint64_t const kind, ValueType lambda, uint64_t probSize,
-                                                             std::vector<std::vector<std::vector<ValueType>>>& unifVectors, storm::storage::SparseMatrix<ValueType> const& fullTransitionMatrix,
-                                                             storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates,
-                                                             std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> const& solver,
-                                                             storm::utility::numerical::FoxGlynnResult<ValueType> const & poisson, bool cycleFree){
-                if (unifVectors[1][k][node]!=-1){return;} //dynamic programming. avoiding multiple calculation.
-                uint64_t N = unifVectors[1].size()-1;
+            void SparseMarkovAutomatonCslHelper::calculateUnifPlusMarkovianLayer(storm::storage::SparseMatrix<ValueType> const& fullTransitionMatrix, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, ValueType const& goalValue, std::vector<ValueType> const& nextLayer, std::vector<ValueType>& layer, uint64_t firstState, uint64_t lastState) {
                 auto const& rowGroupIndices = fullTransitionMatrix.getRowGroupIndices();
-
-                ValueType res =0;
-                for (uint64_t i = k ; i < N ; i++ ){
-                    if (unifVectors[2][N-1-(i-k)][node]==-1){
-                       calculateUnifPlusVector(env, N-1-(i-k),node,2,lambda,probSize,relativeReachability,dir,unifVectors,fullTransitionMatrix, markovianStates,psiStates,solver, poisson, cycleFree);
-                    }
-                    if (i>=poisson.left && i<=poisson.right){
-                        res+=poisson.weights[i-poisson.left]*unifVectors[2][N-1-(i-k)][node];
+                for (uint64_t state = firstState; state < lastState; ++state) {
+                    if (psiStates[state]) {
+                        layer[state] = goalValue;
+                    } else if (markovianStates[state]) {
+                        // Markovian states have exactly one row, which is uniformized and hence leads to the next layer.
+                        ValueType value = storm::utility::zero<ValueType>();
+                        for (auto const& element : fullTransitionMatrix.getRow(rowGroupIndices[state])) {
+                            value += element.getValue() * nextLayer[element.getColumn()];
+                        }
+                        layer[state] = value;
                     }
                 }
-                unifVectors[1][k][node]=res;
             }
 
-
-
-
-            template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
-            void SparseMarkovAutomatonCslHelper::calculateUnifPlusVector(Environment const& env, uint64_t k, uint64_t node, uint64_t const kind, ValueType lambda, uint64_t probSize,
-                                                                         std::vector<std::vector<ValueType>> const &relativeReachability,
-                                                                         OptimizationDirection dir,
-                                                                         std::vector<std::vector<std::vector<ValueType>>> &unifVectors,
-                                                                         storm::storage::SparseMatrix<ValueType> const &fullTransitionMatrix,
-                                                                         storm::storage::BitVector const &markovianStates,
-                                                                         storm::storage::BitVector const &psiStates,
-                                                                         std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> const &solver,
-                                                                         storm::utility::numerical::FoxGlynnResult<ValueType> const & poisson, bool cycleFree) {
-
-
-                if (unifVectors[kind][k][node]!=-1){
-                    return; //already calculated
-                }
-
-                auto numberOfStates=fullTransitionMatrix.getRowGroupCount();
-                auto numberOfProbStates = numberOfStates - markovianStates.getNumberOfSetBits();
-                uint64_t N = unifVectors[kind].size()-1;
+            template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            void SparseMarkovAutomatonCslHelper::calculateUnifPlusProbabilisticLayer(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& fullTransitionMatrix, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& probabilisticStates, std::vector<uint64_t> const& probabilisticOrder, std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> const& solver, std::vector<ValueType>& b, std::vector<ValueType>& x, std::vector<ValueType>& layer) {
                 auto const& rowGroupIndices = fullTransitionMatrix.getRowGroupIndices();
-                ValueType res;
 
-                // First Case, k==N, independent from kind of state
-                if (k==N){
-                    unifVectors[kind][k][node]=0;
-                    return;
-                }
-
-                //goal state, independent from kind of state
-                if (psiStates[node]){
-                    if (kind==0){
-                        // Vd
-                        res = storm::utility::zero<ValueType>();
-                        for (uint64_t i = k ; i<N ; i++){
-                            if (i>=poisson.left && i<=poisson.right){
-                                ValueType between = poisson.weights[i-poisson.left];
-                                res+=between;
+                if (solver) {
+                    // Solve the sub-MDP of the probabilistic states, where the Markovian states are absorbing with their
+                    // values in this layer.
+                    uint64_t row = 0;
+                    for (auto state : probabilisticStates) {
+                        for (uint64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice, ++row) {
+                            ValueType value = storm::utility::zero<ValueType>();
+                            for (auto const& element : fullTransitionMatrix.getRow(choice)) {
+                                if (markovianStates[element.getColumn()]) {
+                                    value += element.getValue() * layer[element.getColumn()];
+                                }
                             }
+                            b[row] = value;
                         }
-                        unifVectors[kind][k][node]=res;
-                    } else {
-                        // WU
-                        unifVectors[kind][k][node]=1;
-                    }
-                    return;
-                }
-
-                //markovian non-goal State
-                if (markovianStates[node]){
-                    res = 0;
-                    auto line = fullTransitionMatrix.getRow(rowGroupIndices[node]);
-                    for (auto &element : line){
-                        uint64_t to = element.getColumn();
-                        if (unifVectors[kind][k+1][to]==-1){
-                            calculateUnifPlusVector(env, k+1,to,kind,lambda,probSize,relativeReachability,dir,unifVectors,fullTransitionMatrix,markovianStates,psiStates,solver,  poisson, cycleFree);
-                        }
-                        res+=element.getValue()*unifVectors[kind][k+1][to];
                     }
-                    unifVectors[kind][k][node]=res;
+                    solver->solveEquations(env, dir, x, b);
+                    storm::utility::vector::setVectorValues(layer, probabilisticStates, x);
                     return;
                 }
 
-                //probabilistic non-goal State
-                if (cycleFree) {
-                    //cycle free -- slight ValueIteration
-                    res = -1;
-                    uint64_t rowStart = rowGroupIndices[node];
-                    uint64_t rowEnd = rowGroupIndices[node + 1];
-                    for (uint64_t i = rowStart; i < rowEnd; i++) {
-                        auto line = fullTransitionMatrix.getRow(i);
-                        ValueType between = 0;
-                        for (auto &element: line) {
-                            uint64_t to = element.getColumn();
-                            if (to == node) {
-                                continue;
-                            }
-                            if (unifVectors[kind][k][to] == -1) {
-                                calculateUnifPlusVector(env, k, to, kind, lambda, probSize, relativeReachability, dir,
-                                                        unifVectors, fullTransitionMatrix, markovianStates, psiStates,
-                                                        solver, poisson, cycleFree);
+                // Without cycles, the values of the successors of a probabilistic state are known when it is processed.
+                for (auto state : probabilisticOrder) {
+                    ValueType value = storm::utility::zero<ValueType>();
+                    for (uint64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice) {
+                        ValueType choiceValue = storm::utility::zero<ValueType>();
+                        for (auto const& element : fullTransitionMatrix.getRow(choice)) {
+                            if (element.getColumn() != state) {
+                                choiceValue += element.getValue() * layer[element.getColumn()];
                             }
-                            between += element.getValue() * unifVectors[kind][k][to];
                         }
-                        if (maximize(dir)) {
-                            res = std::max(res, between);
-                        } else {
-                            if (res != -1) {
-                                res = std::min(res, between);
-                            } else {
-                                res = between;
-                            }
+                        if (choice == rowGroupIndices[state] || (maximize(dir) ? choiceValue > value : choiceValue < value)) {
+                            value = choiceValue;
                         }
                     }
-                    unifVectors[kind][k][node] = res;
-                    return;
+                    layer[state] = value;
                 }
-
-                //not cycle free - use solver technique, calling SVI per default
-                //solving all sub-MDP's in one iteration
-                std::vector<ValueType> b(probSize, 0), x(numberOfProbStates,0);
-                //calculate b
-                uint64_t  lineCounter=0;
-                for (int i =0; i<numberOfStates; i++) {
-                    if (markovianStates[i]) {
-                        continue;
-                    }
-                    auto rowStart = rowGroupIndices[i];
-                    auto rowEnd = rowGroupIndices[i + 1];
-                    for (auto j = rowStart; j < rowEnd; j++) {
-                        uint64_t stateCount = 0;
-                        res = 0;
-                        for (auto &element:fullTransitionMatrix.getRow(j)) {
-                            auto to = element.getColumn();
-                            if (!markovianStates[to]) {
-                                continue;
-                            }
-                            if (unifVectors[kind][k][to] == -1) {
-                                calculateUnifPlusVector(env, k, to, kind, lambda, probSize, relativeReachability, dir,
-                                                        unifVectors, fullTransitionMatrix, markovianStates,
-                                                        psiStates, solver,  poisson, cycleFree);
-                            }
-                            res = res + relativeReachability[j][stateCount] * unifVectors[kind][k][to];
-                            stateCount++;
-                        }
-                        b[lineCounter] = res;
-                        lineCounter++;
-                    }
-                }
-                solver->solveEquations(env, dir, x, b);
-
-                for (uint64_t i =0 ; i<numberOfProbStates; i++){
-                    auto trueI = transformIndice(~markovianStates,i);
-                    unifVectors[kind][k][trueI]=x[i];
-                }
-                 //end probabilistic states
             }
 
             template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
@@ -362,7 +259,8 @@ namespace storm {
                                                                             storm::storage::SparseMatrix<ValueType> const &transitionMatrix,
                                                                             storm::storage::BitVector const &markovStates,
                                                                             storm::storage::BitVector const &psiStates,
-                                                                            storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const &minMaxLinearEquationSolverFactory) {
+                                                                            storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const &minMaxLinearEquationSolverFactory,
+                                                                            uint64_t numberOfThreads) {
                 STORM_LOG_TRACE("Using UnifPlus to compute bounded until probabilities.");
 
                 //bitvectors to identify different kind of states
@@ -373,8 +271,6 @@ namespace storm {
                 //searching for SCC on Underlying MDP to decide which algorhitm is applied
                 storm::storage::StronglyConnectedComponentDecomposition<double> sccList(transitionMatrix, probabilisticStates, true, false);
                 bool cycleFree = sccList.size() == 0;
-                //vectors to save calculation
-                std::vector<std::vector<std::vector<ValueType>>> unifVectors{};
 
 
                 //transitions from goalStates will be ignored. still: they are not allowed to be probabilistic!
@@ -410,6 +306,7 @@ namespace storm {
 
                 //(1) define/declare horizon, epsilon, kappa , N, lambda, maxNorm
                 uint64_t numberOfStates = fullTransitionMatrix.getRowGroupCount();
+                uint64_t numberOfProbStates = probabilisticStates.getNumberOfSetBits();
                 double T = boundsPair.second;
                 ValueType kappa = storm::utility::one<ValueType>() / 10; // would be better as option-parameter
                 ValueType epsilon = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision();
@@ -420,28 +317,11 @@ namespace storm {
                 uint64_t N;
                 ValueType maxNorm = storm::utility::zero<ValueType>();
 
-                //calculate relative ReachabilityVectors and create solver - just needed for cycles
-                std::vector<ValueType> in{};
-                std::vector<std::vector<ValueType>> relReachability(transitionMatrix.getRowCount(), in);
-                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver;
-
+                // The unif vectors vd and wu (index 0 and 1 below) are computed independently of each other. For cyclic
+                // probabilistic states, each of them gets its own solver that is reused for all layers (and all lambdas).
+                std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> solvers(2);
+                std::vector<uint64_t> probabilisticOrder;
                 if (!cycleFree) {
-                    //calculate relative reachability
-                    for (uint64_t i = 0; i < numberOfStates; i++) {
-                        if (markovianStates[i]) {
-                            continue;
-                        }
-                        auto from = rowGroupIndices[i];
-                        auto to = rowGroupIndices[i + 1];
-                        for (auto j = from; j < to; j++) {
-                            for (auto &element: fullTransitionMatrix.getRow(j)) {
-                                if (markovianStates[element.getColumn()]) {
-                                    relReachability[j].push_back(element.getValue());
-                                }
-                            }
-                        }
-                    }
-
                     //create equitation solver
                     storm::solver::MinMaxLinearEquationSolverRequirements requirements = minMaxLinearEquationSolverFactory.getRequirements(
                             env, true, dir);
@@ -450,14 +330,49 @@ namespace storm {
                     STORM_LOG_THROW(requirements.empty(), storm::exceptions::UncheckedRequirementException,
                                     "Cannot establish requirements for solver.");
                     if (probSize != 0) {
-                        solver = minMaxLinearEquationSolverFactory.create(env, probMatrix);
-                        solver->setHasUniqueSolution();
-                        solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
-                        solver->setRequirementsChecked();
-                        solver->setCachingEnabled(true);
+                        for (auto& solver : solvers) {
+                            solver = minMaxLinearEquationSolverFactory.create(env, probMatrix);
+                            solver->setHasUniqueSolution();
+                            solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
+                            solver->setRequirementsChecked();
+                            solver->setCachingEnabled(true);
+                        }
+                    }
+                } else {
+                    // Order the probabilistic states such that the probabilistic successors of a state precede the state.
+                    probabilisticOrder.reserve(numberOfProbStates);
+                    storm::storage::BitVector visited(numberOfStates);
+                    std::vector<std::pair<uint64_t, bool>> stack;
+                    for (auto initialState : probabilisticStates) {
+                        stack.emplace_back(initialState, false);
+                        while (!stack.empty()) {
+                            uint64_t state = stack.back().first;
+                            bool expanded = stack.back().second;
+                            stack.pop_back();
+                            if (expanded) {
+                                probabilisticOrder.push_back(state);
+                                continue;
+                            }
+                            if (visited.get(state)) {
+                                continue;
+                            }
+                            visited.set(state);
+                            stack.emplace_back(state, true);
+                            for (auto const& element : fullTransitionMatrix.getRowGroup(state)) {
+                                if (probabilisticStates.get(element.getColumn()) && !visited.get(element.getColumn())) {
+                                    stack.emplace_back(element.getColumn(), false);
+                                }
+                            }
+                        }
                     }
                 }
 
+                // The Markovian states of a layer are split into chunks that are processed concurrently.
+                storm::utility::ThreadPool threadPool(numberOfThreads);
+                uint64_t numberOfChunks = threadPool.getNumberOfThreads() == 1 ? 1 : threadPool.getNumberOfThreads() * 8;
+                uint64_t chunkSize = (numberOfStates + numberOfChunks - 1) / numberOfChunks;
+                std::vector<ValueType> result;
+
                 // while not close enough to precision:
                 do {
                     maxNorm = storm::utility::zero<ValueType>();
@@ -502,34 +417,56 @@ namespace storm {
                         element /= foxGlynnResult.totalWeight;
                     }
 
-                    // (4) define vectors/matrices
-                    std::vector<ValueType> init(numberOfStates, -1);
-                    std::vector<std::vector<ValueType>> v = std::vector<std::vector<ValueType>>(N + 1, init);
-
-                    unifVectors.clear();
-                    unifVectors.push_back(v);
-                    unifVectors.push_back(v);
-                    unifVectors.push_back(v);
+                    // (4) define vectors
+                    // Layer k of the unif vectors only depends on layer k+1, so we only keep these two layers of vd and wu
+                    // (starting with layer N, which is zero). The result vd[0] and the bound vu[0] are obtained from the
+                    // last layer of vd and the weighted sum of all layers of wu, respectively.
+                    std::vector<ValueType> poissonTail(N + 1, storm::utility::zero<ValueType>());
+                    for (uint64_t k = N; k-- > 0;) {
+                        poissonTail[k] = poissonTail[k + 1];
+                        if (k >= foxGlynnResult.left && k <= foxGlynnResult.right) {
+                            poissonTail[k] += foxGlynnResult.weights[k - foxGlynnResult.left];
+                        }
+                    }
+                    std::vector<std::vector<ValueType>> layers(2, std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>()));
+                    std::vector<std::vector<ValueType>> nextLayers(2, std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>()));
+                    std::vector<std::vector<ValueType>> x(2, std::vector<ValueType>(numberOfProbStates, storm::utility::zero<ValueType>()));
+                    std::vector<std::vector<ValueType>> b(2, std::vector<ValueType>(probSize));
+                    std::vector<ValueType> vu(numberOfStates, storm::utility::zero<ValueType>());
 
-                    //define 0=vd 1=vu 2=wu
                     // (5) calculate vectors and maxNorm
-                    for (uint64_t i = 0; i < numberOfStates; i++) {
-                        for (uint64_t k = N; k <= N; k--) {
-                            calculateUnifPlusVector(env, k, i, 0, lambda, probSize, relReachability, dir, unifVectors,
-                                                    fullTransitionMatrix, markovianStates, psiStates, solver,
-                                                    foxGlynnResult, cycleFree);
-                            calculateUnifPlusVector(env, k, i, 2, lambda, probSize, relReachability, dir, unifVectors,
-                                                    fullTransitionMatrix, markovianStates, psiStates, solver,
-                                                    foxGlynnResult, cycleFree);
-                            calculateVu(env, relReachability, dir, k, i, 1, lambda, probSize, unifVectors,
-                                        fullTransitionMatrix, markovianStates, psiStates, solver,
-                                        foxGlynnResult, cycleFree);
+                    for (uint64_t k = N; k-- > 0;) {
+                        // In layer k, goal states have value sum_{i=k}^{N-1} poisson(i) in vd and one in wu.
+                        std::vector<ValueType> goalValues = {poissonTail[k], storm::utility::one<ValueType>()};
+                        threadPool.execute(2 * numberOfChunks, [&] (uint64_t chunk, uint64_t) {
+                            uint64_t kind = chunk / numberOfChunks;
+                            uint64_t firstState = std::min(numberOfStates, (chunk % numberOfChunks) * chunkSize);
+                            uint64_t lastState = std::min(numberOfStates, firstState + chunkSize);
+                            calculateUnifPlusMarkovianLayer(fullTransitionMatrix, markovianStates, psiStates, goalValues[kind], nextLayers[kind], layers[kind], firstState, lastState);
+                        });
+                        if (numberOfProbStates != 0) {
+                            // The solvers start from the values of the previous layer that are still stored in x.
+                            threadPool.execute(2, [&] (uint64_t kind, uint64_t) {
+                                calculateUnifPlusProbabilisticLayer(env, dir, fullTransitionMatrix, markovianStates, probabilisticStates, probabilisticOrder, solvers[kind], b[kind], x[kind], layers[kind]);
+                            });
+                        }
+
+                        // vu[0] = sum_{i=0}^{N-1} poisson(i) * wu[N-1-i]
+                        uint64_t i = N - 1 - k;
+                        if (i >= foxGlynnResult.left && i <= foxGlynnResult.right) {
+                            ValueType const& weight = foxGlynnResult.weights[i - foxGlynnResult.left];
+                            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                                vu[state] += weight * layers[1][state];
+                            }
                         }
+                        std::swap(layers, nextLayers);
                     }
+                    // After the last swap, the next layers hold layer 0.
+                    result = std::move(nextLayers[0]);
 
                     //only iterate over result vector, as the results can only get more precise
                     for (uint64_t i = 0; i < numberOfStates; i++){
-                        ValueType diff = std::abs(unifVectors[0][0][i]-unifVectors[1][0][i]);
+                        ValueType diff = std::abs(result[i] - vu[i]);
                          maxNorm = std::max(maxNorm, diff);
                     }
 
@@ -538,7 +475,7 @@ namespace storm {
 
                 } while (maxNorm > epsilon*(1 - kappa));
 
-                return unifVectors[0][0];
+                return result;
             }
 
             template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
@@ -615,7 +552,7 @@ namespace storm {
                 } else {
                     STORM_LOG_ASSERT(markovAutomatonSettings.getTechnique() == storm::settings::modules::MarkovAutomatonSettings::BoundedReachabilityTechnique::UnifPlus, "Unknown solution technique.");
                     
-                    return unifPlus(env, dir, boundsPair, exitRateVector, transitionMatrix, markovianStates, psiStates, minMaxLinearEquationSolverFactory);
+                    return unifPlus(env, dir, boundsPair, exitRateVector, transitionMatrix, markovianStates, psiStates, minMaxLinearEquationSolverFactory, markovAutomatonSettings.getNumberOfThreads());
                 }
             }
               
@@ -1060,6 +997,10 @@ namespace storm {
             }
             
             template std::vector<double> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory);
+
+            template std::vector<double> SparseMarkovAutomatonCslHelper::unifPlus(Environment const& env, OptimizationDirection dir, std::pair<double, double> const& boundsPair, std::vector<double> const& exitRateVector, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory, uint64_t numberOfThreads);
+
+            template std::vector<double> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesImca(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory);
                 
             template std::vector<double> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory);
                 
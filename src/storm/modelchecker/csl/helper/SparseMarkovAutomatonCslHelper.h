@@ -21,11 +21,12 @@ namespace storm {
                 /*!
                  * Computes time-bounded reachability according to the UnifPlus algorithm
                  *
+                 * @param numberOfThreads The number of threads that compute the unif vectors (zero for the number of hardware threads).
                  * @return the probability vector
                  *
                  */
                 template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type=0>
-                static std::vector<ValueType> unifPlus(Environment const& env, OptimizationDirection dir, std::pair<double, double> const& boundsPair, std::vector<ValueType> const& exitRateVector, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory);
+                static std::vector<ValueType> unifPlus(Environment const& env, OptimizationDirection dir, std::pair<double, double> const& boundsPair, std::vector<ValueType> const& exitRateVector, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory, uint64_t numberOfThreads = 1);
 
                 template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
                 static std::vector<ValueType> computeBoundedUntilProbabilities(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory);
@@ -54,38 +55,27 @@ namespace storm {
                 
             private:
                 /*
-                 * calculating the unifVectors uv, ow according to Unif+ for MA
+                 * Computes the entries of the Markovian (and goal) states in [firstState, lastState) of layer k < N of a
+                 * unif vector according to Unif+ for MA, given its layer k+1. Goal states get the given goal value.
                  */
                 template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type=0>
-                static void calculateUnifPlusVector(Environment const& env, uint64_t k, uint64_t node, uint64_t const kind, ValueType lambda, uint64_t probSize, std::vector<std::vector<ValueType>> const& relativeReachability, OptimizationDirection dir, std::vector<std::vector<std::vector<ValueType>>>& unifVectors, storm::storage::SparseMatrix<ValueType> const& fullTransitionMatrix, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> const& solver, storm::utility::numerical::FoxGlynnResult<ValueType> const & poisson, bool cycleFree);
+                static void calculateUnifPlusMarkovianLayer(storm::storage::SparseMatrix<ValueType> const& fullTransitionMatrix, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, ValueType const& goalValue, std::vector<ValueType> const& nextLayer, std::vector<ValueType>& layer, uint64_t firstState, uint64_t lastState);
 
                 /*
-                 * deleting the probabilistic Diagonals
+                 * Computes the entries of the probabilistic states of a layer of a unif vector according to Unif+ for MA,
+                 * given the entries of the Markovian states of the same layer. If a solver is given, the sub-MDP of the
+                 * probabilistic states is solved with it, where x holds the starting values (and receives the result) and b
+                 * is used as the right-hand side. Otherwise, the probabilistic states are processed in the given order,
+                 * in which the probabilistic successors of a state precede the state.
                  */
                 template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type=0>
-                static void deleteProbDiagonals(storm::storage::SparseMatrix<ValueType>& transitionMatrix, storm::storage::BitVector const& markovianStates);
-
-                /*
-                 * with having only a subset of the originalMatrix/vector, we need to transform indice
-                 */
-                static uint64_t transformIndice(storm::storage::BitVector const& subset, uint64_t fakeId){
-                    uint64_t id =0;
-                    uint64_t counter =0;
-                    while(counter<=fakeId){
-                        if(subset[id]){
-                            counter++;
-                        }
-                        id++;
-                    }
-                    return id-1;
-                }
+                static void calculateUnifPlusProbabilisticLayer(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& fullTransitionMatrix, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& probabilisticStates, std::vector<uint64_t> const& probabilisticOrder, std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> const& solver, std::vector<ValueType>& b, std::vector<ValueType>& x, std::vector<ValueType>& layer);
 
                 /*
-                 * Computes vu vector according to Unif+ for MA
-                 *
+                 * deleting the probabilistic Diagonals
                  */
                 template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type=0>
-                static void calculateVu(Environment const& env, std::vector<std::vector<ValueType>> const& relativeReachability, OptimizationDirection dir, uint64_t k, uint64_t node, uint64_t const kind, ValueType lambda, uint64_t probSize, std::vector<std::vector<std::vector<ValueType>>>& unifVectors, storm::storage::SparseMatrix<ValueType> const& fullTransitionMatrix, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> const& solver, storm::utility::numerical::FoxGlynnResult<ValueType> const & poisson, bool cycleFree);
+                static void deleteProbDiagonals(storm::storage::SparseMatrix<ValueType>& transitionMatrix, storm::storage::BitVector const& markovianStates);
 
                 template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
                 static void computeBoundedReachabilityProbabilities(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRates, storm::storage::BitVector const& goalStates, storm::storage::BitVector const& markovianNonGoalStates, storm::storage::BitVector const& probabilisticNonGoalStates, std::vector<ValueType>& markovianNonGoalValues, std::vector<ValueType>& probabilisticNonGoalValues, ValueType delta, uint64_t numberOfSteps, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory);
@@ -12,7 +12,7 @@ namespace storm {
                 if (index == explorationInformation.getUnexploredMarker()) {
                     return std::make_pair(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
                 } else {
-                    return boundsPerState[index];
+                    return boundsPerState[index].get();
                 }
             }
                         
@@ -27,8 +27,8 @@ namespace storm {
             }
             
             template<typename StateType, typename ValueType>
-            ValueType const& Bounds<StateType, ValueType>::getLowerBoundForRowGroup(StateType const& rowGroup) const {
-                return boundsPerState[rowGroup].first;
+            ValueType Bounds<StateType, ValueType>::getLowerBoundForRowGroup(StateType const& rowGroup) const {
+                return boundsPerState[rowGroup].lower.load(std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
@@ -42,27 +42,27 @@ namespace storm {
             }
             
             template<typename StateType, typename ValueType>
-            ValueType const& Bounds<StateType, ValueType>::getUpperBoundForRowGroup(StateType const& rowGroup) const {
-                return boundsPerState[rowGroup].second;
+            ValueType Bounds<StateType, ValueType>::getUpperBoundForRowGroup(StateType const& rowGroup) const {
+                return boundsPerState[rowGroup].upper.load(std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
-            std::pair<ValueType, ValueType> const& Bounds<StateType, ValueType>::getBoundsForAction(ActionType const& action) const {
-                return boundsPerAction[action];
+            std::pair<ValueType, ValueType> Bounds<StateType, ValueType>::getBoundsForAction(ActionType const& action) const {
+                return boundsPerAction[action].get();
             }
             
             template<typename StateType, typename ValueType>
-            ValueType const& Bounds<StateType, ValueType>::getLowerBoundForAction(ActionType const& action) const {
-                return boundsPerAction[action].first;
+            ValueType Bounds<StateType, ValueType>::getLowerBoundForAction(ActionType const& action) const {
+                return boundsPerAction[action].lower.load(std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
-            ValueType const& Bounds<StateType, ValueType>::getUpperBoundForAction(ActionType const& action) const {
-                return boundsPerAction[action].second;
+            ValueType Bounds<StateType, ValueType>::getUpperBoundForAction(ActionType const& action) const {
+                return boundsPerAction[action].upper.load(std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
-            ValueType const& Bounds<StateType, ValueType>::getBoundForAction(storm::OptimizationDirection const& direction, ActionType const& action) const {
+            ValueType Bounds<StateType, ValueType>::getBoundForAction(storm::OptimizationDirection const& direction, ActionType const& action) const {
                 if (direction == storm::OptimizationDirection::Maximize) {
                     return getUpperBoundForAction(action);
                 } else {
@@ -93,7 +93,7 @@ namespace storm {
             
             template<typename StateType, typename ValueType>
             void Bounds<StateType, ValueType>::setLowerBoundForRowGroup(StateType const& group, ValueType const& value) {
-                boundsPerState[group].first = value;
+                boundsPerState[group].lower.store(value, std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
@@ -103,12 +103,13 @@ namespace storm {
             
             template<typename StateType, typename ValueType>
             void Bounds<StateType, ValueType>::setUpperBoundForRowGroup(StateType const& group, ValueType const& value) {
-                boundsPerState[group].second = value;
+                boundsPerState[group].upper.store(value, std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
             void Bounds<StateType, ValueType>::setBoundsForAction(ActionType const& action, std::pair<ValueType, ValueType> const& values) {
-                boundsPerAction[action] = values;
+                boundsPerAction[action].lower.store(values.first, std::memory_order_relaxed);
+                boundsPerAction[action].upper.store(values.second, std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
@@ -119,29 +120,73 @@ namespace storm {
             
             template<typename StateType, typename ValueType>
             void Bounds<StateType, ValueType>::setBoundsForRowGroup(StateType const& rowGroup, std::pair<ValueType, ValueType> const& values) {
-                boundsPerState[rowGroup] = values;
+                boundsPerState[rowGroup].lower.store(values.first, std::memory_order_relaxed);
+                boundsPerState[rowGroup].upper.store(values.second, std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
             bool Bounds<StateType, ValueType>::setLowerBoundOfStateIfGreaterThanOld(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation, ValueType const& newLowerValue) {
-                StateType const& rowGroup = explorationInformation.getRowGroup(state);
-                if (boundsPerState[rowGroup].first < newLowerValue) {
-                    boundsPerState[rowGroup].first = newLowerValue;
-                    return true;
+                return setLowerBoundOfRowGroupIfGreaterThanOld(explorationInformation.getRowGroup(state), newLowerValue);
+            }
+            
+            template<typename StateType, typename ValueType>
+            bool Bounds<StateType, ValueType>::setUpperBoundOfStateIfLessThanOld(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation, ValueType const& newUpperValue) {
+                return setUpperBoundOfRowGroupIfLessThanOld(explorationInformation.getRowGroup(state), newUpperValue);
+            }
+            
+            template<typename StateType, typename ValueType>
+            bool Bounds<StateType, ValueType>::setLowerBoundOfRowGroupIfGreaterThanOld(StateType const& rowGroup, ValueType const& newLowerValue) {
+                return increaseTo(boundsPerState[rowGroup].lower, newLowerValue);
+            }
+            
+            template<typename StateType, typename ValueType>
+            bool Bounds<StateType, ValueType>::setUpperBoundOfRowGroupIfLessThanOld(StateType const& rowGroup, ValueType const& newUpperValue) {
+                return decreaseTo(boundsPerState[rowGroup].upper, newUpperValue);
+            }
+            
+            template<typename StateType, typename ValueType>
+            void Bounds<StateType, ValueType>::setBoundsOfActionIfTighterThanOld(ActionType const& action, std::pair<ValueType, ValueType> const& values) {
+                increaseTo(boundsPerAction[action].lower, values.first);
+                decreaseTo(boundsPerAction[action].upper, values.second);
+            }
+            
+            template<typename StateType, typename ValueType>
+            bool Bounds<StateType, ValueType>::increaseTo(std::atomic<ValueType>& bound, ValueType const& value) {
+                ValueType current = bound.load(std::memory_order_relaxed);
+                while (current < value) {
+                    if (bound.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+                        return true;
+                    }
                 }
                 return false;
             }
             
             template<typename StateType, typename ValueType>
-            bool Bounds<StateType, ValueType>::setUpperBoundOfStateIfLessThanOld(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation, ValueType const& newUpperValue) {
-                StateType const& rowGroup = explorationInformation.getRowGroup(state);
-                if (newUpperValue < boundsPerState[rowGroup].second) {
-                    boundsPerState[rowGroup].second = newUpperValue;
-                    return true;
+            bool Bounds<StateType, ValueType>::decreaseTo(std::atomic<ValueType>& bound, ValueType const& value) {
+                ValueType current = bound.load(std::memory_order_relaxed);
+                while (value < current) {
+                    if (bound.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+                        return true;
+                    }
                 }
                 return false;
             }
             
+            template<typename StateType, typename ValueType>
+            Bounds<StateType, ValueType>::BoundPair::BoundPair(std::pair<ValueType, ValueType> const& values) : lower(values.first), upper(values.second) {
+                // Intentionally left empty.
+            }
+            
+            template<typename StateType, typename ValueType>
+            Bounds<StateType, ValueType>::BoundPair::BoundPair(BoundPair const& other) : lower(other.lower.load(std::memory_order_relaxed)), upper(other.upper.load(std::memory_order_relaxed)) {
+                // Intentionally left empty.
+            }
+            
+            template<typename StateType, typename ValueType>
+            std::pair<ValueType, ValueType> Bounds<StateType, ValueType>::BoundPair::get() const {
+                return std::make_pair(lower.load(std::memory_order_relaxed), upper.load(std::memory_order_relaxed));
+            }
+            
             template class Bounds<uint32_t, double>;
             
         }
@@ -1,6 +1,7 @@
 #ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_BOUNDS_H_
 #define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_BOUNDS_H_
 
+#include <atomic>
 #include <vector>
 #include <utility>
 
@@ -15,6 +16,11 @@ namespace storm {
             template<typename StateType, typename ValueType>
             class ExplorationInformation;
             
+            /*!
+             * The lower and upper bounds of the states and actions. The bounds may be read and tightened concurrently
+             * (the tightening operations only ever increase lower and decrease upper bounds), but adding bounds for new
+             * states or actions and overwriting bounds requires exclusive access.
+             */
             template<typename StateType, typename ValueType>
             class Bounds {
             public:
@@ -24,19 +30,19 @@ namespace storm {
                 
                 ValueType getLowerBoundForState(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation) const;
                 
-                ValueType const& getLowerBoundForRowGroup(StateType const& rowGroup) const;
+                ValueType getLowerBoundForRowGroup(StateType const& rowGroup) const;
                 
                 ValueType getUpperBoundForState(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation) const;
                 
-                ValueType const& getUpperBoundForRowGroup(StateType const& rowGroup) const;
+                ValueType getUpperBoundForRowGroup(StateType const& rowGroup) const;
                 
-                std::pair<ValueType, ValueType> const& getBoundsForAction(ActionType const& action) const;
+                std::pair<ValueType, ValueType> getBoundsForAction(ActionType const& action) const;
                 
-                ValueType const& getLowerBoundForAction(ActionType const& action) const;
+                ValueType getLowerBoundForAction(ActionType const& action) const;
                 
-                ValueType const& getUpperBoundForAction(ActionType const& action) const;
+                ValueType getUpperBoundForAction(ActionType const& action) const;
                 
-                ValueType const& getBoundForAction(storm::OptimizationDirection const& direction, ActionType const& action) const;
+                ValueType getBoundForAction(storm::OptimizationDirection const& direction, ActionType const& action) const;
                 
                 ValueType getDifferenceOfStateBounds(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation) const;
                 
@@ -62,9 +68,30 @@ namespace storm {
                 
                 bool setUpperBoundOfStateIfLessThanOld(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation, ValueType const& newUpperValue);
                 
+                bool setLowerBoundOfRowGroupIfGreaterThanOld(StateType const& rowGroup, ValueType const& newLowerValue);
+                
+                bool setUpperBoundOfRowGroupIfLessThanOld(StateType const& rowGroup, ValueType const& newUpperValue);
+                
+                void setBoundsOfActionIfTighterThanOld(ActionType const& action, std::pair<ValueType, ValueType> const& values);
+                
             private:
-                std::vector<std::pair<ValueType, ValueType>> boundsPerState;
-                std::vector<std::pair<ValueType, ValueType>> boundsPerAction;
+                // A pair of bounds that can be accessed atomically. Copying is only needed when the containing vector
+                // grows, which happens with exclusive access.
+                struct BoundPair {
+                    BoundPair(std::pair<ValueType, ValueType> const& values);
+                    BoundPair(BoundPair const& other);
+                    
+                    std::pair<ValueType, ValueType> get() const;
+                    
+                    std::atomic<ValueType> lower;
+                    std::atomic<ValueType> upper;
+                };
+                
+                static bool increaseTo(std::atomic<ValueType>& bound, ValueType const& value);
+                static bool decreaseTo(std::atomic<ValueType>& bound, ValueType const& value);
+                
+                std::vector<BoundPair> boundsPerState;
+                std::vector<BoundPair> boundsPerAction;
             };
             
         }
@@ -1,5 +1,9 @@
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
 
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
 #include "storm/modelchecker/exploration/StateGeneration.h"
 #include "storm/modelchecker/exploration/Bounds.h"
@@ -28,6 +32,7 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/prism.h"
+#include "storm/utility/ThreadPool.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
@@ -37,7 +42,12 @@ namespace storm {
     namespace modelchecker {
         
         template<typename ModelType, typename StateType>
-        SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::prism::Program const& program) : program(program.substituteConstants()), randomGenerator(std::chrono::system_clock::now().time_since_epoch().count()), comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()) {
+        SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::prism::Program const& program) : SparseExplorationModelChecker(program, storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getNumberOfThreads()) {
+            // Intentionally left empty.
+        }
+        
+        template<typename ModelType, typename StateType>
+        SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::prism::Program const& program, uint64_t numberOfThreads) : program(program.substituteConstants()), randomGenerator(std::chrono::system_clock::now().time_since_epoch().count()), numberOfThreads(numberOfThreads), comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()) {
             // Intentionally left empty.
         }
         
@@ -79,38 +89,42 @@ namespace storm {
             // Create a structure that holds the bounds for the states and actions.
             Bounds<StateType, ValueType> bounds;
             
-            // Create a stack that is used to track the path we sampled.
-            StateActionStack stack;
-            
             // Now perform the actual sampling.
             Statistics<StateType, ValueType> stats;
-            bool convergenceCriterionMet = false;
-            while (!convergenceCriterionMet) {
-                bool result = samplePathFromInitialState(stateGeneration, explorationInformation, stack, bounds, stats);
+            if (numberOfThreads != 1) {
+                performParallelExploration(initialStateIndex, stateGeneration, explorationInformation, bounds, stats);
+            } else {
+                // Create a stack that is used to track the path we sampled.
+                StateActionStack stack;
                 
-                stats.sampledPath();
-                stats.updateMaxPathLength(stack.size());
+                bool convergenceCriterionMet = false;
+                while (!convergenceCriterionMet) {
+                    bool result = samplePathFromInitialState(stateGeneration, explorationInformation, stack, bounds, stats);
                 
-                // If a terminal state was found, we update the probabilities along the path contained in the stack.
-                if (result) {
-                    // Update the bounds along the path to the terminal state.
-                    STORM_LOG_TRACE("Found terminal state, updating probabilities along path.");
-                    updateProbabilityBoundsAlongSampledPath(stack, explorationInformation, bounds);
-                } else {
-                    // If not terminal state was found, the search aborted, possibly because of an EC-detection. In this
-                    // case, we cannot update the probabilities.
-                    STORM_LOG_TRACE("Did not find terminal state.");
-                }
+                    stats.sampledPath();
+                    stats.updateMaxPathLength(stack.size());
                 
-                STORM_LOG_DEBUG("Discovered states: " << explorationInformation.getNumberOfDiscoveredStates() << " (" << stats.numberOfExploredStates << " explored, " << explorationInformation.getNumberOfUnexploredStates() << " unexplored).");
-                STORM_LOG_DEBUG("Value of initial state is in [" << bounds.getLowerBoundForState(initialStateIndex, explorationInformation) << ", " << bounds.getUpperBoundForState(initialStateIndex, explorationInformation) << "].");
-                ValueType difference = bounds.getDifferenceOfStateBounds(initialStateIndex, explorationInformation);
-                STORM_LOG_DEBUG("Difference after iteration " << stats.pathsSampled << " is " << difference << ".");
-                convergenceCriterionMet = comparator.isZero(difference);
+                    // If a terminal state was found, we update the probabilities along the path contained in the stack.
+                    if (result) {
+                        // Update the bounds along the path to the terminal state.
+                        STORM_LOG_TRACE("Found terminal state, updating probabilities along path.");
+                        updateProbabilityBoundsAlongSampledPath(stack, explorationInformation, bounds);
+                    } else {
+                        // If not terminal state was found, the search aborted, possibly because of an EC-detection. In this
+                        // case, we cannot update the probabilities.
+                        STORM_LOG_TRACE("Did not find terminal state.");
+                    }
+                
+                    STORM_LOG_DEBUG("Discovered states: " << explorationInformation.getNumberOfDiscoveredStates() << " (" << stats.numberOfExploredStates << " explored, " << explorationInformation.getNumberOfUnexploredStates() << " unexplored).");
+                    STORM_LOG_DEBUG("Value of initial state is in [" << bounds.getLowerBoundForState(initialStateIndex, explorationInformation) << ", " << bounds.getUpperBoundForState(initialStateIndex, explorationInformation) << "].");
+                    ValueType difference = bounds.getDifferenceOfStateBounds(initialStateIndex, explorationInformation);
+                    STORM_LOG_DEBUG("Difference after iteration " << stats.pathsSampled << " is " << difference << ".");
+                    convergenceCriterionMet = comparator.isZero(difference);
                 
-                // If the number of sampled paths exceeds a certain threshold, do a precomputation.
-                if (!convergenceCriterionMet && explorationInformation.performPrecomputationExcessiveSampledPaths(stats.pathsSampledSinceLastPrecomputation)) {
-                    performPrecomputation(stack, explorationInformation, bounds, stats);
+                    // If the number of sampled paths exceeds a certain threshold, do a precomputation.
+                    if (!convergenceCriterionMet && explorationInformation.performPrecomputationExcessiveSampledPaths(stats.pathsSampledSinceLastPrecomputation)) {
+                        performPrecomputation(stack, explorationInformation, bounds, stats);
+                    }
                 }
             }
             
@@ -122,6 +136,126 @@ namespace storm {
             return std::make_tuple(initialStateIndex, bounds.getLowerBoundForState(initialStateIndex, explorationInformation), bounds.getUpperBoundForState(initialStateIndex, explorationInformation));
         }
         
+        template<typename ModelType, typename StateType>
+        void SparseExplorationModelChecker<ModelType, StateType>::performParallelExploration(StateType const& initialStateIndex, StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const {
+            storm::utility::ThreadPool threadPool(numberOfThreads);
+            uint64_t numberOfSamplers = threadPool.getNumberOfThreads();
+            STORM_LOG_INFO("Sampling paths with " << numberOfSamplers << " threads.");
+            
+            // Sampling and updating the bounds only requires shared access to the explored fragment, while exploring
+            // states and precomputations change its structure and therefore require exclusive access.
+            std::shared_timed_mutex explorationMutex;
+            std::atomic<bool> samplingFinished(false);
+            
+            // As precomputations may collapse MECs and thereby move actions, a sampler only updates the bounds along a
+            // path if no precomputation was performed since it started sampling it.
+            std::atomic<uint64_t> numberOfPrecomputations(0);
+            
+            // The samplers jointly decide when a precomputation is due.
+            std::atomic<std::size_t> explorationStepsSinceLastPrecomputation(0);
+            std::atomic<std::size_t> pathsSampledSinceLastPrecomputation(0);
+            
+            std::vector<Statistics<StateType, ValueType>> statsPerSampler(numberOfSamplers);
+            std::vector<std::default_random_engine> generators;
+            for (uint64_t sampler = 0; sampler < numberOfSamplers; ++sampler) {
+                generators.emplace_back(randomGenerator());
+            }
+            
+            threadPool.execute(numberOfSamplers, [&] (uint64_t sampler, uint64_t) {
+                // If a sampler fails, the others must not wait for the bounds to converge.
+                try {
+                    std::default_random_engine& generator = generators[sampler];
+                    Statistics<StateType, ValueType>& samplerStats = statsPerSampler[sampler];
+                    StateActionStack stack;
+                
+                    while (!samplingFinished.load()) {
+                        uint64_t precomputationsBeforePath = numberOfPrecomputations.load();
+                        stack.clear();
+                        stack.emplace_back(initialStateIndex, 0);
+                    
+                        bool foundTerminalState = false;
+                        bool aborted = false;
+                        while (!foundTerminalState && !aborted) {
+                            StateType currentStateId = stack.back().first;
+                        
+                            // Explore the state if this has not been done yet. As another sampler may have explored it in
+                            // the meantime, we need to check again once we have exclusive access.
+                            bool isUnexplored;
+                            {
+                                std::shared_lock<std::shared_timed_mutex> lock(explorationMutex);
+                                isUnexplored = explorationInformation.findUnexploredState(currentStateId) != explorationInformation.unexploredStatesEnd();
+                            }
+                            if (isUnexplored) {
+                                std::unique_lock<std::shared_timed_mutex> lock(explorationMutex);
+                                auto unexploredIt = explorationInformation.findUnexploredState(currentStateId);
+                                if (unexploredIt != explorationInformation.unexploredStatesEnd()) {
+                                    exploreState(stateGeneration, currentStateId, unexploredIt->second, explorationInformation, bounds, samplerStats);
+                                    explorationInformation.removeUnexploredState(unexploredIt);
+                                }
+                            }
+                        
+                            {
+                                std::shared_lock<std::shared_timed_mutex> lock(explorationMutex);
+                                foundTerminalState = explorationInformation.isTerminal(currentStateId);
+                                if (!foundTerminalState) {
+                                    ActionType chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds, generator);
+                                    stack.back().second = chosenAction;
+                                    stack.emplace_back(sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, generator), 0);
+                                }
+                            }
+                            samplerStats.explorationStep();
+                        
+                            // If the number of exploration steps exceeds a certain threshold, do a precomputation.
+                            if (!foundTerminalState) {
+                                std::size_t steps = ++explorationStepsSinceLastPrecomputation;
+                                if (explorationInformation.performPrecomputationExcessiveExplorationSteps(steps)) {
+                                    std::unique_lock<std::shared_timed_mutex> lock(explorationMutex);
+                                    steps = explorationStepsSinceLastPrecomputation.load();
+                                    if (explorationInformation.performPrecomputationExcessiveExplorationSteps(steps)) {
+                                        performPrecomputation(stack, explorationInformation, bounds, samplerStats);
+                                        explorationStepsSinceLastPrecomputation = 0;
+                                        ++numberOfPrecomputations;
+                                    }
+                                    aborted = true;
+                                }
+                            }
+                        }
+                    
+                        samplerStats.sampledPath();
+                        samplerStats.updateMaxPathLength(stack.size());
+                    
+                        std::shared_lock<std::shared_timed_mutex> lock(explorationMutex);
+                        if (foundTerminalState && numberOfPrecomputations.load() == precomputationsBeforePath) {
+                            updateProbabilityBoundsAlongSampledPath(stack, explorationInformation, bounds);
+                        }
+                        if (comparator.isZero(bounds.getDifferenceOfStateBounds(initialStateIndex, explorationInformation))) {
+                            samplingFinished = true;
+                        }
+                        lock.unlock();
+                    
+                        // If the number of sampled paths exceeds a certain threshold, do a precomputation.
+                        std::size_t paths = ++pathsSampledSinceLastPrecomputation;
+                        if (!samplingFinished.load() && explorationInformation.performPrecomputationExcessiveSampledPaths(paths)) {
+                            std::unique_lock<std::shared_timed_mutex> exclusiveLock(explorationMutex);
+                            paths = pathsSampledSinceLastPrecomputation.load();
+                            if (explorationInformation.performPrecomputationExcessiveSampledPaths(paths)) {
+                                performPrecomputation(stack, explorationInformation, bounds, samplerStats);
+                                pathsSampledSinceLastPrecomputation = 0;
+                                ++numberOfPrecomputations;
+                            }
+                        }
+                    }
+                } catch (...) {
+                    samplingFinished = true;
+                    throw;
+                }
+            });
+            
+            for (auto const& samplerStats : statsPerSampler) {
+                stats.merge(samplerStats);
+            }
+        }
+        
         template<typename ModelType, typename StateType>
         bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const {
             // Start the search from the initial state.
@@ -160,11 +294,11 @@ namespace storm {
                 if (!foundTerminalState) {
                     // At this point, we can be sure that the state was expanded and that we can sample according to the
                     // probabilities in the matrix.
-                    uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds);
+                    uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds, randomGenerator);
                     stack.back().second = chosenAction;
                     STORM_LOG_TRACE("Sampled action " << chosenAction << " in state " << currentStateId << ".");
                     
-                    StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds);
+                    StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, randomGenerator);
                     STORM_LOG_TRACE("Sampled successor " << successor << " according to action " << chosenAction << " of state " << currentStateId << ".");
                     
                     // Put the successor state and a dummy action on top of the stack.
@@ -287,7 +421,7 @@ namespace storm {
         }
         
         template<typename ModelType, typename StateType>
-        typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseExplorationModelChecker<ModelType, StateType>::sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const {
+        typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseExplorationModelChecker<ModelType, StateType>::sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds, std::default_random_engine& generator) const {
             // Determine the values of all available actions.
             std::vector<std::pair<ActionType, ValueType>> actionValues;
             StateType rowGroup = explorationInformation.getRowGroup(currentStateId);
@@ -321,11 +455,11 @@ namespace storm {
             
             // Now sample from all maximizing actions.
             std::uniform_int_distribution<ActionType> distribution(0, std::distance(actionValues.begin(), end) - 1);
-            return actionValues[distribution(randomGenerator)].first;
+            return actionValues[distribution(generator)].first;
         }
         
         template<typename ModelType, typename StateType>
-        StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const {
+        StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds, std::default_random_engine& generator) const {
             std::vector<storm::storage::MatrixEntry<StateType, ValueType>> const& row = explorationInformation.getRowOfMatrix(chosenAction);
             if (row.size() == 1) {
                 return row.front().getColumn();
@@ -348,11 +482,11 @@ namespace storm {
                 
                 // Now sample according to the probabilities.
                 std::discrete_distribution<StateType> distribution(probabilities.begin(), probabilities.end());
-                return row[distribution(randomGenerator)].getColumn();
+                return row[distribution(generator)].getColumn();
             } else {
                 STORM_LOG_ASSERT(explorationInformation.useUniformHeuristic(), "Illegal next-state heuristic.");
                 std::uniform_int_distribution<ActionType> distribution(0, row.size() - 1);
-                return row[distribution(randomGenerator)].getColumn();
+                return row[distribution(generator)].getColumn();
             }
         }
         
@@ -560,7 +694,7 @@ namespace storm {
                 std::pair<ValueType, ValueType> stateBounds = getLowestBounds(explorationInformation.getOptimizationDirection());
                 for (auto const& action : leavingActions) {
                     explorationInformation.moveActionToBackOfMatrix(action);
-                    std::pair<ValueType, ValueType> const& actionBounds = bounds.getBoundsForAction(action);
+                    std::pair<ValueType, ValueType> actionBounds = bounds.getBoundsForAction(action);
                     bounds.initializeBoundsForNextAction(actionBounds);
                     stateBounds = combineBounds(explorationInformation.getOptimizationDirection(), stateBounds, actionBounds);
                 }
@@ -625,8 +759,9 @@ namespace storm {
             // Compute the new lower/upper values of the action.
             std::pair<ValueType, ValueType> newBoundsForAction = computeBoundsOfAction(action, explorationInformation, bounds);
             
-            // And set them as the current value.
-            bounds.setBoundsForAction(action, newBoundsForAction);
+            // And set them as the current value. As both the old and the new bounds are valid, we keep the tighter
+            // ones (which matters if other samplers update the bounds concurrently).
+            bounds.setBoundsOfActionIfTighterThanOld(action, newBoundsForAction);
             
             // Check if we need to update the values for the states.
             if (explorationInformation.maximize()) {
@@ -638,7 +773,7 @@ namespace storm {
                         newBoundsForAction.second = std::max(newBoundsForAction.second, computeBoundOverAllOtherActions(storm::OptimizationDirection::Maximize, state, action, explorationInformation, bounds));
                     }
                     
-                    bounds.setUpperBoundForRowGroup(rowGroup, newBoundsForAction.second);
+                    bounds.setUpperBoundOfRowGroupIfLessThanOld(rowGroup, newBoundsForAction.second);
                 }
             } else {
                 bounds.setUpperBoundOfStateIfLessThanOld(state, explorationInformation, newBoundsForAction.second);
@@ -650,7 +785,7 @@ namespace storm {
                         newBoundsForAction.first = std::min(newBoundsForAction.first, min);
                     }
                     
-                    bounds.setLowerBoundForRowGroup(rowGroup, newBoundsForAction.first);
+                    bounds.setLowerBoundOfRowGroupIfGreaterThanOld(rowGroup, newBoundsForAction.first);
                 }
             }
         }
@@ -42,20 +42,33 @@ namespace storm {
             
             SparseExplorationModelChecker(storm::prism::Program const& program);
             
+            /*!
+             * Creates a checker that samples paths with the given number of threads (zero for the number of hardware
+             * threads) instead of the one set in the exploration settings.
+             */
+            SparseExplorationModelChecker(storm::prism::Program const& program, uint64_t numberOfThreads);
+            
             virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
             
             virtual std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env, CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
             
         private:
             std::tuple<StateType, ValueType, ValueType> performExploration(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation) const;
+            
+            /*!
+             * Samples paths with several threads that share the explored fragment of the system and the bounds. Sampling
+             * and updating the bounds happens concurrently, whereas exploring new states and the precomputations are
+             * performed by one thread at a time.
+             */
+            void performParallelExploration(StateType const& initialStateIndex, StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
 
             bool samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
             
             bool exploreState(StateGeneration<StateType, ValueType>& stateGeneration, StateType const& currentStateId, storm::generator::CompressedState const& currentState, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
             
-            ActionType sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const;
+            ActionType sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds, std::default_random_engine& generator) const;
 
-            StateType sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const;
+            StateType sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds, std::default_random_engine& generator) const;
             
             bool performPrecomputation(StateActionStack const& stack, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
             
@@ -81,6 +94,9 @@ namespace storm {
             // The random number generator.
             mutable std::default_random_engine randomGenerator;
             
+            // The number of threads that sample paths (zero for the number of hardware threads).
+            uint64_t numberOfThreads;
+            
             // A comparator used to determine whether values are equal.
             storm::utility::ConstantsComparator<ValueType> comparator;
         };
@@ -22,6 +22,9 @@ namespace storm {
                 
                 void updateMaxPathLength(std::size_t const& currentPathLength);
                 
+                // Adds the statistics gathered by another sampler.
+                void merge(Statistics const& other);
+                
                 void printToStream(std::ostream& out, ExplorationInformation<StateType, ValueType> const& explorationInformation) const;
                 
                 std::size_t pathsSampled;
@@ -0,0 +1,83 @@
+#include "storm/modelchecker/hints/ExplicitModelCheckerHintCache.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        template<typename ValueType>
+        ExplicitModelCheckerHintCache<ValueType>::ExplicitModelCheckerHintCache(uint64_t maximalNumberOfEntries) : maximalNumberOfEntries(maximalNumberOfEntries), numberOfHits(0), numberOfWarmStarts(0) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        std::shared_ptr<ExplicitModelCheckerHint<ValueType>> ExplicitModelCheckerHintCache<ValueType>::getHint(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::solver::OptimizationDirection const& direction) const {
+            Entry const* closestEntry = nullptr;
+            for (auto const& entry : entries) {
+                if (entry.direction != direction) {
+                    continue;
+                }
+                if (entry.phiStates == phiStates && entry.psiStates == psiStates) {
+                    STORM_LOG_INFO("Reusing the qualitative analysis and the result of a previous computation.");
+                    ++numberOfHits;
+                    auto hint = std::make_shared<ExplicitModelCheckerHint<ValueType>>();
+                    hint->setResultHint(entry.values);
+                    hint->setMaybeStates(entry.maybeStates);
+                    hint->setComputeOnlyMaybeStates(true);
+                    return hint;
+                }
+
+                // The probabilities are monotone in the phi and psi states, so the values of the entry are lower bounds.
+                // Among these entries, we take the one with the most psi (and then phi) states.
+                if (entry.phiStates.isSubsetOf(phiStates) && entry.psiStates.isSubsetOf(psiStates)) {
+                    if (!closestEntry || entry.psiStates.getNumberOfSetBits() > closestEntry->psiStates.getNumberOfSetBits() || (entry.psiStates.getNumberOfSetBits() == closestEntry->psiStates.getNumberOfSetBits() && entry.phiStates.getNumberOfSetBits() > closestEntry->phiStates.getNumberOfSetBits())) {
+                        closestEntry = &entry;
+                    }
+                }
+            }
+
+            if (closestEntry) {
+                STORM_LOG_INFO("Starting from the result of a previous computation.");
+                ++numberOfWarmStarts;
+                auto hint = std::make_shared<ExplicitModelCheckerHint<ValueType>>();
+                hint->setResultHint(closestEntry->values);
+                return hint;
+            }
+            return nullptr;
+        }
+
+        template<typename ValueType>
+        void ExplicitModelCheckerHintCache<ValueType>::insert(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::solver::OptimizationDirection const& direction, storm::storage::BitVector const& maybeStates, std::vector<ValueType> const& values) {
+            if (maximalNumberOfEntries == 0) {
+                return;
+            }
+            for (auto& entry : entries) {
+                if (entry.direction == direction && entry.phiStates == phiStates && entry.psiStates == psiStates) {
+                    // Keep the more recent (and possibly more precise) values.
+                    entry.values = values;
+                    return;
+                }
+            }
+            if (entries.size() == maximalNumberOfEntries) {
+                entries.pop_front();
+            }
+            entries.push_back(Entry{phiStates, psiStates, direction, maybeStates, values});
+        }
+
+        template<typename ValueType>
+        uint64_t ExplicitModelCheckerHintCache<ValueType>::getNumberOfHits() const {
+            return numberOfHits;
+        }
+
+        template<typename ValueType>
+        uint64_t ExplicitModelCheckerHintCache<ValueType>::getNumberOfWarmStarts() const {
+            return numberOfWarmStarts;
+        }
+
+        template class ExplicitModelCheckerHintCache<double>;
+        template class ExplicitModelCheckerHintCache<storm::RationalNumber>;
+        template class ExplicitModelCheckerHintCache<storm::RationalFunction>;
+
+    }
+}
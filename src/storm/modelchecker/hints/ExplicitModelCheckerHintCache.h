@@ -0,0 +1,74 @@
+#ifndef STORM_MODELCHECKER_HINTS_EXPLICITMODELCHECKERHINTCACHE_H
+#define STORM_MODELCHECKER_HINTS_EXPLICITMODELCHECKERHINTCACHE_H
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        /*!
+         * This class stores the results of previous (unbounded) until probability computations on one model and derives
+         * hints for later computations from them. For a computation with the same phi states, psi states and direction, the
+         * hint contains the maybe states and the result, which makes the qualitative analysis obsolete and lets the solver
+         * start from the converged values. Otherwise, the result of a computation whose phi and psi states are subsets of
+         * the requested ones is a lower bound on the new result and is used as a starting point for the solver.
+         * @note The cache must only be used for computations on the model for which the results were computed.
+         */
+        template<typename ValueType>
+        class ExplicitModelCheckerHintCache {
+        public:
+
+            /*!
+             * Creates an empty cache.
+             *
+             * @param maximalNumberOfEntries The number of results that are kept. If a result is inserted into a full cache,
+             * the oldest result is evicted.
+             */
+            ExplicitModelCheckerHintCache(uint64_t maximalNumberOfEntries = 16);
+
+            /*!
+             * Retrieves a hint for the computation of the probabilities to satisfy phi until psi.
+             *
+             * @return The hint or a null pointer if the cache contains no suitable result.
+             */
+            std::shared_ptr<ExplicitModelCheckerHint<ValueType>> getHint(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::solver::OptimizationDirection const& direction) const;
+
+            /*!
+             * Inserts the result of the computation of the probabilities to satisfy phi until psi.
+             *
+             * @param maybeStates The states whose probability is neither zero nor one.
+             * @param values The probabilities of all states.
+             */
+            void insert(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::solver::OptimizationDirection const& direction, storm::storage::BitVector const& maybeStates, std::vector<ValueType> const& values);
+
+            uint64_t getNumberOfHits() const;
+            uint64_t getNumberOfWarmStarts() const;
+
+        private:
+            struct Entry {
+                storm::storage::BitVector phiStates;
+                storm::storage::BitVector psiStates;
+                storm::solver::OptimizationDirection direction;
+                storm::storage::BitVector maybeStates;
+                std::vector<ValueType> values;
+            };
+
+            uint64_t maximalNumberOfEntries;
+
+            // The cached results, ordered by the time of their insertion.
+            std::deque<Entry> entries;
+
+            mutable uint64_t numberOfHits;
+            mutable uint64_t numberOfWarmStarts;
+        };
+
+    }
+}
+
+#endif /* STORM_MODELCHECKER_HINTS_EXPLICITMODELCHECKERHINTCACHE_H */
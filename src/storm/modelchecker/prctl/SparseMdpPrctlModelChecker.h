@@ -2,6 +2,7 @@
 #define STORM_MODELCHECKER_SPARSEMDPPRCTLMODELCHECKER_H_
 
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHintCache.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 
@@ -19,6 +20,12 @@ namespace storm {
             explicit SparseMdpPrctlModelChecker(SparseMdpModelType const& model);
             explicit SparseMdpPrctlModelChecker(SparseMdpModelType const& model, std::unique_ptr<storm::solver::MinMaxLinearEquationSolverFactory<ValueType>>&& MinMaxLinearEquationSolverFactory);
             
+            /*!
+             * Sets a cache that provides hints for (and stores the results of) until probability computations for which no
+             * hint is given. The cache may be shared among several model checkers for the same model.
+             */
+            void setHintCache(std::shared_ptr<ExplicitModelCheckerHintCache<ValueType>> const& hintCache);
+            
             // The implemented methods of the AbstractModelChecker interface.
             virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
             virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) override;
@@ -36,6 +43,9 @@ namespace storm {
         private:
             // An object that is used for retrieving solvers for systems of linear equations that are the result of nondeterministic choices.
             std::unique_ptr<storm::solver::MinMaxLinearEquationSolverFactory<ValueType>> minMaxLinearEquationSolverFactory;
+            
+            // If set, the results of until probability computations are cached and reused.
+            std::shared_ptr<ExplicitModelCheckerHintCache<ValueType>> hintCache;
         };
     } // namespace modelchecker
 } // namespace storm
@@ -4,6 +4,9 @@
 
 #include "storm/solver/LinearEquationSolver.h"
 
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
@@ -11,6 +14,7 @@
 
 #include "storm/utility/graph.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/dd.h"
 
 #include "storm/models/symbolic/StandardRewardModel.h"
 
@@ -28,6 +32,81 @@ namespace storm {
     namespace modelchecker {
         namespace helper {
 
+            // This function computes an upper bound on the reachability rewards (see Baier et al, CAV'17).
+            template<typename ValueType>
+            inline std::vector<ValueType> computeUpperRewardBounds(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& rewards, std::vector<ValueType> const& oneStepTargetProbabilities) {
+                DsMpiDtmcUpperRewardBoundsComputer<ValueType> dsmpi(transitionMatrix, rewards, oneStepTargetProbabilities);
+                std::vector<ValueType> bounds = dsmpi.computeUpperBounds();
+                return bounds;
+            }
+            
+            template<>
+            inline std::vector<storm::RationalFunction> computeUpperRewardBounds(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, std::vector<storm::RationalFunction> const& rewards, std::vector<storm::RationalFunction> const& oneStepTargetProbabilities) {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Computing upper reward bounds is not supported for rational functions.");
+            }
+            
+            // Solves the equation system of the given maybe states block by block, where the blocks are unions of SCCs
+            // that are solved in reverse topological order. This way, only the block that is currently solved needs to
+            // be represented explicitly. The given values need to contain the values of all states that are not maybe
+            // states. If state rewards are given, the reward of a state is added to its value.
+            template<storm::dd::DdType DdType, typename ValueType>
+            storm::dd::Add<DdType, ValueType> solveEquationSystemBlockwise(Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix, storm::dd::Bdd<DdType> const& maybeStates, storm::dd::Add<DdType, ValueType> values, boost::optional<storm::dd::Add<DdType, ValueType>> const& stateRewards, bool requiresUpperBounds, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory) {
+                std::vector<storm::dd::Bdd<DdType>> blocks = storm::utility::dd::computeBlocksInReverseTopologicalOrder(maybeStates, transitionMatrix.notZero(), model.getRowVariables(), model.getColumnVariables(), env.solver().getHybridMaximalBlockSize());
+                STORM_LOG_INFO("Solving the equation system block-wise with " << blocks.size() << " block(s).");
+                
+                // Check whether we need to create an equation system.
+                bool convertToEquationSystem = linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+                
+                for (auto const& block : blocks) {
+                    storm::dd::Odd odd = block.createOdd();
+                    storm::dd::Add<DdType, ValueType> blockAdd = block.template toAdd<ValueType>();
+                    storm::dd::Add<DdType, ValueType> submatrix = transitionMatrix * blockAdd;
+                    
+                    // All transitions leaving the block lead to states whose values are already known, so their
+                    // contribution can be moved to the right-hand side.
+                    storm::dd::Add<DdType, ValueType> subvector = (submatrix * values.swapVariables(model.getRowColumnMetaVariablePairs())).sumAbstract(model.getColumnVariables());
+                    if (stateRewards) {
+                        subvector += stateRewards.get() * blockAdd;
+                    }
+                    
+                    // For the upper reward bounds, leaving the block corresponds to reaching the target.
+                    boost::optional<storm::dd::Add<DdType, ValueType>> oneStepExitProbs;
+                    if (requiresUpperBounds) {
+                        oneStepExitProbs = (submatrix * (!block && model.getReachableStates()).template toAdd<ValueType>().swapVariables(model.getRowColumnMetaVariablePairs())).sumAbstract(model.getColumnVariables());
+                    }
+                    
+                    submatrix *= blockAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+                    if (convertToEquationSystem) {
+                        submatrix = (model.getRowColumnIdentity() * blockAdd) - submatrix;
+                    }
+                    
+                    std::vector<ValueType> x(odd.getTotalOffset(), storm::utility::convertNumber<ValueType>(0.5));
+                    storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
+                    std::vector<ValueType> b = subvector.toVector(odd);
+                    
+                    boost::optional<std::vector<ValueType>> upperBounds;
+                    if (oneStepExitProbs) {
+                        STORM_LOG_ASSERT(!convertToEquationSystem, "Upper reward bounds required, but the matrix is in the wrong format for the computation.");
+                        upperBounds = computeUpperRewardBounds(explicitSubmatrix, b, oneStepExitProbs->toVector(odd));
+                    }
+                    
+                    std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(explicitSubmatrix));
+                    if (stateRewards) {
+                        solver->setLowerBound(storm::utility::zero<ValueType>());
+                        if (upperBounds) {
+                            solver->setUpperBounds(std::move(upperBounds.get()));
+                        }
+                    } else {
+                        solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
+                    }
+                    solver->solveEquations(env, x, b);
+                    
+                    // Store the values of the block symbolically, so the explicit representation can be dropped.
+                    values += storm::dd::Add<DdType, ValueType>::fromVector(model.getManager(), x, odd, model.getRowVariables());
+                }
+                return values;
+            }
+            
             template<storm::dd::DdType DdType, typename ValueType>
             std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUntilProbabilities(Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix, storm::dd::Bdd<DdType> const& phiStates, storm::dd::Bdd<DdType> const& psiStates, bool qualitative, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory) {
                 // We need to identify the states which have to be taken out of the matrix, i.e. all states that have
@@ -67,6 +146,11 @@ namespace storm {
                         req.clearUpperBounds();
                         STORM_LOG_THROW(req.empty(), storm::exceptions::UncheckedRequirementException, "At least one requirement of the linear equation solver could not be matched.");
                         
+                        if (env.solver().isHybridBlockwise()) {
+                            storm::dd::Add<DdType, ValueType> values = solveEquationSystemBlockwise(env, model, transitionMatrix, maybeStates, statesWithProbability01.second.template toAdd<ValueType>(), boost::none, false, linearEquationSolverFactory);
+                            return std::unique_ptr<CheckResult>(new storm::modelchecker::SymbolicQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), values));
+                        }
+                        
                         // Check whether we need to create an equation system.
                         bool convertToEquationSystem = linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
                         
@@ -203,19 +287,6 @@ namespace storm {
                 return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(), odd, x));
             }
             
-            // This function computes an upper bound on the reachability rewards (see Baier et al, CAV'17).
-            template<typename ValueType>
-            inline std::vector<ValueType> computeUpperRewardBounds(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& rewards, std::vector<ValueType> const& oneStepTargetProbabilities) {
-                DsMpiDtmcUpperRewardBoundsComputer<ValueType> dsmpi(transitionMatrix, rewards, oneStepTargetProbabilities);
-                std::vector<ValueType> bounds = dsmpi.computeUpperBounds();
-                return bounds;
-            }
-            
-            template<>
-            inline std::vector<storm::RationalFunction> computeUpperRewardBounds(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, std::vector<storm::RationalFunction> const& rewards, std::vector<storm::RationalFunction> const& oneStepTargetProbabilities) {
-                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Computing upper reward bounds is not supported for rational functions.");
-            }
-            
             template<storm::dd::DdType DdType, typename ValueType>
             std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeReachabilityRewards(Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix, RewardModelType const& rewardModel, storm::dd::Bdd<DdType> const& targetStates, bool qualitative, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory) {
                 
@@ -264,6 +335,12 @@ namespace storm {
                         }
                         STORM_LOG_THROW(req.empty(), storm::exceptions::UncheckedRequirementException, "At least one requirement of the linear equation solver could not be matched.");
                         
+                        storm::dd::Add<DdType, ValueType> infinityValues = infinityStates.ite(model.getManager().getConstant(storm::utility::infinity<ValueType>()), model.getManager().template getAddZero<ValueType>());
+                        if (env.solver().isHybridBlockwise()) {
+                            storm::dd::Add<DdType, ValueType> values = solveEquationSystemBlockwise(env, model, transitionMatrix, maybeStates, model.getManager().template getAddZero<ValueType>(), subvector, static_cast<bool>(oneStepTargetProbs), linearEquationSolverFactory);
+                            return std::unique_ptr<CheckResult>(new storm::modelchecker::SymbolicQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), infinityValues + values));
+                        }
+                        
                         // Check whether we need to create an equation system.
                         bool convertToEquationSystem = linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
                         
@@ -298,7 +375,7 @@ namespace storm {
                         solver->solveEquations(env, x, b);
                         
                         // Return a hybrid check result that stores the numerical values explicitly.
-                        return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getReachableStates() && !maybeStates, infinityStates.ite(model.getManager().getConstant(storm::utility::infinity<ValueType>()), model.getManager().template getAddZero<ValueType>()), maybeStates, odd, x));
+                        return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getReachableStates() && !maybeStates, infinityValues, maybeStates, odd, x));
                     } else {
                         return std::unique_ptr<CheckResult>(new storm::modelchecker::SymbolicQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), infinityStates.ite(model.getManager().getConstant(storm::utility::infinity<ValueType>()), model.getManager().template getAddZero<ValueType>())));
                     }
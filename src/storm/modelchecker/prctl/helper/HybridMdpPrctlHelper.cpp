@@ -1,6 +1,10 @@
 #include "storm/modelchecker/prctl/helper/HybridMdpPrctlHelper.h"
 
 #include "storm/modelchecker/prctl/helper/SymbolicMdpPrctlHelper.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
@@ -10,6 +14,7 @@
 
 #include "storm/utility/graph.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/dd.h"
 
 #include "storm/models/symbolic/StandardRewardModel.h"
 
@@ -21,6 +26,7 @@
 #include "storm/modelchecker/results/HybridQuantitativeCheckResult.h"
 
 #include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/SolveGoal.h"
 
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
@@ -121,6 +127,72 @@ namespace storm {
                 }
             }
             
+            // Computes the until probabilities of the given maybe states block by block, where the blocks are unions of
+            // SCCs that are solved in reverse topological order. This way, only the block that is currently solved needs
+            // to be represented explicitly. Every block is solved by the sparse engine after adding a target state that
+            // collects the probability to satisfy the formula via a state outside the block and a sink state that collects
+            // the remaining probability.
+            template<storm::dd::DdType DdType, typename ValueType>
+            storm::dd::Add<DdType, ValueType> computeUntilProbabilitiesBlockwise(Environment const& env, OptimizationDirection dir, storm::models::symbolic::NondeterministicModel<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix, storm::dd::Bdd<DdType> const& maybeStates, storm::dd::Bdd<DdType> const& statesWithProbability1, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory) {
+                storm::dd::Bdd<DdType> transitionRelation = transitionMatrix.notZero().existsAbstract(model.getNondeterminismVariables());
+                std::vector<storm::dd::Bdd<DdType>> blocks = storm::utility::dd::computeBlocksInReverseTopologicalOrder(maybeStates, transitionRelation, model.getRowVariables(), model.getColumnVariables(), env.solver().getHybridMaximalBlockSize());
+                STORM_LOG_INFO("Solving the equation system block-wise with " << blocks.size() << " block(s).");
+                
+                storm::dd::Add<DdType, ValueType> values = statesWithProbability1.template toAdd<ValueType>();
+                for (auto const& block : blocks) {
+                    storm::dd::Odd odd = block.createOdd();
+                    storm::dd::Add<DdType, ValueType> blockAdd = block.template toAdd<ValueType>();
+                    storm::dd::Add<DdType, ValueType> submatrix = transitionMatrix * blockAdd;
+                    
+                    // All transitions leaving the block lead to states whose values are already known. As these values are
+                    // probabilities, they can be seen as the probability to move to the target state. The remaining
+                    // probability of a choice (in particular of choices that lead to states with probability zero) is
+                    // moved to the sink state.
+                    storm::dd::Add<DdType, ValueType> targetProbabilities = (submatrix * values.swapVariables(model.getRowColumnMetaVariablePairs())).sumAbstract(model.getColumnVariables());
+                    submatrix *= blockAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+                    std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation = submatrix.toMatrixVector(targetProbabilities, model.getNondeterminismVariables(), odd, odd);
+                    storm::storage::SparseMatrix<ValueType> const& blockMatrix = explicitRepresentation.first;
+                    std::vector<ValueType> const& blockTargetProbabilities = explicitRepresentation.second;
+                    
+                    // Build the matrix with the additional target and sink state.
+                    uint64_t numberOfBlockStates = blockMatrix.getRowGroupCount();
+                    uint64_t targetState = numberOfBlockStates;
+                    uint64_t sinkState = numberOfBlockStates + 1;
+                    storm::storage::SparseMatrixBuilder<ValueType> builder(blockMatrix.getRowCount() + 2, numberOfBlockStates + 2, blockMatrix.getEntryCount() + 2 * blockMatrix.getRowCount() + 2, true, true, numberOfBlockStates + 2);
+                    for (uint64_t state = 0; state < numberOfBlockStates; ++state) {
+                        builder.newRowGroup(blockMatrix.getRowGroupIndices()[state]);
+                        for (uint64_t row = blockMatrix.getRowGroupIndices()[state]; row < blockMatrix.getRowGroupIndices()[state + 1]; ++row) {
+                            ValueType remainingProbability = storm::utility::one<ValueType>() - blockTargetProbabilities[row];
+                            for (auto const& entry : blockMatrix.getRow(row)) {
+                                builder.addNextValue(row, entry.getColumn(), entry.getValue());
+                                remainingProbability -= entry.getValue();
+                            }
+                            if (!storm::utility::isZero(blockTargetProbabilities[row])) {
+                                builder.addNextValue(row, targetState, blockTargetProbabilities[row]);
+                            }
+                            if (remainingProbability > storm::utility::zero<ValueType>()) {
+                                builder.addNextValue(row, sinkState, remainingProbability);
+                            }
+                        }
+                    }
+                    builder.newRowGroup(blockMatrix.getRowCount());
+                    builder.addNextValue(blockMatrix.getRowCount(), targetState, storm::utility::one<ValueType>());
+                    builder.newRowGroup(blockMatrix.getRowCount() + 1);
+                    builder.addNextValue(blockMatrix.getRowCount() + 1, sinkState, storm::utility::one<ValueType>());
+                    storm::storage::SparseMatrix<ValueType> extendedMatrix = builder.build();
+                    
+                    storm::storage::BitVector phiStates(numberOfBlockStates + 2, true);
+                    storm::storage::BitVector psiStates(numberOfBlockStates + 2);
+                    psiStates.set(targetState);
+                    std::vector<ValueType> x = std::move(SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(env, storm::solver::SolveGoal<ValueType>(dir), extendedMatrix, extendedMatrix.transpose(true), phiStates, psiStates, false, false, linearEquationSolverFactory).values);
+                    x.resize(numberOfBlockStates);
+                    
+                    // Store the values of the block symbolically, so the explicit representation can be dropped.
+                    values += storm::dd::Add<DdType, ValueType>::fromVector(model.getManager(), x, odd, model.getRowVariables());
+                }
+                return values;
+            }
+            
             template<storm::dd::DdType DdType, typename ValueType>
             std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeUntilProbabilities(Environment const& env, OptimizationDirection dir, storm::models::symbolic::NondeterministicModel<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix, storm::dd::Bdd<DdType> const& phiStates, storm::dd::Bdd<DdType> const& psiStates, bool qualitative, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory) {
                 // We need to identify the states which have to be taken out of the matrix, i.e. all states that have
@@ -143,6 +215,11 @@ namespace storm {
                 } else {
                     // If there are maybe states, we need to solve an equation system.
                     if (!maybeStates.isZero()) {
+                        if (env.solver().isHybridBlockwise()) {
+                            storm::dd::Add<DdType, ValueType> values = computeUntilProbabilitiesBlockwise(env, dir, model, transitionMatrix, maybeStates, statesWithProbability01.second, linearEquationSolverFactory);
+                            return std::unique_ptr<CheckResult>(new storm::modelchecker::SymbolicQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), values));
+                        }
+                        
                         // If we minimize, we know that the solution to the equation system is unique.
                         bool uniqueSolution = dir == storm::solver::OptimizationDirection::Minimize;
                         // Check for requirements of the solver early so we can adjust the maybe state computation accordingly.
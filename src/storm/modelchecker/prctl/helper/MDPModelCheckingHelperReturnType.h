@@ -3,13 +3,11 @@
 
 #include <vector>
 #include <memory>
+#include <boost/optional.hpp>
+#include "storm/storage/BitVector.h"
 #include "storm/storage/Scheduler.h"
 
 namespace storm {
-    namespace storage {
-        class BitVector;
-    }
-    
     namespace modelchecker {
         namespace helper {
             template<typename ValueType>
@@ -31,6 +29,9 @@ namespace storm {
                 
                 // A scheduler, if it was computed.
                 std::unique_ptr<storm::storage::Scheduler<ValueType>> scheduler;
+                
+                // The states whose values were not determined by the qualitative analysis, if they are known.
+                boost::optional<storm::storage::BitVector> maybeStates;
             };
         }
         
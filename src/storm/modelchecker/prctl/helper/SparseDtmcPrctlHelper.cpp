@@ -26,6 +26,7 @@
 
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/export.h"
 
 #include "storm/utility/macros.h"
@@ -149,13 +150,13 @@ namespace storm {
             }
             
             template<>
-            std::map<storm::storage::sparse::state_type, storm::RationalFunction> SparseDtmcPrctlHelper<storm::RationalFunction>::computeRewardBoundedValues(Environment const& env, storm::models::sparse::Dtmc<storm::RationalFunction> const& model, std::shared_ptr<storm::logic::OperatorFormula const> rewardBoundedFormula, storm::solver::LinearEquationSolverFactory<storm::RationalFunction> const& linearEquationSolverFactory) {
+            std::map<storm::storage::sparse::state_type, storm::RationalFunction> SparseDtmcPrctlHelper<storm::RationalFunction>::computeRewardBoundedValues(Environment const& env, storm::models::sparse::Dtmc<storm::RationalFunction> const& model, std::shared_ptr<storm::logic::OperatorFormula const> rewardBoundedFormula, storm::solver::LinearEquationSolverFactory<storm::RationalFunction> const& linearEquationSolverFactory, uint64_t numberOfThreads) {
                 STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The specified property is not supported by this value type.");
                 return std::map<storm::storage::sparse::state_type, storm::RationalFunction>();
             }
             
             template<typename ValueType, typename RewardModelType>
-            std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeRewardBoundedValues(Environment const& env, storm::models::sparse::Dtmc<ValueType> const& model, std::shared_ptr<storm::logic::OperatorFormula const> rewardBoundedFormula, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory) {
+            std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeRewardBoundedValues(Environment const& env, storm::models::sparse::Dtmc<ValueType> const& model, std::shared_ptr<storm::logic::OperatorFormula const> rewardBoundedFormula, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory, uint64_t numberOfThreads) {
                 storm::utility::Stopwatch swAll(true), swBuild, swCheck;
                 
                 storm::modelchecker::helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true> rewardUnfolding(model, rewardBoundedFormula);
@@ -164,13 +165,25 @@ namespace storm {
                 auto lowerBound = rewardUnfolding.getLowerObjectiveBound();
                 auto upperBound = rewardUnfolding.getUpperObjectiveBound();
                 
-                // Initialize epoch models
+                // Initialize epoch models. The epochs of one wavefront are independent of each other and are solved concurrently.
                 auto initEpoch = rewardUnfolding.getStartEpoch();
-                auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
+                // Exact numbers are reference counted without synchronization, so they must not be shared between threads.
+                if (!std::is_same<ValueType, double>::value && numberOfThreads != 1) {
+                    STORM_LOG_WARN("Solving epochs concurrently is only supported for floating point numbers. Falling back to a single thread.");
+                    numberOfThreads = 1;
+                }
+                storm::utility::ThreadPool threadPool(numberOfThreads);
+                numberOfThreads = threadPool.getNumberOfThreads();
+                auto wavefronts = rewardUnfolding.getEpochComputationWavefronts(initEpoch, numberOfThreads);
+                uint64_t numEpochs = 0;
+                for (auto const& wavefront : wavefronts) {
+                    numEpochs += wavefront.size();
+                }
                 
-                // initialize data that will be needed for each epoch
-                std::vector<ValueType> x, b;
-                std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;
+                // initialize data that will be needed for each epoch (one instance per thread)
+                std::vector<std::vector<ValueType>> x(numberOfThreads), b(numberOfThreads);
+                std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> linEqSolvers(numberOfThreads);
+                std::vector<storm::utility::Stopwatch> swBuildThreads(numberOfThreads), swCheckThreads(numberOfThreads);
 
                 Environment preciseEnv = env;
                 ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
@@ -184,32 +197,42 @@ namespace storm {
                 bool convertToEquationSystem = linearEquationSolverFactory.getEquationProblemFormat(preciseEnv) == solver::LinearEquationSolverProblemFormat::EquationSystem;
                 
                 storm::utility::ProgressMeasurement progress("epochs");
-                progress.setMaxCount(epochOrder.size());
+                progress.setMaxCount(numEpochs);
                 progress.startNewMeasurement(0);
                 uint64_t numCheckedEpochs = 0;
-                for (auto const& epoch : epochOrder) {
-                    swBuild.start();
-                    auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-                    swBuild.stop(); swCheck.start();
-                    // If the epoch matrix is empty we do not need to solve a linear equation system
-                    if ((convertToEquationSystem && epochModel.epochMatrix.isIdentityMatrix()) || (!convertToEquationSystem && epochModel.epochMatrix.getEntryCount() == 0)) {
-                        rewardUnfolding.setSolutionForCurrentEpoch(analyzeTrivialDtmcEpochModel<ValueType>(epochModel));
-                    } else {
-                        rewardUnfolding.setSolutionForCurrentEpoch(analyzeNonTrivialDtmcEpochModel<ValueType>(preciseEnv, epochModel, x, b, linEqSolver, linearEquationSolverFactory, lowerBound, upperBound));
-                    }
-                    swCheck.stop();
-                    if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() && !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
-                        std::vector<ValueType> cdfEntry;
-                        for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
-                            uint64_t offset = rewardUnfolding.getDimension(i).isUpperBounded ? 0 : 1;
-                            cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) * rewardUnfolding.getDimension(i).scalingFactor);
+                for (auto const& wavefront : wavefronts) {
+                    threadPool.execute(wavefront.size(), [&] (uint64_t epochIndex, uint64_t thread) {
+                        swBuildThreads[thread].start();
+                        auto& epochModel = rewardUnfolding.setCurrentEpoch(wavefront[epochIndex], thread);
+                        swBuildThreads[thread].stop(); swCheckThreads[thread].start();
+                        // If the epoch matrix is empty we do not need to solve a linear equation system
+                        if ((convertToEquationSystem && epochModel.epochMatrix.isIdentityMatrix()) || (!convertToEquationSystem && epochModel.epochMatrix.getEntryCount() == 0)) {
+                            rewardUnfolding.setSolutionForCurrentEpoch(analyzeTrivialDtmcEpochModel<ValueType>(epochModel), thread);
+                        } else {
+                            rewardUnfolding.setSolutionForCurrentEpoch(analyzeNonTrivialDtmcEpochModel<ValueType>(preciseEnv, epochModel, x[thread], b[thread], linEqSolvers[thread], linearEquationSolverFactory, lowerBound, upperBound), thread);
+                        }
+                        swCheckThreads[thread].stop();
+                    });
+                    if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet()) {
+                        for (auto const& epoch : wavefront) {
+                            if (!rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
+                                std::vector<ValueType> cdfEntry;
+                                for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
+                                    uint64_t offset = rewardUnfolding.getDimension(i).isUpperBounded ? 0 : 1;
+                                    cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) * rewardUnfolding.getDimension(i).scalingFactor);
+                                }
+                                cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
+                                cdfData.push_back(std::move(cdfEntry));
+                            }
                         }
-                        cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
-                        cdfData.push_back(std::move(cdfEntry));
                     }
-                    ++numCheckedEpochs;
+                    numCheckedEpochs += wavefront.size();
                     progress.updateProgress(numCheckedEpochs);
                 }
+                for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+                    swBuild.addToTime(std::chrono::nanoseconds(swBuildThreads[thread].getTimeInNanoseconds()));
+                    swCheck.addToTime(std::chrono::nanoseconds(swCheckThreads[thread].getTimeInNanoseconds()));
+                }
                 
                 std::map<storm::storage::sparse::state_type, ValueType> result;
                 for (auto const& initState : model.getInitialStates()) {
@@ -231,7 +254,8 @@ namespace storm {
                     STORM_PRINT_AND_LOG("---------------------------------" << std::endl);
                     STORM_PRINT_AND_LOG("Statistics:" << std::endl);
                     STORM_PRINT_AND_LOG("---------------------------------" << std::endl);
-                    STORM_PRINT_AND_LOG("          #checked epochs: " << epochOrder.size() << "." << std::endl);
+                    STORM_PRINT_AND_LOG("          #checked epochs: " << numEpochs << "." << std::endl);
+                    STORM_PRINT_AND_LOG("        #epoch wavefronts: " << wavefronts.size() << "." << std::endl);
                     STORM_PRINT_AND_LOG("             overall Time: " << swAll << "." << std::endl);
                     STORM_PRINT_AND_LOG("Epoch Model building Time: " << swBuild << "." << std::endl);
                     STORM_PRINT_AND_LOG("Epoch Model checking Time: " << swCheck << "." << std::endl);
@@ -31,6 +31,7 @@
 
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/export.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
@@ -183,20 +184,32 @@ namespace storm {
             }
             
             template<typename ValueType>
-            std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<ValueType>::computeRewardBoundedValues(Environment const& env, OptimizationDirection dir, rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>& rewardUnfolding, storm::storage::BitVector const& initialStates, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory) {
+            std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<ValueType>::computeRewardBoundedValues(Environment const& env, OptimizationDirection dir, rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>& rewardUnfolding, storm::storage::BitVector const& initialStates, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory, uint64_t numberOfThreads) {
                 storm::utility::Stopwatch swAll(true), swBuild, swCheck;
                 
                 // Get lower and upper bounds for the solution.
                 auto lowerBound = rewardUnfolding.getLowerObjectiveBound();
                 auto upperBound = rewardUnfolding.getUpperObjectiveBound();
                 
-                // Initialize epoch models
+                // Initialize epoch models. The epochs of one wavefront are independent of each other and are solved concurrently.
                 auto initEpoch = rewardUnfolding.getStartEpoch();
-                auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
-                
-                // initialize data that will be needed for each epoch
-                std::vector<ValueType> x, b;
-                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> minMaxSolver;
+                // Exact numbers are reference counted without synchronization, so they must not be shared between threads.
+                if (!std::is_same<ValueType, double>::value && numberOfThreads != 1) {
+                    STORM_LOG_WARN("Solving epochs concurrently is only supported for floating point numbers. Falling back to a single thread.");
+                    numberOfThreads = 1;
+                }
+                storm::utility::ThreadPool threadPool(numberOfThreads);
+                numberOfThreads = threadPool.getNumberOfThreads();
+                auto wavefronts = rewardUnfolding.getEpochComputationWavefronts(initEpoch, numberOfThreads);
+                uint64_t numEpochs = 0;
+                for (auto const& wavefront : wavefronts) {
+                    numEpochs += wavefront.size();
+                }
+                
+                // initialize data that will be needed for each epoch (one instance per thread)
+                std::vector<std::vector<ValueType>> x(numberOfThreads), b(numberOfThreads);
+                std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> minMaxSolvers(numberOfThreads);
+                std::vector<storm::utility::Stopwatch> swBuildThreads(numberOfThreads), swCheckThreads(numberOfThreads);
 
                 ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
                 Environment preciseEnv = env;
@@ -206,32 +219,42 @@ namespace storm {
                 std::vector<std::vector<ValueType>> cdfData;
 
                 storm::utility::ProgressMeasurement progress("epochs");
-                progress.setMaxCount(epochOrder.size());
+                progress.setMaxCount(numEpochs);
                 progress.startNewMeasurement(0);
                 uint64_t numCheckedEpochs = 0;
-                for (auto const& epoch : epochOrder) {
-                    swBuild.start();
-                    auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-                    swBuild.stop(); swCheck.start();
-                    // If the epoch matrix is empty we do not need to solve a linear equation system
-                    if (epochModel.epochMatrix.getEntryCount() == 0) {
-                        rewardUnfolding.setSolutionForCurrentEpoch(analyzeTrivialMdpEpochModel<ValueType>(dir, epochModel));
-                    } else {
-                        rewardUnfolding.setSolutionForCurrentEpoch(analyzeNonTrivialMdpEpochModel<ValueType>(preciseEnv, dir, epochModel, x, b, minMaxSolver, minMaxLinearEquationSolverFactory, lowerBound, upperBound));
-                    }
-                    swCheck.stop();
-                    if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() && !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
-                        std::vector<ValueType> cdfEntry;
-                        for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
-                            uint64_t offset = rewardUnfolding.getDimension(i).isUpperBounded ? 0 : 1;
-                            cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) * rewardUnfolding.getDimension(i).scalingFactor);
+                for (auto const& wavefront : wavefronts) {
+                    threadPool.execute(wavefront.size(), [&] (uint64_t epochIndex, uint64_t thread) {
+                        swBuildThreads[thread].start();
+                        auto& epochModel = rewardUnfolding.setCurrentEpoch(wavefront[epochIndex], thread);
+                        swBuildThreads[thread].stop(); swCheckThreads[thread].start();
+                        // If the epoch matrix is empty we do not need to solve a linear equation system
+                        if (epochModel.epochMatrix.getEntryCount() == 0) {
+                            rewardUnfolding.setSolutionForCurrentEpoch(analyzeTrivialMdpEpochModel<ValueType>(dir, epochModel), thread);
+                        } else {
+                            rewardUnfolding.setSolutionForCurrentEpoch(analyzeNonTrivialMdpEpochModel<ValueType>(preciseEnv, dir, epochModel, x[thread], b[thread], minMaxSolvers[thread], minMaxLinearEquationSolverFactory, lowerBound, upperBound), thread);
+                        }
+                        swCheckThreads[thread].stop();
+                    });
+                    if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet()) {
+                        for (auto const& epoch : wavefront) {
+                            if (!rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
+                                std::vector<ValueType> cdfEntry;
+                                for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
+                                    uint64_t offset = rewardUnfolding.getDimension(i).isUpperBounded ? 0 : 1;
+                                    cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) * rewardUnfolding.getDimension(i).scalingFactor);
+                                }
+                                cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
+                                cdfData.push_back(std::move(cdfEntry));
+                            }
                         }
-                        cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
-                        cdfData.push_back(std::move(cdfEntry));
                     }
-                    ++numCheckedEpochs;
+                    numCheckedEpochs += wavefront.size();
                     progress.updateProgress(numCheckedEpochs);
                 }
+                for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+                    swBuild.addToTime(std::chrono::nanoseconds(swBuildThreads[thread].getTimeInNanoseconds()));
+                    swCheck.addToTime(std::chrono::nanoseconds(swCheckThreads[thread].getTimeInNanoseconds()));
+                }
                 
                 std::map<storm::storage::sparse::state_type, ValueType> result;
                 for (auto const& initState : initialStates) {
@@ -254,7 +277,8 @@ namespace storm {
                     STORM_PRINT_AND_LOG("---------------------------------" << std::endl);
                     STORM_PRINT_AND_LOG("Statistics:" << std::endl);
                     STORM_PRINT_AND_LOG("---------------------------------" << std::endl);
-                    STORM_PRINT_AND_LOG("          #checked epochs: " << epochOrder.size() << "." << std::endl);
+                    STORM_PRINT_AND_LOG("          #checked epochs: " << numEpochs << "." << std::endl);
+                    STORM_PRINT_AND_LOG("        #epoch wavefronts: " << wavefronts.size() << "." << std::endl);
                     STORM_PRINT_AND_LOG("             overall Time: " << swAll << "." << std::endl);
                     STORM_PRINT_AND_LOG("Epoch Model building Time: " << swBuild << "." << std::endl);
                     STORM_PRINT_AND_LOG("Epoch Model checking Time: " << swCheck << "." << std::endl);
@@ -776,7 +800,11 @@ namespace storm {
                 STORM_LOG_ASSERT((!produceScheduler && !scheduler) || (!scheduler->isPartialScheduler() && scheduler->isDeterministicScheduler() && scheduler->isMemorylessScheduler()), "Unexpected format of obtained scheduler.");
                 
                 // Return result.
-                return MDPSparseModelCheckingHelperReturnType<ValueType>(std::move(result), std::move(scheduler));
+                MDPSparseModelCheckingHelperReturnType<ValueType> returnValue(std::move(result), std::move(scheduler));
+                if (!qualitative) {
+                    returnValue.maybeStates = std::move(qualitativeStateSets.maybeStates);
+                }
+                return returnValue;
             }
 
             template<typename ValueType>
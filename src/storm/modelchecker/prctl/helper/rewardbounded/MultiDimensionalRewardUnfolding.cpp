@@ -1,5 +1,6 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 
+#include <algorithm>
 #include <string>
 #include <set>
 #include <functional>
@@ -59,9 +60,6 @@ namespace storm {
         
                 template<typename ValueType, bool SingleObjectiveMode>
                 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::initialize() {
-                    
-                    maxSolutionsStored = 0;
-                    
                     STORM_LOG_ASSERT(!SingleObjectiveMode || (this->objectives.size() == 1), "Enabled single objective mode but there are multiple objectives.");
                     std::vector<Epoch> epochSteps;
                     initializeObjectives(epochSteps);
@@ -280,16 +278,95 @@ namespace storm {
                     }
                     std::cout << std::endl;
                     */
-                    return std::vector<Epoch>(collectedEpochs.begin(), collectedEpochs.end());
+                    std::vector<Epoch> epochOrder(collectedEpochs.begin(), collectedEpochs.end());
+                    initializeEpochSolutions(epochOrder);
+                    return epochOrder;
                 }
                 
                 template<typename ValueType, bool SingleObjectiveMode>
-                typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::EpochModel& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(Epoch const& epoch) {
+                std::vector<std::vector<typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch>> MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputationWavefronts(Epoch const& startEpoch, uint64_t numberOfThreads) {
+                    std::vector<Epoch> epochOrder = getEpochComputationOrder(startEpoch);
+                    epochModelData.resize(std::max<uint64_t>(numberOfThreads, 1));
+                    
+                    // The epochs of one epoch class are contiguous in the computation order and only depend on epochs of the
+                    // same class or of previous classes. Within a class, an epoch is put into the wavefront after the latest
+                    // wavefront of its successors in this class.
+                    std::vector<std::vector<Epoch>> wavefronts;
+                    std::vector<uint64_t> wavefrontOfEpoch(epochOrder.size());
+                    uint64_t firstEpochOfClass = 0;
+                    uint64_t firstWavefrontOfClass = 0;
+                    for (uint64_t epochIndex = 0; epochIndex < epochOrder.size(); ++epochIndex) {
+                        if (!epochManager.compareEpochClass(epochOrder[epochIndex], epochOrder[firstEpochOfClass])) {
+                            firstEpochOfClass = epochIndex;
+                            firstWavefrontOfClass = wavefronts.size();
+                        }
+                        uint64_t wavefront = firstWavefrontOfClass;
+                        for (auto const& successorIndex : epochSuccessorIndices[epochIndex]) {
+                            STORM_LOG_ASSERT(successorIndex < epochIndex, "The successor of an epoch is not computed before the epoch.");
+                            if (successorIndex >= firstEpochOfClass) {
+                                wavefront = std::max(wavefront, wavefrontOfEpoch[successorIndex] + 1);
+                            }
+                        }
+                        wavefrontOfEpoch[epochIndex] = wavefront;
+                        if (wavefront == wavefronts.size()) {
+                            wavefronts.emplace_back();
+                        }
+                        wavefronts[wavefront].push_back(epochOrder[epochIndex]);
+                    }
+                    STORM_LOG_INFO("Grouped " << epochOrder.size() << " epochs into " << wavefronts.size() << " wavefronts.");
+                    return wavefronts;
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::initializeEpochSolutions(std::vector<Epoch> const& epochOrder) {
+                    epochIndices.clear();
+                    for (uint64_t epochIndex = 0; epochIndex < epochOrder.size(); ++epochIndex) {
+                        epochIndices.emplace(epochOrder[epochIndex], epochIndex);
+                    }
+                    
+                    epochSolutions = std::vector<EpochSolution>(epochOrder.size());
+                    epochSuccessorIndices.assign(epochOrder.size(), std::vector<uint64_t>());
+                    for (uint64_t epochIndex = 0; epochIndex < epochOrder.size(); ++epochIndex) {
+                        epochSolutions[epochIndex].count = 0;
+                    }
+                    for (uint64_t epochIndex = 0; epochIndex < epochOrder.size(); ++epochIndex) {
+                        auto& successorIndices = epochSuccessorIndices[epochIndex];
+                        for (auto const& step : possibleEpochSteps) {
+                            Epoch successorEpoch = epochManager.getSuccessorEpoch(epochOrder[epochIndex], step);
+                            if (successorEpoch != epochOrder[epochIndex]) {
+                                successorIndices.push_back(getEpochIndex(successorEpoch));
+                            }
+                        }
+                        std::sort(successorIndices.begin(), successorIndices.end());
+                        successorIndices.erase(std::unique(successorIndices.begin(), successorIndices.end()), successorIndices.end());
+                        for (auto const& successorIndex : successorIndices) {
+                            ++epochSolutions[successorIndex].count;
+                        }
+                    }
+                    
+                    if (epochModelData.empty()) {
+                        epochModelData.resize(1);
+                    }
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                uint64_t MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochIndex(Epoch const& epoch) const {
+                    auto epochIndexIt = epochIndices.find(epoch);
+                    STORM_LOG_THROW(epochIndexIt != epochIndices.end(), storm::exceptions::UnexpectedException, "The epoch " << epochManager.toString(epoch) << " is not part of the current computation.");
+                    return epochIndexIt->second;
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::EpochModel& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(Epoch const& epoch, uint64_t thread) {
                     STORM_LOG_DEBUG("Setting model for epoch " << epochManager.toString(epoch));
+                    STORM_LOG_ASSERT(thread < epochModelData.size(), "Invalid thread index " << thread << ".");
+                    EpochModelData& data = epochModelData[thread];
+                    EpochModel& epochModel = data.epochModel;
+                    std::vector<uint64_t> const& epochModelToProductChoiceMap = data.epochModelToProductChoiceMap;
                     
                     // Check if we need to update the current epoch class
-                    if (!currentEpoch || !epochManager.compareEpochClass(epoch, currentEpoch.get())) {
-                        setCurrentEpochClass(epoch);
+                    if (!data.currentEpoch || !epochManager.compareEpochClass(epoch, data.currentEpoch.get())) {
+                        setCurrentEpochClass(data, epoch);
                         epochModel.epochMatrixChanged = true;
                     } else {
                         epochModel.epochMatrixChanged = false;
@@ -306,9 +383,9 @@ namespace storm {
                     for (auto const& step : possibleEpochSteps) {
                         Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
                         if (successorEpoch != epoch) {
-                            auto successorSolIt = epochSolutions.find(successorEpoch);
-                            STORM_LOG_ASSERT(successorSolIt != epochSolutions.end(), "Solution for successor epoch does not exist (anymore).");
-                            subSolutions.emplace(successorEpoch, &successorSolIt->second);
+                            EpochSolution const& successorSolution = epochSolutions[getEpochIndex(successorEpoch)];
+                            STORM_LOG_ASSERT(successorSolution.productStateToSolutionVectorMap, "Solution for successor epoch does not exist (anymore).");
+                            subSolutions.emplace(successorEpoch, &successorSolution);
                         }
                     }
                     epochModel.stepSolutions.resize(epochModel.stepChoices.getNumberOfSetBits());
@@ -375,7 +452,7 @@ namespace storm {
                     assert(epochModel.objectiveRewards.back().size() == epochModel.objectiveRewardFilter.back().size());
                     assert(epochModel.stepChoices.getNumberOfSetBits() == epochModel.stepSolutions.size());
                     
-                    currentEpoch = epoch;
+                    data.currentEpoch = epoch;
                     /*
                     std::cout << "Epoch model for epoch " << storm::utility::vector::toString(epoch) << std::endl;
                     std::cout << "Matrix: " << std::endl << epochModel.epochMatrix << std::endl;
@@ -392,7 +469,9 @@ namespace storm {
                 }
                 
                 template<typename ValueType, bool SingleObjectiveMode>
-                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpochClass(Epoch const& epoch) {
+                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpochClass(EpochModelData& data, Epoch const& epoch) {
+                    EpochModel& epochModel = data.epochModel;
+                    std::vector<uint64_t>& epochModelToProductChoiceMap = data.epochModelToProductChoiceMap;
                     EpochClass epochClass = epochManager.getEpochClass(epoch);
                     // std::cout << "Setting epoch class for epoch " << epochManager.toString(epoch) << std::endl;
                     auto productObjectiveRewards = productModel->computeObjectiveRewards(epochClass, objectives);
@@ -529,15 +608,13 @@ namespace storm {
                     for (auto const& productState : productInStates) {
                         toEpochModelInStatesMap[productState] = epochModelStateToInStateMap[productToEpochModelStateMapping[productState]];
                     }
-                    productStateToEpochModelInStateMap = std::make_shared<std::vector<uint64_t> const>(std::move(toEpochModelInStatesMap));
+                    data.productStateToEpochModelInStateMap = std::make_shared<std::vector<uint64_t> const>(std::move(toEpochModelInStatesMap));
                     
                     epochModel.objectiveRewardFilter.clear();
                     for (auto const& objRewards : epochModel.objectiveRewards) {
                         epochModel.objectiveRewardFilter.push_back(storm::utility::vector::filterZero(objRewards));
                         epochModel.objectiveRewardFilter.back().complement();
                     }
-    
-                    epochModelSizes.push_back(epochModel.epochMatrix.getRowGroupCount());
                 }
                 
      
@@ -717,45 +794,34 @@ namespace storm {
 
                 
                 template<typename ValueType, bool SingleObjectiveMode>
-                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions) {
-                    STORM_LOG_ASSERT(currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
-                    STORM_LOG_ASSERT(inStateSolutions.size() == epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
-    
-                    std::set<Epoch> predecessorEpochs, successorEpochs;
-                    for (auto const& step : possibleEpochSteps) {
-                        epochManager.gatherPredecessorEpochs(predecessorEpochs, currentEpoch.get(), step);
-                        successorEpochs.insert(epochManager.getSuccessorEpoch(currentEpoch.get(), step));
-                    }
-                    predecessorEpochs.erase(currentEpoch.get());
-                    successorEpochs.erase(currentEpoch.get());
-                    STORM_LOG_ASSERT(!predecessorEpochs.empty(), "There are no predecessors for the epoch " << epochManager.toString(currentEpoch.get()));
+                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions, uint64_t thread) {
+                    STORM_LOG_ASSERT(thread < epochModelData.size(), "Invalid thread index " << thread << ".");
+                    EpochModelData& data = epochModelData[thread];
+                    STORM_LOG_ASSERT(data.currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
+                    STORM_LOG_ASSERT(inStateSolutions.size() == data.epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+                    uint64_t epochIndex = getEpochIndex(data.currentEpoch.get());
                     
-                    // clean up solutions that are not needed anymore
-                    for (auto const& successorEpoch : successorEpochs) {
-                        auto successorEpochSolutionIt = epochSolutions.find(successorEpoch);
-                        STORM_LOG_ASSERT(successorEpochSolutionIt != epochSolutions.end(), "Solution for successor epoch does not exist (anymore).");
-                        --successorEpochSolutionIt->second.count;
-                        if (successorEpochSolutionIt->second.count == 0) {
-                            epochSolutions.erase(successorEpochSolutionIt);
+                    // clean up solutions that are not needed anymore. As the epochs that are solved concurrently do not depend
+                    // on each other, the last epoch that depends on a solution is the only one accessing it at this point.
+                    for (auto const& successorIndex : epochSuccessorIndices[epochIndex]) {
+                        EpochSolution& successorSolution = epochSolutions[successorIndex];
+                        STORM_LOG_ASSERT(successorSolution.productStateToSolutionVectorMap, "Solution for successor epoch does not exist (anymore).");
+                        if (--successorSolution.count == 0) {
+                            successorSolution.productStateToSolutionVectorMap.reset();
+                            std::vector<SolutionType>().swap(successorSolution.solutions);
                         }
                     }
                     
                     // add the new solution
-                    EpochSolution solution;
-                    solution.count = predecessorEpochs.size();
-                    solution.productStateToSolutionVectorMap = productStateToEpochModelInStateMap;
+                    EpochSolution& solution = epochSolutions[epochIndex];
+                    solution.productStateToSolutionVectorMap = data.productStateToEpochModelInStateMap;
                     solution.solutions = std::move(inStateSolutions);
-                    epochSolutions[currentEpoch.get()] = std::move(solution);
-                    
-                    maxSolutionsStored = std::max((uint64_t) epochSolutions.size(), maxSolutionsStored);
-                    
                 }
                 
                 template<typename ValueType, bool SingleObjectiveMode>
                 typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(Epoch const& epoch, uint64_t const& productState) {
-                    auto epochSolutionIt = epochSolutions.find(epoch);
-                    STORM_LOG_ASSERT(epochSolutionIt != epochSolutions.end(), "Requested unexisting solution for epoch " << epochManager.toString(epoch) << ".");
-                    auto const& epochSolution = epochSolutionIt->second;
+                    auto const& epochSolution = epochSolutions[getEpochIndex(epoch)];
+                    STORM_LOG_ASSERT(epochSolution.productStateToSolutionVectorMap, "Requested unexisting solution for epoch " << epochManager.toString(epoch) << ".");
                     STORM_LOG_ASSERT(productState < epochSolution.productStateToSolutionVectorMap->size(), "Requested solution for epoch " << epochManager.toString(epoch) << " at an unexisting product state.");
                     STORM_LOG_ASSERT((*epochSolution.productStateToSolutionVectorMap)[productState] < epochSolution.solutions.size(), "Requested solution for epoch " << epochManager.toString(epoch) << " at a state for which no solution was stored.");
                     return epochSolution.solutions[(*epochSolution.productStateToSolutionVectorMap)[productState]];
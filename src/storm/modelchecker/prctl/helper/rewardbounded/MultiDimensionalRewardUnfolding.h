@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <unordered_map>
 #include <boost/optional.hpp>
 
 #include "storm/storage/BitVector.h"
@@ -50,9 +52,33 @@ namespace storm {
                     ~MultiDimensionalRewardUnfolding() = default;
                     
                     Epoch getStartEpoch();
+                    
+                    /*!
+                     * Retrieves the epochs that need to be solved for the given start epoch, such that the successor epochs
+                     * of an epoch precede it. Solutions of previous computations are discarded.
+                     */
                     std::vector<Epoch> getEpochComputationOrder(Epoch const& startEpoch);
                     
-                    EpochModel& setCurrentEpoch(Epoch const& epoch);
+                    /*!
+                     * Retrieves the epochs that need to be solved for the given start epoch, grouped into wavefronts. The
+                     * successor epochs of an epoch are contained in earlier wavefronts, so the epochs of one wavefront can
+                     * be solved concurrently, where each thread uses its own index in setCurrentEpoch and
+                     * setSolutionForCurrentEpoch. Solutions of previous computations are discarded.
+                     *
+                     * The epochs of a wavefront belong to the same epoch class, such that every thread only builds the
+                     * epoch model matrix once per epoch class.
+                     *
+                     * @param numberOfThreads The number of threads that set epochs concurrently.
+                     */
+                    std::vector<std::vector<Epoch>> getEpochComputationWavefronts(Epoch const& startEpoch, uint64_t numberOfThreads);
+                    
+                    /*!
+                     * Builds the epoch model for the given epoch. The solutions of all successor epochs have to be set before.
+                     *
+                     * @param thread The index of the calling thread. Concurrent calls require distinct indices that are
+                     * smaller than the number of threads given to getEpochComputationWavefronts.
+                     */
+                    EpochModel& setCurrentEpoch(Epoch const& epoch, uint64_t thread = 0);
                     
                     void setEquationSystemFormatForEpochModel(storm::solver::LinearEquationSolverProblemFormat eqSysFormat);
                     
@@ -67,7 +93,11 @@ namespace storm {
                     boost::optional<ValueType> getUpperObjectiveBound(uint64_t objectiveIndex = 0);
                     boost::optional<ValueType> getLowerObjectiveBound(uint64_t objectiveIndex = 0);
                     
-                    void setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions);
+                    /*!
+                     * Sets the solution for the epoch that was last set by the given thread. Solutions of successor epochs
+                     * are released as soon as all epochs that depend on them are solved.
+                     */
+                    void setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions, uint64_t thread = 0);
                     SolutionType const& getInitialStateResult(Epoch const& epoch); // Assumes that the initial state is unique
                     SolutionType const& getInitialStateResult(Epoch const& epoch, uint64_t initialStateIndex);
                     
@@ -76,7 +106,17 @@ namespace storm {
                     
                 private:
                 
-                    void setCurrentEpochClass(Epoch const& epoch);
+                    /*!
+                     * The epoch model of a thread together with the mappings between the epoch model and the product model.
+                     */
+                    struct EpochModelData {
+                        EpochModel epochModel;
+                        boost::optional<Epoch> currentEpoch;
+                        std::vector<uint64_t> epochModelToProductChoiceMap;
+                        std::shared_ptr<std::vector<uint64_t> const> productStateToEpochModelInStateMap;
+                    };
+                
+                    void setCurrentEpochClass(EpochModelData& data, Epoch const& epoch);
                     void initialize();
                     
                     void initializeObjectives(std::vector<Epoch>& epochSteps);
@@ -101,11 +141,24 @@ namespace storm {
                     
                     SolutionType const& getStateSolution(Epoch const& epoch, uint64_t const& productState);
                     struct EpochSolution {
-                        uint64_t count;
+                        // The number of epochs that depend on this epoch and are not yet solved.
+                        std::atomic<uint64_t> count;
                         std::shared_ptr<std::vector<uint64_t> const> productStateToSolutionVectorMap;
                         std::vector<SolutionType> solutions;
                     };
-                    std::map<Epoch, EpochSolution> epochSolutions;
+                    
+                    /*!
+                     * Prepares the storage of the solutions for the given epochs (in computation order).
+                     */
+                    void initializeEpochSolutions(std::vector<Epoch> const& epochOrder);
+                    uint64_t getEpochIndex(Epoch const& epoch) const;
+                    
+                    // The solutions of the epochs, indexed by the position of the epoch in the computation order.
+                    std::vector<EpochSolution> epochSolutions;
+                    std::unordered_map<Epoch, uint64_t> epochIndices;
+                    // For every epoch, the indices of its successor epochs (other than the epoch itself).
+                    std::vector<std::vector<uint64_t>> epochSuccessorIndices;
+                    
                     EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch);
                     SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState);
                     
@@ -114,12 +167,10 @@ namespace storm {
                     
                     std::unique_ptr<ProductModel<ValueType>> productModel;
                     
-                    std::vector<uint64_t> epochModelToProductChoiceMap;
-                    std::shared_ptr<std::vector<uint64_t> const> productStateToEpochModelInStateMap;
                     std::set<Epoch> possibleEpochSteps;
                     
-                    EpochModel epochModel;
-                    boost::optional<Epoch> currentEpoch;
+                    // The epoch models of the threads.
+                    std::vector<EpochModelData> epochModelData;
                     
                     // In case of DTMCs we have different options for the equation problem format the epoch model will have.
                     boost::optional<storm::solver::LinearEquationSolverProblemFormat> equationSolverProblemFormatForEpochModel;
@@ -128,11 +179,6 @@ namespace storm {
                     
                     std::vector<Dimension<ValueType>> dimensions;
                     std::vector<storm::storage::BitVector> objectiveDimensions;
-                    
-                    
-                    storm::utility::Stopwatch swInit, swFindSol, swInsertSol, swSetEpoch, swSetEpochClass, swAux1, swAux2, swAux3, swAux4;
-                    std::vector<uint64_t> epochModelSizes;
-                    uint64_t maxSolutionsStored;
                 };
             }
         }
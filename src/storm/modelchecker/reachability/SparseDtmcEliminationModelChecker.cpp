@@ -811,18 +811,12 @@ namespace storm {
         void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performPrioritizedStateElimination(std::shared_ptr<StatePriorityQueue>& priorityQueue, storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, std::vector<ValueType>& values, storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly) {
             
             storm::solver::stateelimination::PrioritizedStateEliminator<ValueType> stateEliminator(transitionMatrix, backwardTransitions, priorityQueue, values);
+            stateEliminator.setNumberOfThreads(storm::settings::getModule<storm::settings::modules::EliminationSettings>().getNumberOfThreads());
             
-            while (priorityQueue->hasNext()) {
-                storm::storage::sparse::state_type state = priorityQueue->pop();
-                bool removeForwardTransitions = computeResultsForInitialStatesOnly && !initialStates.get(state);
-                stateEliminator.eliminateState(state, removeForwardTransitions);
-                if (removeForwardTransitions) {
-                    values[state] = storm::utility::zero<ValueType>();
-                }
+            stateEliminator.eliminateAll([&] (storm::storage::sparse::state_type const& state) { return computeResultsForInitialStatesOnly && !initialStates.get(state); });
 #ifdef STORM_DEV
-                STORM_LOG_ASSERT(checkConsistent(transitionMatrix, backwardTransitions), "The forward and backward transition matrices became inconsistent.");
+            STORM_LOG_ASSERT(checkConsistent(transitionMatrix, backwardTransitions), "The forward and backward transition matrices became inconsistent.");
 #endif
-            }
         }
         
         template<typename SparseDtmcModelType>
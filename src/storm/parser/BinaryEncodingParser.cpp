@@ -0,0 +1,182 @@
+#include "storm/parser/BinaryEncodingParser.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "storm/parser/MappedFile.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/BinaryEncoding.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+    namespace parser {
+
+        namespace {
+            /*!
+             * Reads consecutive words and arrays from a memory-mapped file. Every read is checked against the end of
+             * the file, so truncated or corrupted files lead to an exception instead of invalid memory accesses.
+             */
+            class MappedFileReader {
+            public:
+                MappedFileReader(MappedFile const& file) : current(file.getData()), end(file.getDataEnd()) {
+                    // Empty
+                }
+
+                uint64_t readWord() {
+                    uint64_t word;
+                    readBytes(&word, sizeof(word));
+                    return word;
+                }
+
+                template<typename T>
+                std::vector<T> readArray(uint64_t size) {
+                    STORM_LOG_THROW(size <= getRemainingBytes() / sizeof(T), storm::exceptions::WrongFormatException, "Unexpected end of binary model file.");
+                    std::vector<T> result(size);
+                    readBytes(result.data(), size * sizeof(T));
+                    return result;
+                }
+
+                std::string readString() {
+                    uint64_t length = readWord();
+                    uint64_t paddedLength = (length + sizeof(uint64_t) - 1) / sizeof(uint64_t) * sizeof(uint64_t);
+                    STORM_LOG_THROW(length <= paddedLength && paddedLength <= getRemainingBytes(), storm::exceptions::WrongFormatException, "Unexpected end of binary model file.");
+                    std::string result(current, length);
+                    current += paddedLength;
+                    return result;
+                }
+
+                storm::storage::BitVector readBitVector(uint64_t size) {
+                    STORM_LOG_THROW((size + 63) / 64 <= getRemainingBytes() / sizeof(uint64_t), storm::exceptions::WrongFormatException, "Unexpected end of binary model file.");
+                    storm::storage::BitVector result(size);
+                    // The words are transferred directly from the mapping to avoid an intermediate copy.
+                    for (uint64_t index = 0; index < size; index += 64) {
+                        uint64_t numberOfBits = std::min<uint64_t>(64, size - index);
+                        result.setFromInt(index, numberOfBits, readWord() >> (64 - numberOfBits));
+                    }
+                    return result;
+                }
+
+                bool isAtEnd() const {
+                    return current == end;
+                }
+
+            private:
+                uint64_t getRemainingBytes() const {
+                    return end - current;
+                }
+
+                void readBytes(void* target, uint64_t numberOfBytes) {
+                    STORM_LOG_THROW(numberOfBytes <= getRemainingBytes(), storm::exceptions::WrongFormatException, "Unexpected end of binary model file.");
+                    if (numberOfBytes > 0) {
+                        std::memcpy(target, current, numberOfBytes);
+                    }
+                    current += numberOfBytes;
+                }
+
+                char const* current;
+                char const* end;
+            };
+
+            template<typename ValueType>
+            storm::storage::SparseMatrix<ValueType> readMatrix(MappedFileReader& reader) {
+                typedef typename storm::storage::SparseMatrix<ValueType>::index_type index_type;
+                static_assert(sizeof(index_type) == sizeof(uint64_t), "The binary format requires 64 bit indices.");
+
+                uint64_t rowCount = reader.readWord();
+                uint64_t columnCount = reader.readWord();
+                uint64_t entryCount = reader.readWord();
+                bool trivialRowGrouping = reader.readWord() != 0;
+                std::vector<index_type> rowIndications = reader.readArray<index_type>(rowCount + 1);
+                STORM_LOG_THROW(!rowIndications.empty() && rowIndications.front() == 0 && rowIndications.back() == entryCount, storm::exceptions::WrongFormatException, "Invalid row indications in binary model file.");
+                std::vector<storm::storage::MatrixEntry<index_type, ValueType>> columnsAndValues = reader.readArray<storm::storage::MatrixEntry<index_type, ValueType>>(entryCount);
+                // Checking the columns is cheap compared to reading the file and prevents out-of-bounds accesses later on.
+                for (auto const& entry : columnsAndValues) {
+                    STORM_LOG_THROW(entry.getColumn() < columnCount, storm::exceptions::WrongFormatException, "Invalid column " << entry.getColumn() << " in binary model file.");
+                }
+                boost::optional<std::vector<index_type>> rowGroupIndices;
+                if (!trivialRowGrouping) {
+                    uint64_t rowGroupCount = reader.readWord();
+                    rowGroupIndices = reader.readArray<index_type>(rowGroupCount + 1);
+                    STORM_LOG_THROW(!rowGroupIndices->empty() && rowGroupIndices->front() == 0 && rowGroupIndices->back() == rowCount, storm::exceptions::WrongFormatException, "Invalid row group indices in binary model file.");
+                }
+                return storm::storage::SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+            }
+
+            template<typename LabelingType>
+            LabelingType readLabeling(MappedFileReader& reader, uint64_t numberOfItems) {
+                LabelingType labeling(numberOfItems);
+                uint64_t numberOfLabels = reader.readWord();
+                for (uint64_t label = 0; label < numberOfLabels; ++label) {
+                    std::string name = reader.readString();
+                    labeling.addLabel(name, reader.readBitVector(numberOfItems));
+                }
+                return labeling;
+            }
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> BinaryEncodingParser<ValueType, RewardModelType>::parseModel(std::string const& filename) {
+            MappedFile file(filename.c_str());
+            MappedFileReader reader(file);
+
+            // Header
+            std::vector<char> magicBytes = reader.readArray<char>(sizeof(storm::utility::binary::MAGIC));
+            STORM_LOG_THROW(std::equal(magicBytes.begin(), magicBytes.end(), storm::utility::binary::MAGIC), storm::exceptions::WrongFormatException, "File " << filename << " is not a binary model file.");
+            STORM_LOG_THROW(reader.readWord() == storm::utility::binary::BYTE_ORDER_MARK, storm::exceptions::WrongFormatException, "The binary model file " << filename << " was written on a machine with a different byte order.");
+            uint64_t version = reader.readWord();
+            STORM_LOG_THROW(version == storm::utility::binary::VERSION, storm::exceptions::WrongFormatException, "The binary model file " << filename << " has version " << version << " but only version " << storm::utility::binary::VERSION << " is supported.");
+            STORM_LOG_THROW(reader.readWord() == static_cast<uint64_t>(storm::utility::binary::ValueTypeIdentifier<ValueType>::id), storm::exceptions::WrongFormatException, "The binary model file " << filename << " stores values of a different type.");
+            storm::models::ModelType type = storm::utility::binary::getModelType(reader.readWord());
+            uint64_t numberOfStates = reader.readWord();
+            STORM_LOG_TRACE("Model type: " << type << " with " << numberOfStates << " states.");
+
+            storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components(readMatrix<ValueType>(reader));
+            STORM_LOG_THROW(components.transitionMatrix.getRowGroupCount() == numberOfStates, storm::exceptions::WrongFormatException, "The transition matrix does not match the number of states.");
+            uint64_t numberOfChoices = components.transitionMatrix.getRowCount();
+
+            components.stateLabeling = readLabeling<storm::models::sparse::StateLabeling>(reader, numberOfStates);
+
+            uint64_t numberOfRewardModels = reader.readWord();
+            for (uint64_t rewardModel = 0; rewardModel < numberOfRewardModels; ++rewardModel) {
+                std::string name = reader.readString();
+                uint64_t flags = reader.readWord();
+                boost::optional<std::vector<ValueType>> stateRewards;
+                boost::optional<std::vector<ValueType>> stateActionRewards;
+                boost::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
+                if (flags & static_cast<uint64_t>(storm::utility::binary::RewardModelFlags::StateRewards)) {
+                    stateRewards = reader.readArray<ValueType>(numberOfStates);
+                }
+                if (flags & static_cast<uint64_t>(storm::utility::binary::RewardModelFlags::StateActionRewards)) {
+                    stateActionRewards = reader.readArray<ValueType>(numberOfChoices);
+                }
+                if (flags & static_cast<uint64_t>(storm::utility::binary::RewardModelFlags::TransitionRewards)) {
+                    transitionRewards = readMatrix<ValueType>(reader);
+                }
+                components.rewardModels.emplace(name, RewardModelType(std::move(stateRewards), std::move(stateActionRewards), std::move(transitionRewards)));
+            }
+
+            if (reader.readWord() != 0) {
+                components.choiceLabeling = readLabeling<storm::models::sparse::ChoiceLabeling>(reader, numberOfChoices);
+            }
+
+            if (type == storm::models::ModelType::Ctmc) {
+                // The rate matrix is stored, so the rates must not be scaled again.
+                components.rateTransitions = true;
+                components.exitRates = reader.readArray<ValueType>(numberOfStates);
+            } else if (type == storm::models::ModelType::MarkovAutomaton) {
+                components.rateTransitions = false;
+                components.exitRates = reader.readArray<ValueType>(numberOfStates);
+                components.markovianStates = reader.readBitVector(numberOfStates);
+            }
+            STORM_LOG_THROW(reader.isAtEnd(), storm::exceptions::WrongFormatException, "Unexpected data at the end of binary model file " << filename << ".");
+
+            return storm::utility::builder::buildModelFromComponents(type, std::move(components));
+        }
+
+        // Template instantiations.
+        template class BinaryEncodingParser<double>;
+
+    } // namespace parser
+} // namespace storm
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+    namespace parser {
+
+        /*!
+         * Parser for models in the binary format written by the BinaryEncodingExporter.
+         *
+         * The arrays of the transition matrix and the reward models are copied from the file as a whole and the bit
+         * vectors of the labelings word by word, so no textual parsing takes place at all. The sparse matrix and the
+         * labelings own their storage, so the file is only read while parsing and the model does not refer to it.
+         * The format is tied to the byte order and the value type of the machine that wrote it. Only models with
+         * double values are supported.
+         */
+        template<typename ValueType, typename RewardModelType = models::sparse::StandardRewardModel<ValueType>>
+        class BinaryEncodingParser {
+        public:
+
+            /*!
+             * Load a model in binary format from a file and create the model.
+             *
+             * @param file The binary file to be parsed.
+             *
+             * @return A sparse model
+             */
+            static std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> parseModel(std::string const& file);
+        };
+
+    } // namespace parser
+} // namespace storm
@@ -6,15 +6,20 @@
 #include <clocale>
 #include <iostream>
 #include <string>
+#include <algorithm>
+#include <vector>
 
 #include "storm/utility/constants.h"
 #include "storm/utility/cstring.h"
 #include "storm/parser/MappedFile.h"
+#include "storm/parser/ParallelParsingHelper.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/IOSettings.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/utility/macros.h"
@@ -23,10 +28,47 @@ namespace storm {
 
         using namespace storm::utility::cstring;
 
+        namespace {
+            /*!
+             * The information gathered about a chunk of a transition file in the first parallel pass.
+             */
+            struct ChunkInformation {
+                ChunkInformation() : numberOfEntries(0), firstRow(0), lastRow(0), numberOfSkippedRows(0), highestStateIndex(0) {
+                    // Intentionally left empty.
+                }
+
+                // The number of transitions given in the chunk.
+                uint_fast64_t numberOfEntries;
+
+                // The rows of the first and the last transition of the chunk.
+                uint_fast64_t firstRow;
+                uint_fast64_t lastRow;
+
+                // The number of rows between the first and the last row without transitions.
+                uint_fast64_t numberOfSkippedRows;
+
+                // The highest state index occurring in the chunk.
+                uint_fast64_t highestStateIndex;
+            };
+        }
+
         template<typename ValueType>
         storm::storage::SparseMatrix<ValueType> DeterministicSparseTransitionParser<ValueType>::parseDeterministicTransitions(std::string const& filename) {
-            storm::storage::SparseMatrix<ValueType> emptyMatrix;
-            return DeterministicSparseTransitionParser<ValueType>::parse(filename, false, emptyMatrix);
+            return DeterministicSparseTransitionParser<ValueType>::parseDeterministicTransitions(filename, storm::settings::getModule<storm::settings::modules::IOSettings>().getNumberOfParserThreads());
+        }
+
+        template<typename ValueType>
+        storm::storage::SparseMatrix<ValueType> DeterministicSparseTransitionParser<ValueType>::parseDeterministicTransitions(std::string const& filename, uint_fast64_t numberOfThreads) {
+            if (numberOfThreads == 1) {
+                storm::storage::SparseMatrix<ValueType> emptyMatrix;
+                return DeterministicSparseTransitionParser<ValueType>::parse(filename, false, emptyMatrix);
+            }
+
+            // Enforce locale where decimal point is '.'.
+            setlocale(LC_NUMERIC, "C");
+
+            MappedFile file(filename.c_str());
+            return DeterministicSparseTransitionParser<ValueType>::parseTransitionsInParallel(filename, file.getData(), file.getDataEnd(), numberOfThreads);
         }
 
         template<typename ValueType>
@@ -162,6 +204,138 @@ namespace storm {
             return result;
         }
 
+        template<typename ValueType>
+        storm::storage::SparseMatrix<ValueType> DeterministicSparseTransitionParser<ValueType>::parseTransitionsInParallel(std::string const& filename, char const* begin, char const* end, uint_fast64_t numberOfThreads) {
+            typedef typename storm::storage::SparseMatrix<ValueType>::index_type index_type;
+
+            // Skip the format hint if it is there.
+            begin = trimWhitespaces(begin);
+            if (begin[0] < '0' || begin[0] > '9') {
+                begin = forwardToLineEnd(begin);
+                begin = trimWhitespaces(begin);
+            }
+
+            storm::utility::ThreadPool threadPool(numberOfThreads);
+            // Use more chunks than threads such that the load is balanced even if the lines differ in length.
+            std::vector<char const*> chunks = splitAtLineBoundaries(begin, end, threadPool.getNumberOfThreads() * 8);
+            uint_fast64_t numberOfChunks = chunks.size() - 1;
+
+            // First pass: count the transitions and gather the rows at the borders of each chunk.
+            std::vector<ChunkInformation> chunkInformation(numberOfChunks);
+            threadPool.execute(numberOfChunks, [&] (uint64_t chunk, uint64_t) {
+                ChunkInformation& information = chunkInformation[chunk];
+                char const* buf = trimWhitespaces(chunks[chunk]);
+                uint_fast64_t row, col;
+                while (buf < chunks[chunk + 1] && buf[0] != '\0') {
+                    row = checked_strtol(buf, &buf);
+                    col = checked_strtol(buf, &buf);
+                    // The actual read value is not needed here.
+                    checked_strtod(buf, &buf);
+
+                    if (information.numberOfEntries == 0) {
+                        information.firstRow = row;
+                    } else if (row != information.lastRow) {
+                        STORM_LOG_THROW(row > information.lastRow, storm::exceptions::InvalidArgumentException, "The current row " << row << " is smaller than the last one " << information.lastRow << ".");
+                        information.numberOfSkippedRows += row - information.lastRow - 1;
+                    }
+                    information.lastRow = row;
+                    information.highestStateIndex = std::max(information.highestStateIndex, std::max(row, col));
+                    ++information.numberOfEntries;
+
+                    buf = trimWhitespaces(buf);
+                }
+            });
+
+            // Combine the chunks to obtain the position of each chunk in the matrix. Rows without transitions get a
+            // self-loop, so they need an entry as well.
+            std::vector<uint_fast64_t> entryOffsets(numberOfChunks + 1);
+            std::vector<uint_fast64_t> firstRowToStart(numberOfChunks);
+            uint_fast64_t numberOfEntries = 0;
+            uint_fast64_t numberOfDeadlocks = 0;
+            uint_fast64_t highestStateIndex = 0;
+            uint_fast64_t nextRow = 0;
+            for (uint_fast64_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+                ChunkInformation const& information = chunkInformation[chunk];
+                entryOffsets[chunk] = numberOfEntries;
+                if (information.numberOfEntries == 0) {
+                    continue;
+                }
+                if (nextRow > 0 && information.firstRow == nextRow - 1) {
+                    // The chunk continues the row of the previous chunk.
+                    firstRowToStart[chunk] = nextRow;
+                } else {
+                    STORM_LOG_THROW(information.firstRow >= nextRow, storm::exceptions::InvalidArgumentException, "The current row " << information.firstRow << " is smaller than the last one " << nextRow - 1 << ".");
+                    firstRowToStart[chunk] = nextRow;
+                    numberOfDeadlocks += information.firstRow - nextRow;
+                    numberOfEntries += information.firstRow - nextRow;
+                }
+                numberOfDeadlocks += information.numberOfSkippedRows;
+                numberOfEntries += information.numberOfEntries + information.numberOfSkippedRows;
+                highestStateIndex = std::max(highestStateIndex, information.highestStateIndex);
+                nextRow = information.lastRow + 1;
+            }
+            entryOffsets[numberOfChunks] = numberOfEntries;
+
+            // If there was no transition, the file format was wrong.
+            STORM_LOG_THROW(numberOfEntries > 0, storm::exceptions::WrongFormatException, "Error while parsing " << filename << ": empty or erroneous file format.");
+
+            // As for the sequential parser, states after the last given row only appear as targets and keep empty rows.
+            uint_fast64_t firstTrailingRow = nextRow;
+
+            if (numberOfDeadlocks > 0) {
+                bool dontFixDeadlocks = storm::settings::getModule<storm::settings::modules::CoreSettings>().isDontFixDeadlocksSet();
+                STORM_LOG_THROW(!dontFixDeadlocks, storm::exceptions::WrongFormatException, "Error while parsing " << filename << ": " << numberOfDeadlocks << " states do not have outgoing transitions.");
+                STORM_LOG_WARN("Warning while parsing " << filename << ": " << numberOfDeadlocks << " states have no outgoing transitions. Self-loops were inserted.");
+            }
+
+            // Second pass: write the transitions of each chunk directly to its position in the matrix.
+            uint_fast64_t rowCount = highestStateIndex + 1;
+            std::vector<index_type> rowIndications(rowCount + 1);
+            std::vector<storm::storage::MatrixEntry<index_type, ValueType>> columnsAndValues(numberOfEntries);
+            threadPool.execute(numberOfChunks, [&] (uint64_t chunk, uint64_t) {
+                if (chunkInformation[chunk].numberOfEntries == 0) {
+                    return;
+                }
+                uint_fast64_t entry = entryOffsets[chunk];
+                uint_fast64_t nextRowToStart = firstRowToStart[chunk];
+                char const* buf = trimWhitespaces(chunks[chunk]);
+                uint_fast64_t row, col;
+                double val;
+                while (buf < chunks[chunk + 1] && buf[0] != '\0') {
+                    row = checked_strtol(buf, &buf);
+                    col = checked_strtol(buf, &buf);
+                    val = checked_strtod(buf, &buf);
+
+                    if (row >= nextRowToStart) {
+                        // Insert self-loops for all skipped rows and start the new row.
+                        for (; nextRowToStart < row; ++nextRowToStart) {
+                            rowIndications[nextRowToStart] = entry;
+                            columnsAndValues[entry++] = storm::storage::MatrixEntry<index_type, ValueType>(nextRowToStart, storm::utility::one<ValueType>());
+                        }
+                        rowIndications[row] = entry;
+                        nextRowToStart = row + 1;
+                    }
+                    columnsAndValues[entry++] = storm::storage::MatrixEntry<index_type, ValueType>(col, val);
+
+                    buf = trimWhitespaces(buf);
+                }
+                STORM_LOG_ASSERT(entry == entryOffsets[chunk + 1], "Unexpected number of entries in chunk " << chunk << ".");
+            });
+
+            for (uint_fast64_t row = firstTrailingRow; row <= rowCount; ++row) {
+                rowIndications[row] = numberOfEntries;
+            }
+
+            // The transitions of a state may be given in any order, but the matrix requires the columns of a row to be sorted.
+            std::vector<uint_fast64_t> rowBoundaries;
+            for (uint_fast64_t chunk = 0; chunk <= numberOfChunks; ++chunk) {
+                rowBoundaries.push_back(rowCount * chunk / numberOfChunks);
+            }
+            parallel::sortRows<ValueType>(threadPool, rowBoundaries, rowIndications, columnsAndValues);
+
+            return storm::storage::SparseMatrix<ValueType>(rowCount, std::move(rowIndications), std::move(columnsAndValues), boost::none);
+        }
+
         template<typename ValueType>
         typename DeterministicSparseTransitionParser<ValueType>::FirstPassResult DeterministicSparseTransitionParser<ValueType>::firstPass(char const* buf, bool reserveDiagonalElements) {
 
@@ -47,6 +47,19 @@ namespace storm {
              */
             static storm::storage::SparseMatrix<ValueType> parseDeterministicTransitions(std::string const& filename);
 
+            /*!
+             * Load a deterministic transition system from file and create a
+             * sparse adjacency matrix whose entries represent the weights of the edges.
+             *
+             * If more than one thread is used, the file is split into chunks at line boundaries. The chunks are
+             * first scanned concurrently and then parsed concurrently directly into the arrays of the matrix.
+             *
+             * @param filename The path and name of the file to be parsed.
+             * @param numberOfThreads The number of threads (0 for the number of hardware threads).
+             * @return A SparseMatrix containing the parsed transition system.
+             */
+            static storm::storage::SparseMatrix<ValueType> parseDeterministicTransitions(std::string const& filename, uint_fast64_t numberOfThreads);
+
             /*!
              * Load the transition rewards for a deterministic transition system from file and create a
              * sparse adjacency matrix whose entries represent the rewards of the respective transitions.
@@ -84,6 +97,17 @@ namespace storm {
             template<typename MatrixValueType>
             static storm::storage::SparseMatrix<ValueType> parse(std::string const& filename, bool isRewardFile, storm::storage::SparseMatrix<MatrixValueType> const& transitionMatrix);
 
+            /*!
+             * Parses the transitions in the given buffer with several threads.
+             *
+             * @param filename The path and name of the file to be parsed (only used for messages).
+             * @param begin The beginning of the buffer.
+             * @param end The end of the buffer.
+             * @param numberOfThreads The number of threads (0 for the number of hardware threads).
+             * @return A SparseMatrix containing the parsed transition system.
+             */
+            static storm::storage::SparseMatrix<ValueType> parseTransitionsInParallel(std::string const& filename, char const* begin, char const* end, uint_fast64_t numberOfThreads);
+
         };
 
     } // namespace parser
@@ -2,6 +2,10 @@
 
 #include <iostream>
 #include <string>
+#include <cstring>
+#include <clocale>
+#include <algorithm>
+#include <type_traits>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
@@ -14,17 +18,122 @@
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/IOSettings.h"
+#include "storm/parser/MappedFile.h"
+#include "storm/parser/ParallelParsingHelper.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/builder.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/file.h"
+#include "storm/utility/cstring.h"
+#include "storm/utility/ThreadPool.h"
 
 
 namespace storm {
     namespace parser {
 
+        namespace {
+            /*!
+             * Parses the declaration of a state, i.e. a line of the form "state <id> [<rewards>] <labels>".
+             *
+             * @param line The line declaring the state.
+             * @param id The parsed id of the state.
+             * @param rewards The (unparsed) rewards of the state.
+             * @param labels The labels of the state.
+             */
+            void parseStateDeclaration(std::string line, size_t& id, std::vector<std::string>& rewards, std::vector<std::string>& labels) {
+                rewards.clear();
+                labels.clear();
+                line = line.substr(6);
+                size_t posId = line.find(" ");
+                if (posId != std::string::npos) {
+                    id = boost::lexical_cast<size_t>(line.substr(0, posId));
+
+                    // Parse rewards and labels
+                    line = line.substr(posId+1);
+                    // Check for rewards
+                    if (boost::starts_with(line, "[")) {
+                        // Rewards found
+                        size_t posEndReward = line.find(']');
+                        STORM_LOG_THROW(posEndReward != std::string::npos, storm::exceptions::WrongFormatException, "] missing.");
+                        std::string rewardsStr = line.substr(1, posEndReward-1);
+                        STORM_LOG_TRACE("State rewards: " << rewardsStr);
+                        boost::split(rewards, rewardsStr, boost::is_any_of(","));
+                        line = line.substr(posEndReward+1);
+                    }
+                    // Check for labels
+                    boost::split(labels, line, boost::is_any_of(" "));
+                } else {
+                    // Only state id given
+                    id = boost::lexical_cast<size_t>(line);
+                }
+            }
+
+            /*!
+             * Adds a reward model for each of the given state reward vectors.
+             */
+            template<typename ValueType, typename RewardModelType>
+            void addStateRewardModels(storm::storage::sparse::ModelComponents<ValueType, RewardModelType>& modelComponents, std::vector<std::vector<ValueType>>& stateRewards, std::vector<std::string> const& rewardModelNames) {
+                for (uint64_t i = 0; i < stateRewards.size(); ++i) {
+                    std::string rewardModelName;
+                    if (rewardModelNames.size() <= i) {
+                        rewardModelName = "rew" + std::to_string(i);
+                    } else {
+                        rewardModelName = rewardModelNames[i];
+                    }
+                    modelComponents.rewardModels.emplace(rewardModelName, storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewards[i])));
+                }
+            }
+
+            /*!
+             * Retrieves the end of the line starting at the given position.
+             */
+            char const* lineEnd(char const* position, char const* end) {
+                char const* result = static_cast<char const*>(std::memchr(position, '\n', end - position));
+                return result == nullptr ? end : result;
+            }
+
+            /*!
+             * Moves the given position forward to the beginning of the next line that declares a state.
+             */
+            char const* forwardToStateDeclaration(char const* position, char const* end) {
+                while (position < end && std::strncmp(position, "state ", 6) != 0) {
+                    position = std::min(lineEnd(position, end) + 1, end);
+                }
+                return position;
+            }
+
+            /*!
+             * The information gathered about a chunk of states in the first parallel pass.
+             */
+            struct ChunkInformation {
+                ChunkInformation() : numberOfStates(0), numberOfRows(0), numberOfEntries(0), numberOfRewards(0), hasActionRewards(false) {
+                    // Intentionally left empty.
+                }
+
+                uint_fast64_t numberOfStates;
+                uint_fast64_t numberOfRows;
+                uint_fast64_t numberOfEntries;
+
+                // The highest number of rewards given for a state.
+                uint_fast64_t numberOfRewards;
+
+                // Whether rewards are given for an action.
+                bool hasActionRewards;
+            };
+
+            /*!
+             * The position in the model at which a chunk of states begins.
+             */
+            struct ChunkStart {
+                uint_fast64_t state;
+                uint_fast64_t row;
+                uint_fast64_t entry;
+            };
+        }
+
         template<typename ValueType>
         void ValueParser<ValueType>::addParameter(std::string const& parameter) {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Parameters are not supported in this build.");
@@ -53,6 +162,11 @@ namespace storm {
 
         template<typename ValueType, typename RewardModelType>
         std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseModel(std::string const& filename) {
+            return parseModel(filename, storm::settings::getModule<storm::settings::modules::IOSettings>().getNumberOfParserThreads());
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseModel(std::string const& filename, uint_fast64_t numberOfThreads) {
 
             // Load file
             STORM_LOG_INFO("Reading from file " << filename);
@@ -114,7 +228,13 @@ namespace storm {
                     STORM_LOG_THROW(nrStates != 0, storm::exceptions::WrongFormatException, "Nr States has to be declared before model.");
 
                     // Construct model components
-                    modelComponents = parseStates(file, type, nrStates, valueParser, rewardModelNames);
+                    // Only values of type double can be parsed concurrently.
+                    if (numberOfThreads != 1 && std::is_same<ValueType, double>::value) {
+                        uint_fast64_t offset = file.tellg();
+                        modelComponents = parseStatesInParallel(filename, offset, type, nrStates, valueParser, rewardModelNames, numberOfThreads);
+                    } else {
+                        modelComponents = parseStates(file, type, nrStates, valueParser, rewardModelNames);
+                    }
                     break;
                 }
             }
@@ -152,48 +272,29 @@ namespace storm {
                     if (firstState) {
                         firstState = false;
                     } else {
+                        // The first action of the state starts a new row.
                         ++state;
+                        ++row;
                     }
-                    line = line.substr(6);
+                    firstAction = true;
                     size_t parsedId;
-                    size_t posId = line.find(" ");
-                    if (posId != std::string::npos) {
-                        parsedId = boost::lexical_cast<size_t>(line.substr(0, posId));
-
-                        // Parse rewards and labels
-                        line = line.substr(posId+1);
-                        // Check for rewards
-                        if (boost::starts_with(line, "[")) {
-                            // Rewards found
-                            size_t posEndReward = line.find(']');
-                            STORM_LOG_THROW(posEndReward != std::string::npos, storm::exceptions::WrongFormatException, "] missing.");
-                            std::string rewardsStr = line.substr(1, posEndReward-1);
-                            STORM_LOG_TRACE("State rewards: " << rewardsStr);
-                            std::vector<std::string> rewards;
-                            boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                            if (stateRewards.size() < rewards.size()) {
-                                stateRewards.resize(rewards.size(), std::vector<ValueType>(stateSize, storm::utility::zero<ValueType>()));
-                            }
-                            auto stateRewardsIt = stateRewards.begin();
-                            for (auto const& rew : rewards) {
-                                (*stateRewardsIt)[state] = valueParser.parseValue(rew);
-                                ++stateRewardsIt;
-                            }
-                            line = line.substr(posEndReward+1);
-                        }
-                        // Check for labels
-                        std::vector<std::string> labels;
-                        boost::split(labels, line, boost::is_any_of(" "));
-                        for (std::string label : labels) {
-                            if (!modelComponents->stateLabeling.containsLabel(label)) {
-                                modelComponents->stateLabeling.addLabel(label);
-                            }
-                            modelComponents->stateLabeling.addLabelToState(label, state);
-                            STORM_LOG_TRACE("New label: " << label);
+                    std::vector<std::string> rewards;
+                    std::vector<std::string> labels;
+                    parseStateDeclaration(line, parsedId, rewards, labels);
+                    if (stateRewards.size() < rewards.size()) {
+                        stateRewards.resize(rewards.size(), std::vector<ValueType>(stateSize, storm::utility::zero<ValueType>()));
+                    }
+                    auto stateRewardsIt = stateRewards.begin();
+                    for (auto const& rew : rewards) {
+                        (*stateRewardsIt)[state] = valueParser.parseValue(rew);
+                        ++stateRewardsIt;
+                    }
+                    for (std::string const& label : labels) {
+                        if (!modelComponents->stateLabeling.containsLabel(label)) {
+                            modelComponents->stateLabeling.addLabel(label);
                         }
-                    } else {
-                        // Only state id given
-                        parsedId = boost::lexical_cast<size_t>(line);
+                        modelComponents->stateLabeling.addLabelToState(label, state);
+                        STORM_LOG_TRACE("New label: " << label);
                     }
                     STORM_LOG_TRACE("New state " << state);
                     STORM_LOG_ASSERT(state == parsedId, "State ids do not correspond.");
@@ -238,16 +339,169 @@ namespace storm {
             STORM_LOG_TRACE("Finished parsing");
             modelComponents->transitionMatrix = builder.build(row + 1, stateSize, nonDeterministic ? stateSize : 0);
 
-            for (uint64_t i = 0; i < stateRewards.size(); ++i) {
-                std::string rewardModelName;
-                if (rewardModelNames.size() <= i) {
-                    rewardModelName = "rew" + std::to_string(i);
-                } else {
-                    rewardModelName = rewardModelNames[i];
+            addStateRewardModels(*modelComponents, stateRewards, rewardModelNames);
+            STORM_LOG_TRACE("Built matrix");
+            return modelComponents;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseStatesInParallel(std::string const& filename, uint_fast64_t offset, storm::models::ModelType type, size_t stateSize, ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, uint_fast64_t numberOfThreads) {
+            typedef typename storm::storage::SparseMatrix<ValueType>::index_type index_type;
+            using namespace storm::utility::cstring;
+
+            // Enforce locale where decimal point is '.'.
+            setlocale(LC_NUMERIC, "C");
+
+            MappedFile mappedFile(filename.c_str());
+            STORM_LOG_THROW(offset <= mappedFile.getDataSize(), storm::exceptions::WrongFormatException, "No states given in " << filename << ".");
+            char const* begin = mappedFile.getData() + offset;
+            char const* end = mappedFile.getDataEnd();
+
+            // Split the states into chunks that each begin with the declaration of a state.
+            storm::utility::ThreadPool threadPool(numberOfThreads);
+            std::vector<char const*> chunks = splitAtLineBoundaries(begin, end, threadPool.getNumberOfThreads() * 8);
+            for (uint_fast64_t chunk = 1; chunk + 1 < chunks.size(); ++chunk) {
+                chunks[chunk] = forwardToStateDeclaration(chunks[chunk], end);
+            }
+            uint_fast64_t numberOfChunks = chunks.size() - 1;
+
+            // First pass: count the states, rows and transitions of each chunk.
+            std::vector<ChunkInformation> chunkInformation(numberOfChunks);
+            threadPool.execute(numberOfChunks, [&] (uint64_t chunk, uint64_t) {
+                ChunkInformation& information = chunkInformation[chunk];
+                bool firstAction = true;
+                size_t parsedId;
+                std::vector<std::string> rewards;
+                std::vector<std::string> labels;
+                for (char const* buf = chunks[chunk]; buf < chunks[chunk + 1]; buf = lineEnd(buf, chunks[chunk + 1]) + 1) {
+                    if (std::strncmp(buf, "state ", 6) == 0) {
+                        ++information.numberOfStates;
+                        ++information.numberOfRows;
+                        firstAction = true;
+                        parseStateDeclaration(std::string(buf, lineEnd(buf, chunks[chunk + 1])), parsedId, rewards, labels);
+                        information.numberOfRewards = std::max<uint_fast64_t>(information.numberOfRewards, rewards.size());
+                    } else if (std::strncmp(buf, "\taction ", 8) == 0) {
+                        if (firstAction) {
+                            firstAction = false;
+                        } else {
+                            ++information.numberOfRows;
+                        }
+                        information.hasActionRewards |= buf[8] == '[';
+                    } else if (buf != lineEnd(buf, chunks[chunk + 1])) {
+                        STORM_LOG_THROW(information.numberOfStates > 0, storm::exceptions::WrongFormatException, "Transition given before the first state.");
+                        ++information.numberOfEntries;
+                    }
                 }
-                modelComponents->rewardModels.emplace(rewardModelName, storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewards[i])));
+            });
+
+            // Combine the chunks to obtain the position of each chunk in the model.
+            std::vector<ChunkStart> chunkStarts(numberOfChunks);
+            ChunkStart position = {0, 0, 0};
+            uint_fast64_t numberOfRewards = 0;
+            bool hasActionRewards = false;
+            for (uint_fast64_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+                chunkStarts[chunk] = position;
+                position.state += chunkInformation[chunk].numberOfStates;
+                position.row += chunkInformation[chunk].numberOfRows;
+                position.entry += chunkInformation[chunk].numberOfEntries;
+                numberOfRewards = std::max(numberOfRewards, chunkInformation[chunk].numberOfRewards);
+                hasActionRewards |= chunkInformation[chunk].hasActionRewards;
             }
-            STORM_LOG_TRACE("Built matrix");
+            STORM_LOG_THROW(position.state == stateSize, storm::exceptions::WrongFormatException, "Expected " << stateSize << " states, but found " << position.state << ".");
+            STORM_LOG_WARN_COND(!hasActionRewards, "Transition rewards are not parsed.");
+
+            // Second pass: write the states of each chunk directly to their position in the model.
+            auto modelComponents = std::make_shared<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>();
+            bool nonDeterministic = (type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton);
+            uint_fast64_t rowCount = position.row;
+            std::vector<index_type> rowIndications(rowCount + 1);
+            std::vector<storm::storage::MatrixEntry<index_type, ValueType>> columnsAndValues(position.entry);
+            std::vector<index_type> rowGroupIndices(nonDeterministic ? stateSize + 1 : 0);
+            std::vector<std::vector<ValueType>> stateRewards(numberOfRewards, std::vector<ValueType>(stateSize, storm::utility::zero<ValueType>()));
+            // The labels are collected per chunk as the labeling cannot be modified concurrently.
+            std::vector<std::vector<std::pair<std::string, uint_fast64_t>>> chunkLabels(numberOfChunks);
+            threadPool.execute(numberOfChunks, [&] (uint64_t chunk, uint64_t) {
+                uint_fast64_t nextState = chunkStarts[chunk].state;
+                uint_fast64_t nextRow = chunkStarts[chunk].row;
+                uint_fast64_t entry = chunkStarts[chunk].entry;
+                uint_fast64_t state = 0;
+                bool firstAction = true;
+                size_t parsedId;
+                std::vector<std::string> rewards;
+                std::vector<std::string> labels;
+                for (char const* buf = chunks[chunk]; buf < chunks[chunk + 1]; buf = lineEnd(buf, chunks[chunk + 1]) + 1) {
+                    if (std::strncmp(buf, "state ", 6) == 0) {
+                        state = nextState++;
+                        rowIndications[nextRow] = entry;
+                        if (nonDeterministic) {
+                            rowGroupIndices[state] = nextRow;
+                        }
+                        ++nextRow;
+                        firstAction = true;
+
+                        parseStateDeclaration(std::string(buf, lineEnd(buf, chunks[chunk + 1])), parsedId, rewards, labels);
+                        STORM_LOG_THROW(state == parsedId, storm::exceptions::WrongFormatException, "State ids do not correspond.");
+                        auto stateRewardsIt = stateRewards.begin();
+                        for (auto const& rew : rewards) {
+                            (*stateRewardsIt)[state] = valueParser.parseValue(rew);
+                            ++stateRewardsIt;
+                        }
+                        for (std::string& label : labels) {
+                            chunkLabels[chunk].emplace_back(std::move(label), state);
+                        }
+                    } else if (std::strncmp(buf, "\taction ", 8) == 0) {
+                        if (firstAction) {
+                            firstAction = false;
+                        } else {
+                            rowIndications[nextRow++] = entry;
+                        }
+                    } else if (buf != lineEnd(buf, chunks[chunk + 1])) {
+                        // New transition
+                        char const* tmp;
+                        uint_fast64_t target = checked_strtol(buf, &tmp);
+                        tmp = trimWhitespaces(tmp);
+                        STORM_LOG_THROW(tmp[0] == ':', storm::exceptions::WrongFormatException, "':' not found.");
+                        STORM_LOG_THROW(target < stateSize, storm::exceptions::WrongFormatException, "Transition to state " << target << ", but the model has only " << stateSize << " states.");
+                        double value = checked_strtod(tmp + 1, &tmp);
+                        columnsAndValues[entry++] = storm::storage::MatrixEntry<index_type, ValueType>(target, storm::utility::convertNumber<ValueType>(value));
+                    }
+                }
+                STORM_LOG_ASSERT(chunk + 1 == numberOfChunks || entry == chunkStarts[chunk + 1].entry, "Unexpected number of entries in chunk " << chunk << ".");
+            });
+            rowIndications[rowCount] = position.entry;
+            if (nonDeterministic) {
+                rowGroupIndices[stateSize] = rowCount;
+            }
+
+            // The transitions of a choice may be given in any order, but the matrix requires the columns of a row to be sorted.
+            std::vector<uint_fast64_t> rowBoundaries;
+            for (uint_fast64_t chunk = 0; chunk <= numberOfChunks; ++chunk) {
+                rowBoundaries.push_back(rowCount * chunk / numberOfChunks);
+            }
+            parallel::sortRows<ValueType>(threadPool, rowBoundaries, rowIndications, columnsAndValues);
+
+            boost::optional<std::vector<index_type>> optionalRowGroupIndices;
+            if (nonDeterministic) {
+                optionalRowGroupIndices = std::move(rowGroupIndices);
+            }
+            modelComponents->transitionMatrix = storm::storage::SparseMatrix<ValueType>(stateSize, std::move(rowIndications), std::move(columnsAndValues), std::move(optionalRowGroupIndices));
+
+            modelComponents->stateLabeling = storm::models::sparse::StateLabeling(stateSize);
+            for (auto const& labels : chunkLabels) {
+                for (auto const& labelAndState : labels) {
+                    if (!modelComponents->stateLabeling.containsLabel(labelAndState.first)) {
+                        modelComponents->stateLabeling.addLabel(labelAndState.first);
+                    }
+                    modelComponents->stateLabeling.addLabelToState(labelAndState.first, labelAndState.second);
+                }
+            }
+
+            // We parse rates for continuous time models.
+            if (type == storm::models::ModelType::Ctmc) {
+                modelComponents->rateTransitions = true;
+            }
+
+            addStateRewardModels(*modelComponents, stateRewards, rewardModelNames);
             return modelComponents;
         }
 
@@ -64,6 +64,19 @@ namespace storm {
              */
             static std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> parseModel(std::string const& file);
 
+            /*!
+             * Load a model in DRN format from a file and create the model.
+             *
+             * If more than one thread is used and the values are doubles, the states are split into chunks that are
+             * first scanned concurrently and then parsed concurrently directly into the arrays of the transition matrix.
+             *
+             * @param file The DRN file to be parsed.
+             * @param numberOfThreads The number of threads (0 for the number of hardware threads).
+             *
+             * @return A sparse model
+             */
+            static std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> parseModel(std::string const& file, uint_fast64_t numberOfThreads);
+
         private:
 
             /*!
@@ -76,6 +89,20 @@ namespace storm {
              * @return Transition matrix.
              */
             static std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> parseStates(std::istream& file, storm::models::ModelType type, size_t stateSize, ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames);
+
+            /*!
+             * Parse states with several threads and return transition matrix.
+             * This requires the value parser to be usable from several threads concurrently.
+             *
+             * @param filename        The DRN file.
+             * @param offset          The position in the file at which the states begin.
+             * @param type            Model type.
+             * @param stateSize       No. of states
+             * @param numberOfThreads The number of threads (0 for the number of hardware threads).
+             *
+             * @return Transition matrix.
+             */
+            static std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> parseStatesInParallel(std::string const& filename, uint_fast64_t offset, storm::models::ModelType type, size_t stateSize, ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, uint_fast64_t numberOfThreads);
         };
 
     } // namespace parser
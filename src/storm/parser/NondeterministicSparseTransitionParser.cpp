@@ -1,10 +1,14 @@
 #include "storm/parser/NondeterministicSparseTransitionParser.h"
 
 #include <string>
+#include <algorithm>
+#include <clocale>
 
 #include "storm/parser/MappedFile.h"
+#include "storm/parser/ParallelParsingHelper.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/IOSettings.h"
 #include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/OutOfRangeException.h"
 
@@ -12,6 +16,8 @@
 #include "storm/exceptions/WrongFormatException.h"
 
 #include "storm/utility/cstring.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/ThreadPool.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/utility/macros.h"
@@ -20,10 +26,62 @@ namespace storm {
 
         using namespace storm::utility::cstring;
 
+        namespace {
+            /*!
+             * The information gathered about a chunk of a transition file in the first parallel pass.
+             */
+            struct ChunkInformation {
+                ChunkInformation() : numberOfLines(0), firstSource(0), firstChoice(0), lastSource(0), lastChoice(0), numberOfNewRows(0), numberOfSkippedStates(0), highestStateIndex(0) {
+                    // Intentionally left empty.
+                }
+
+                // The number of transitions given in the chunk.
+                uint_fast64_t numberOfLines;
+
+                // The source states and choices of the first and the last transition of the chunk.
+                uint_fast64_t firstSource;
+                uint_fast64_t firstChoice;
+                uint_fast64_t lastSource;
+                uint_fast64_t lastChoice;
+
+                // The number of rows that are started after the first transition of the chunk.
+                uint_fast64_t numberOfNewRows;
+
+                // The number of states between the first and the last source state without transitions.
+                uint_fast64_t numberOfSkippedStates;
+
+                // The highest state index occurring in the chunk.
+                uint_fast64_t highestStateIndex;
+            };
+
+            /*!
+             * The position in the matrix right before the first transition of a chunk.
+             */
+            struct ChunkStart {
+                uint_fast64_t source;
+                uint_fast64_t choice;
+                uint_fast64_t row;
+                uint_fast64_t entry;
+            };
+        }
+
         template<typename ValueType>
         storm::storage::SparseMatrix<ValueType> NondeterministicSparseTransitionParser<ValueType>::parseNondeterministicTransitions(std::string const& filename) {
-            storm::storage::SparseMatrix<ValueType> emptyMatrix;
-            return NondeterministicSparseTransitionParser::parse(filename, false, emptyMatrix);
+            return NondeterministicSparseTransitionParser::parseNondeterministicTransitions(filename, storm::settings::getModule<storm::settings::modules::IOSettings>().getNumberOfParserThreads());
+        }
+
+        template<typename ValueType>
+        storm::storage::SparseMatrix<ValueType> NondeterministicSparseTransitionParser<ValueType>::parseNondeterministicTransitions(std::string const& filename, uint_fast64_t numberOfThreads) {
+            if (numberOfThreads == 1) {
+                storm::storage::SparseMatrix<ValueType> emptyMatrix;
+                return NondeterministicSparseTransitionParser::parse(filename, false, emptyMatrix);
+            }
+
+            // Enforce locale where decimal point is '.'.
+            setlocale(LC_NUMERIC, "C");
+
+            MappedFile file(filename.c_str());
+            return NondeterministicSparseTransitionParser::parseTransitionsInParallel(filename, file.getData(), file.getDataEnd(), numberOfThreads);
         }
 
         template<typename ValueType>
@@ -192,6 +250,162 @@ namespace storm {
             return resultMatrix;
         }
 
+        template<typename ValueType>
+        storm::storage::SparseMatrix<ValueType> NondeterministicSparseTransitionParser<ValueType>::parseTransitionsInParallel(std::string const& filename, char const* begin, char const* end, uint_fast64_t numberOfThreads) {
+            typedef typename storm::storage::SparseMatrix<ValueType>::index_type index_type;
+
+            // Skip the format hint if it is there.
+            begin = trimWhitespaces(begin);
+            if (begin[0] < '0' || begin[0] > '9') {
+                begin = forwardToLineEnd(begin);
+                begin = trimWhitespaces(begin);
+            }
+
+            storm::utility::ThreadPool threadPool(numberOfThreads);
+            // Use more chunks than threads such that the load is balanced even if the lines differ in length.
+            std::vector<char const*> chunks = splitAtLineBoundaries(begin, end, threadPool.getNumberOfThreads() * 8);
+            uint_fast64_t numberOfChunks = chunks.size() - 1;
+
+            // First pass: count the transitions and rows of each chunk and check the format.
+            std::vector<ChunkInformation> chunkInformation(numberOfChunks);
+            threadPool.execute(numberOfChunks, [&] (uint64_t chunk, uint64_t) {
+                ChunkInformation& information = chunkInformation[chunk];
+                char const* buf = trimWhitespaces(chunks[chunk]);
+                uint_fast64_t source, choice, target;
+                double val;
+                while (buf < chunks[chunk + 1] && buf[0] != '\0') {
+                    source = checked_strtol(buf, &buf);
+                    choice = checked_strtol(buf, &buf);
+                    target = checked_strtol(buf, &buf);
+                    val = checked_strtod(buf, &buf);
+                    STORM_LOG_THROW(val >= 0.0 && val <= 1.0, storm::exceptions::WrongFormatException, "Error while parsing " << filename << ": expected a positive probability but got " << val << ".");
+
+                    if (information.numberOfLines == 0) {
+                        information.firstSource = source;
+                        information.firstChoice = choice;
+                    } else {
+                        STORM_LOG_THROW(source >= information.lastSource, storm::exceptions::InvalidArgumentException, "The current source state " << source << " is smaller than the last one " << information.lastSource << ".");
+                        if (source != information.lastSource || choice != information.lastChoice) {
+                            ++information.numberOfNewRows;
+                        }
+                        if (source > information.lastSource + 1) {
+                            information.numberOfSkippedStates += source - information.lastSource - 1;
+                            information.numberOfNewRows += source - information.lastSource - 1;
+                        }
+                    }
+                    information.lastSource = source;
+                    information.lastChoice = choice;
+                    information.highestStateIndex = std::max(information.highestStateIndex, std::max(source, target));
+                    ++information.numberOfLines;
+
+                    // The name of the action may be given in the fourth column, so we skip to the end of the line.
+                    buf = forwardToLineEnd(buf);
+                    buf = trimWhitespaces(buf);
+                }
+            });
+
+            // Combine the chunks to obtain the position of each chunk in the matrix. As for the sequential parser,
+            // the first state implicitly starts the first row.
+            std::vector<ChunkStart> chunkStarts(numberOfChunks);
+            ChunkStart position = {0, 0, 0, 0};
+            uint_fast64_t numberOfDeadlocks = 0;
+            uint_fast64_t highestStateIndex = 0;
+            bool hasTransitions = false;
+            for (uint_fast64_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+                ChunkInformation const& information = chunkInformation[chunk];
+                chunkStarts[chunk] = position;
+                if (information.numberOfLines == 0) {
+                    continue;
+                }
+                STORM_LOG_THROW(information.firstSource >= position.source, storm::exceptions::InvalidArgumentException, "The current source state " << information.firstSource << " is smaller than the last one " << position.source << ".");
+                uint_fast64_t skippedStates = information.numberOfSkippedStates;
+                if (information.firstSource != position.source || information.firstChoice != position.choice) {
+                    ++position.row;
+                }
+                if (information.firstSource > position.source + 1) {
+                    skippedStates += information.firstSource - position.source - 1;
+                    position.row += information.firstSource - position.source - 1;
+                }
+                numberOfDeadlocks += skippedStates;
+                position.row += information.numberOfNewRows;
+                position.entry += information.numberOfLines + skippedStates;
+                position.source = information.lastSource;
+                position.choice = information.lastChoice;
+                highestStateIndex = std::max(highestStateIndex, information.highestStateIndex);
+                hasTransitions = true;
+            }
+            STORM_LOG_THROW(hasTransitions, storm::exceptions::WrongFormatException, "Error while parsing " << filename << ": erroneous file format.");
+
+            if (numberOfDeadlocks > 0) {
+                bool dontFixDeadlocks = storm::settings::getModule<storm::settings::modules::CoreSettings>().isDontFixDeadlocksSet();
+                STORM_LOG_THROW(!dontFixDeadlocks, storm::exceptions::WrongFormatException, "Error while parsing " << filename << ": " << numberOfDeadlocks << " states do not have outgoing transitions.");
+                STORM_LOG_WARN("Warning while parsing " << filename << ": " << numberOfDeadlocks << " states have no outgoing transitions. Self-loops were inserted.");
+            }
+
+            // Second pass: write the transitions of each chunk directly to its position in the matrix.
+            uint_fast64_t rowCount = position.row + 1;
+            std::vector<index_type> rowIndications(rowCount + 1);
+            std::vector<storm::storage::MatrixEntry<index_type, ValueType>> columnsAndValues(position.entry);
+            std::vector<index_type> rowGroupIndices(highestStateIndex + 2);
+            threadPool.execute(numberOfChunks, [&] (uint64_t chunk, uint64_t) {
+                if (chunkInformation[chunk].numberOfLines == 0) {
+                    return;
+                }
+                uint_fast64_t lastSource = chunkStarts[chunk].source;
+                uint_fast64_t lastChoice = chunkStarts[chunk].choice;
+                uint_fast64_t curRow = chunkStarts[chunk].row;
+                uint_fast64_t entry = chunkStarts[chunk].entry;
+                char const* buf = trimWhitespaces(chunks[chunk]);
+                uint_fast64_t source, choice, target;
+                double val;
+                while (buf < chunks[chunk + 1] && buf[0] != '\0') {
+                    source = checked_strtol(buf, &buf);
+                    choice = checked_strtol(buf, &buf);
+                    target = checked_strtol(buf, &buf);
+                    val = checked_strtod(buf, &buf);
+
+                    if (source != lastSource || choice != lastChoice) {
+                        ++curRow;
+                        rowIndications[curRow] = entry;
+                    }
+
+                    // Insert a self-loop for every skipped state.
+                    for (uint_fast64_t node = lastSource + 1; node < source; ++node) {
+                        rowGroupIndices[node] = curRow;
+                        columnsAndValues[entry++] = storm::storage::MatrixEntry<index_type, ValueType>(node, storm::utility::one<ValueType>());
+                        ++curRow;
+                        rowIndications[curRow] = entry;
+                    }
+                    if (source != lastSource) {
+                        rowGroupIndices[source] = curRow;
+                    }
+
+                    columnsAndValues[entry++] = storm::storage::MatrixEntry<index_type, ValueType>(target, val);
+                    lastSource = source;
+                    lastChoice = choice;
+
+                    buf = forwardToLineEnd(buf);
+                    buf = trimWhitespaces(buf);
+                }
+                STORM_LOG_ASSERT(chunk + 1 == numberOfChunks || entry == chunkStarts[chunk + 1].entry, "Unexpected number of entries in chunk " << chunk << ".");
+            });
+            rowIndications[rowCount] = position.entry;
+
+            // States after the last source state only appear as targets and get empty row groups.
+            for (uint_fast64_t state = position.source + 1; state <= highestStateIndex + 1; ++state) {
+                rowGroupIndices[state] = rowCount;
+            }
+
+            // The transitions of a choice may be given in any order, but the matrix requires the columns of a row to be sorted.
+            std::vector<uint_fast64_t> rowBoundaries;
+            for (uint_fast64_t chunk = 0; chunk <= numberOfChunks; ++chunk) {
+                rowBoundaries.push_back(rowCount * chunk / numberOfChunks);
+            }
+            parallel::sortRows<ValueType>(threadPool, rowBoundaries, rowIndications, columnsAndValues);
+
+            return storm::storage::SparseMatrix<ValueType>(highestStateIndex + 1, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+        }
+
         template<typename ValueType>
         template<typename MatrixValueType>
         typename NondeterministicSparseTransitionParser<ValueType>::FirstPassResult NondeterministicSparseTransitionParser<ValueType>::firstPass(char const* buf, bool isRewardFile, storm::storage::SparseMatrix<MatrixValueType> const& modelInformation) {
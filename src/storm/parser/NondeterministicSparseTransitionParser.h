@@ -50,6 +50,17 @@ namespace storm {
              */
             static storm::storage::SparseMatrix<ValueType> parseNondeterministicTransitions(std::string const& filename);
 
+            /*!
+             * Load a nondeterministic transition system from file and create a sparse adjacency matrix whose entries represent the weights of the edges
+             *
+             * If more than one thread is used, the file is split into chunks at line boundaries. The chunks are
+             * first scanned concurrently and then parsed concurrently directly into the arrays of the matrix.
+             *
+             * @param filename The path and name of file to be parsed.
+             * @param numberOfThreads The number of threads (0 for the number of hardware threads).
+             */
+            static storm::storage::SparseMatrix<ValueType> parseNondeterministicTransitions(std::string const& filename, uint_fast64_t numberOfThreads);
+
             /*!
              * Load a nondeterministic transition system from file and create a sparse adjacency matrix whose entries represent the weights of the edges
              *
@@ -91,6 +102,17 @@ namespace storm {
             template<typename MatrixValueType>
             static storm::storage::SparseMatrix<ValueType> parse(std::string const& filename, bool isRewardFile, storm::storage::SparseMatrix<MatrixValueType> const& modelInformation);
 
+            /*!
+             * Parses the transitions in the given buffer with several threads.
+             *
+             * @param filename The path and name of file to be parsed (only used for messages).
+             * @param begin The beginning of the buffer.
+             * @param end The end of the buffer.
+             * @param numberOfThreads The number of threads (0 for the number of hardware threads).
+             * @return A SparseMatrix containing the parsed file contents.
+             */
+            static storm::storage::SparseMatrix<ValueType> parseTransitionsInParallel(std::string const& filename, char const* begin, char const* end, uint_fast64_t numberOfThreads);
+
         };
 
     } // namespace parser
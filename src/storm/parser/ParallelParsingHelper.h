@@ -0,0 +1,44 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/ThreadPool.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace parser {
+        namespace parallel {
+
+            /*!
+             * Sorts the entries of all rows of a matrix that was filled directly according to their columns and checks that
+             * no column appears twice within a row.
+             *
+             * @param threadPool The threads to use.
+             * @param rowBoundaries Non-decreasing row indices that split the rows into ranges that are processed independently.
+             * @param rowIndications The row indications of the matrix.
+             * @param columnsAndValues The entries of the matrix.
+             */
+            template<typename ValueType>
+            void sortRows(storm::utility::ThreadPool& threadPool, std::vector<uint_fast64_t> const& rowBoundaries, std::vector<typename storm::storage::SparseMatrix<ValueType>::index_type> const& rowIndications, std::vector<storm::storage::MatrixEntry<typename storm::storage::SparseMatrix<ValueType>::index_type, ValueType>>& columnsAndValues) {
+                typedef storm::storage::MatrixEntry<typename storm::storage::SparseMatrix<ValueType>::index_type, ValueType> EntryType;
+                auto compareColumns = [] (EntryType const& a, EntryType const& b) { return a.getColumn() < b.getColumn(); };
+                threadPool.execute(rowBoundaries.size() - 1, [&] (uint64_t range, uint64_t) {
+                    for (uint_fast64_t row = rowBoundaries[range]; row < rowBoundaries[range + 1]; ++row) {
+                        auto rowBegin = columnsAndValues.begin() + rowIndications[row];
+                        auto rowEnd = columnsAndValues.begin() + rowIndications[row + 1];
+                        // Entries are usually given in the correct order, so we only sort if necessary.
+                        if (!std::is_sorted(rowBegin, rowEnd, compareColumns)) {
+                            std::sort(rowBegin, rowEnd, compareColumns);
+                        }
+                        auto duplicate = std::adjacent_find(rowBegin, rowEnd, [] (EntryType const& a, EntryType const& b) { return a.getColumn() == b.getColumn(); });
+                        STORM_LOG_THROW(duplicate == rowEnd, storm::exceptions::InvalidArgumentException, "The transition from row " << row << " to column " << duplicate->getColumn() << " is given twice.");
+                    }
+                });
+            }
+
+        }
+    }
+}
@@ -20,6 +20,8 @@ namespace storm {
             const std::string BisimulationSettings::reuseOptionName = "reuse";
             const std::string BisimulationSettings::initialPartitionOptionName = "init";
             const std::string BisimulationSettings::refinementModeOptionName = "refine";
+            const std::string BisimulationSettings::sparseRefinementMethodOptionName = "sparserefine";
+            const std::string BisimulationSettings::threadsOptionName = "threads";
             
             BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> types = { "strong", "weak" };
@@ -50,6 +52,14 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The mode to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(refinementModes))
                                              .setDefaultValueString("full").build())
                                 .build());
+                
+                std::vector<std::string> sparseRefinementMethods = {"splitter", "signature"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, sparseRefinementMethodOptionName, true, "Sets how the partition is refined for sparse models (signature only supports strong bisimulation).")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("method", "The method to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(sparseRefinementMethods))
+                                             .setDefaultValueString("splitter").build())
+                                .build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true, "Sets the number of threads used by the signature-based refinement of sparse models. Exact computations always use a single thread.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 for the number of hardware threads).").setDefaultValueUnsignedInteger(1).build()).build());
             }
             
             bool BisimulationSettings::isStrongBisimulationSet() const {
@@ -118,6 +128,18 @@ namespace storm {
                 return RefinementMode::Full;
             }
 
+            storm::storage::SparseRefinementMethod BisimulationSettings::getSparseRefinementMethod() const {
+                std::string methodAsString = this->getOption(sparseRefinementMethodOptionName).getArgumentByName("method").getValueAsString();
+                if (methodAsString == "signature") {
+                    return storm::storage::SparseRefinementMethod::Signature;
+                }
+                return storm::storage::SparseRefinementMethod::Splitter;
+            }
+            
+            uint_fast64_t BisimulationSettings::getNumberOfThreads() const {
+                return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+
             bool BisimulationSettings::check() const {
                 bool optionsSet = this->getOption(typeOptionName).getHasOptionBeenSet();
                 STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet() || !optionsSet, "Bisimulation minimization is not selected, so setting options for bisimulation has no effect.");
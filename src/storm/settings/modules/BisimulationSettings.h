@@ -4,6 +4,7 @@
 #include "storm/settings/modules/ModuleSettings.h"
 
 #include "storm/storage/dd/bisimulation/SignatureMode.h"
+#include "storm/storage/bisimulation/BisimulationType.h"
 
 namespace storm {
     namespace settings {
@@ -75,6 +76,19 @@ namespace storm {
                  * Retrieves the refinement mode to use.
                  */
                 RefinementMode getRefinementMode() const;
+                
+                /*!
+                 * Retrieves the method used to refine the partition of sparse models.
+                 * NOTE: only applies to sparse bisimulation.
+                 */
+                storm::storage::SparseRefinementMethod getSparseRefinementMethod() const;
+                
+                /*!
+                 * Retrieves the number of threads used by the signature-based refinement of sparse models.
+                 *
+                 * @return The number of threads (zero for the number of hardware threads).
+                 */
+                uint_fast64_t getNumberOfThreads() const;
                                 
                 virtual bool check() const override;
                 
@@ -90,6 +104,8 @@ namespace storm {
                 static const std::string reuseOptionName;
                 static const std::string initialPartitionOptionName;
                 static const std::string refinementModeOptionName;
+                static const std::string sparseRefinementMethodOptionName;
+                static const std::string threadsOptionName;
                 static const std::string parallelismModeOptionName;
             };
         } // namespace modules
@@ -29,6 +29,7 @@ namespace storm {
             const std::string fullModelBuildOptionName = "buildfull";
             const std::string buildChoiceLabelOptionName = "buildchoicelab";
             const std::string buildStateValuationsOptionName = "buildstateval";
+            const std::string buildThreadsOptionName = "buildthreads";
             BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
 
                 std::vector<std::string> explorationOrders = {"dfs", "bfs"};
@@ -42,6 +43,8 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationOrderOptionName, false, "Sets which exploration order to use.").setShortName(explorationOrderOptionShortName)
                                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the exploration order to choose.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(explorationOrders)).setDefaultValueString("bfs").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationChecksOptionName, false, "If set, additional checks (if available) are performed during model exploration to debug the model.").setShortName(explorationChecksOptionShortName).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, buildThreadsOptionName, false, "Sets the number of threads used for the explicit exploration of the state space. Only breadth-first exploration of models with double values is parallelized.")
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means 'auto-detect').").setDefaultValueUnsignedInteger(1).build()).build());
 
             }
 
@@ -88,6 +91,10 @@ namespace storm {
             bool BuildSettings::isExplorationChecksSet() const {
                 return this->getOption(explorationChecksOptionName).getHasOptionBeenSet();
             }
+
+            uint_fast64_t BuildSettings::getNumberOfBuildThreads() const {
+                return this->getOption(buildThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
         }
 
 
@@ -75,6 +75,13 @@ namespace storm {
                  */
                 bool isBuildStateValuationsSet() const;
 
+                /*!
+                 * Retrieves the number of threads to use for the explicit exploration of the state space.
+                 *
+                 * @return The number of threads (where 0 means that the number is to be detected automatically).
+                 */
+                uint_fast64_t getNumberOfBuildThreads() const;
+
 
                 // The name of the module.
                 static const std::string moduleName;
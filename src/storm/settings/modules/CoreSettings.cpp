@@ -34,6 +34,10 @@ namespace storm {
             const std::string CoreSettings::cudaOptionName = "cuda";
             const std::string CoreSettings::intelTbbOptionName = "enable-tbb";
             const std::string CoreSettings::intelTbbOptionShortName = "tbb";
+            const std::string CoreSettings::hybridBlockwiseOptionName = "hybrid-blocks";
+            const std::string CoreSettings::hintCacheOptionName = "cache-results";
+            const std::string CoreSettings::epochThreadsOptionName = "epoch-threads";
+            const std::string CoreSettings::batchTimeBoundsOptionName = "batch-timebounds";
             
             CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(CoreSettings::Engine::Sparse) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, counterexampleOptionName, false, "Generates a counterexample for the given PRCTL formulas if not satisfied by the model.").setShortName(counterexampleOptionShortName).build());
@@ -62,6 +66,13 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, cudaOptionName, false, "Sets whether to use CUDA.").build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, intelTbbOptionName, false, "Sets whether to use Intel TBB (if Storm was built with support for TBB).").setShortName(intelTbbOptionShortName).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, hybridBlockwiseOptionName, false, "Sets whether the hybrid engine converts and solves the model one block of SCCs at a time to bound the size of the explicit representation.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The number of states up to which SCCs are merged into one block.").setDefaultValueUnsignedInteger(100000).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, hintCacheOptionName, false, "Sets whether the sparse engine caches the qualitative analysis and the results of reachability probabilities in MDPs to reuse them for later properties.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("entries", "The number of results that are kept.").setDefaultValueUnsignedInteger(16).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, batchTimeBoundsOptionName, false, "Sets whether the sparse engine checks time-bounded reachability probabilities of CTMCs that share their subformulas (e.g. for several time points) with one transient analysis.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, epochThreadsOptionName, false, "Sets the number of threads that solve independent epochs of reward-bounded properties concurrently. Exact computations always use a single thread.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 for the number of hardware threads).").setDefaultValueUnsignedInteger(1).build()).build());
             }
 
             bool CoreSettings::isCounterexampleSet() const {
@@ -145,6 +156,30 @@ namespace storm {
                 return this->getOption(cudaOptionName).getHasOptionBeenSet();
             }
             
+            bool CoreSettings::isHybridBlockwiseSet() const {
+                return this->getOption(hybridBlockwiseOptionName).getHasOptionBeenSet();
+            }
+            
+            uint64_t CoreSettings::getHybridMaximalBlockSize() const {
+                return this->getOption(hybridBlockwiseOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+            }
+            
+            bool CoreSettings::isHintCacheSet() const {
+                return this->getOption(hintCacheOptionName).getHasOptionBeenSet();
+            }
+            
+            uint64_t CoreSettings::getHintCacheSize() const {
+                return this->getOption(hintCacheOptionName).getArgumentByName("entries").getValueAsUnsignedInteger();
+            }
+            
+            bool CoreSettings::isBatchTimeBoundsSet() const {
+                return this->getOption(batchTimeBoundsOptionName).getHasOptionBeenSet();
+            }
+            
+            uint64_t CoreSettings::getNumberOfEpochThreads() const {
+                return this->getOption(epochThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
             CoreSettings::Engine CoreSettings::getEngine() const {
                 return engine;
             }
@@ -137,6 +137,51 @@ namespace storm {
                  */
                 bool isUseCudaSet() const;
 
+                /*!
+                 * Retrieves whether the hybrid engine is to solve the model block-wise, i.e. to convert and solve one
+                 * block of SCCs at a time instead of the whole model at once.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isHybridBlockwiseSet() const;
+
+                /*!
+                 * Retrieves the number of states up to which the hybrid engine merges SCCs into one block.
+                 *
+                 * @return The maximal size of a block.
+                 */
+                uint64_t getHybridMaximalBlockSize() const;
+
+                /*!
+                 * Retrieves whether the sparse engine is to cache results of reachability probabilities in MDPs and to
+                 * reuse them for later properties.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isHintCacheSet() const;
+
+                /*!
+                 * Retrieves the number of results that are kept in the cache.
+                 *
+                 * @return The size of the cache.
+                 */
+                uint64_t getHintCacheSize() const;
+
+                /*!
+                 * Retrieves whether the sparse engine is to check time-bounded reachability probabilities of CTMCs that
+                 * share their subformulas with one batched transient analysis.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isBatchTimeBoundsSet() const;
+
+                /*!
+                 * Retrieves the number of threads that solve independent epochs of reward-bounded properties concurrently.
+                 *
+                 * @return The number of threads (0 for the number of hardware threads).
+                 */
+                uint64_t getNumberOfEpochThreads() const;
+
                 /*!
                  * Retrieves the selected engine.
                  *
@@ -174,6 +219,10 @@ namespace storm {
                 static const std::string intelTbbOptionName;
                 static const std::string intelTbbOptionShortName;
                 static const std::string cudaOptionName;
+                static const std::string hybridBlockwiseOptionName;
+                static const std::string hintCacheOptionName;
+                static const std::string epochThreadsOptionName;
+                static const std::string batchTimeBoundsOptionName;
             };
 
         } // namespace modules
@@ -18,6 +18,7 @@ namespace storm {
             const std::string EliminationSettings::entryStatesLastOptionName = "entrylast";
             const std::string EliminationSettings::maximalSccSizeOptionName = "sccsize";
             const std::string EliminationSettings::useDedicatedModelCheckerOptionName = "use-dedicated-mc";
+            const std::string EliminationSettings::threadsOptionName = "threads";
             
             EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex"};
@@ -30,6 +31,8 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, maximalSccSizeOptionName, true, "Sets the maximal size of the SCCs for which state elimination is applied.")
                                 .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("maxsize", "The maximal size of an SCC on which state elimination is applied.").setDefaultValueUnsignedInteger(20).setIsOptional(true).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, useDedicatedModelCheckerOptionName, true, "Sets whether to use the dedicated model elimination checker (only DTMCs).").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true, "Sets the number of threads that eliminate independent states concurrently.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 for the number of hardware threads).").setDefaultValueUnsignedInteger(1).build()).build());
             }
             
             EliminationSettings::EliminationMethod EliminationSettings::getEliminationMethod() const {
@@ -77,6 +80,10 @@ namespace storm {
             bool EliminationSettings::isUseDedicatedModelCheckerSet() const {
                 return this->getOption(useDedicatedModelCheckerOptionName).getHasOptionBeenSet();
             }
+            
+            uint_fast64_t EliminationSettings::getNumberOfThreads() const {
+                return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
         } // namespace modules
     } // namespace settings
 } // namespace storm
@@ -61,6 +61,13 @@ namespace storm {
                  * @return True iff the option was set.
                  */
                 bool isUseDedicatedModelCheckerSet() const;
+                
+                /*!
+                 * Retrieves the number of threads that eliminate independent states concurrently.
+                 *
+                 * @return The number of threads (zero for the number of hardware threads).
+                 */
+                uint_fast64_t getNumberOfThreads() const;
 				
                 const static std::string moduleName;
                 
@@ -70,6 +77,7 @@ namespace storm {
                 const static std::string entryStatesLastOptionName;
                 const static std::string maximalSccSizeOptionName;
                 const static std::string useDedicatedModelCheckerOptionName;
+                const static std::string threadsOptionName;
             };
             
         } // namespace modules
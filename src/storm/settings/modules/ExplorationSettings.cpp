@@ -20,6 +20,7 @@ namespace storm {
             const std::string ExplorationSettings::nextStateHeuristicOptionName = "nextstate";
             const std::string ExplorationSettings::precisionOptionName = "precision";
             const std::string ExplorationSettings::precisionOptionShortName = "eps";
+            const std::string ExplorationSettings::threadsOptionName = "threads";
             
             ExplorationSettings::ExplorationSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> types = { "local", "global" };
@@ -32,6 +33,7 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, false, "The precision to achieve.").setShortName(precisionOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The value to use to determine convergence.").setDefaultValueDouble(1e-06).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true, "Sets the number of threads that sample paths concurrently.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 for the number of hardware threads).").setDefaultValueUnsignedInteger(1).build()).build());
             }
             
             bool ExplorationSettings::isLocalPrecomputationSet() const {
@@ -86,11 +88,16 @@ namespace storm {
                 return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
             }
             
+            uint_fast64_t ExplorationSettings::getNumberOfThreads() const {
+                return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
             bool ExplorationSettings::check() const {
                 bool optionsSet = this->getOption(precomputationTypeOptionName).getHasOptionBeenSet() ||
                                     this->getOption(numberOfExplorationStepsUntilPrecomputationOptionName).getHasOptionBeenSet() ||
                                     this->getOption(numberOfSampledPathsUntilPrecomputationOptionName).getHasOptionBeenSet() ||
-                                    this->getOption(nextStateHeuristicOptionName).getHasOptionBeenSet();
+                                    this->getOption(nextStateHeuristicOptionName).getHasOptionBeenSet() ||
+                                    this->getOption(threadsOptionName).getHasOptionBeenSet();
                 STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::settings::modules::CoreSettings::Engine::Exploration || !optionsSet, "Exploration engine is not selected, so setting options for it has no effect.");
                 return true;
             }
@@ -79,6 +79,13 @@ namespace storm {
                  */
                 double getPrecision() const;
                 
+                /*!
+                 * Retrieves the number of threads that sample paths concurrently.
+                 *
+                 * @return The number of threads (zero for the number of hardware threads).
+                 */
+                uint_fast64_t getNumberOfThreads() const;
+                
                 virtual bool check() const override;
                 
                 // The name of the module.
@@ -92,6 +99,7 @@ namespace storm {
                 static const std::string nextStateHeuristicOptionName;
                 static const std::string precisionOptionName;
                 static const std::string precisionOptionShortName;
+                static const std::string threadsOptionName;
             };
         } // namespace modules
     } // namespace settings
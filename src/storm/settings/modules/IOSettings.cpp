@@ -19,6 +19,8 @@ namespace storm {
             const std::string IOSettings::moduleName = "io";
             const std::string IOSettings::exportDotOptionName = "exportdot";
             const std::string IOSettings::exportExplicitOptionName = "exportexplicit";
+            const std::string IOSettings::exportBinaryOptionName = "exportbinary";
+            const std::string IOSettings::exportThreadsOptionName = "exportthreads";
             const std::string IOSettings::exportJaniDotOptionName = "exportjanidot";
             const std::string IOSettings::exportCdfOptionName = "exportcdf";
             const std::string IOSettings::exportCdfOptionShortName = "cdf";
@@ -26,8 +28,11 @@ namespace storm {
             const std::string IOSettings::explicitOptionShortName = "exp";
             const std::string IOSettings::explicitDrnOptionName = "explicit-drn";
             const std::string IOSettings::explicitDrnOptionShortName = "drn";
+            const std::string IOSettings::explicitBinaryOptionName = "explicit-binary";
+            const std::string IOSettings::explicitBinaryOptionShortName = "bin";
             const std::string IOSettings::explicitImcaOptionName = "explicit-imca";
             const std::string IOSettings::explicitImcaOptionShortName = "imca";
+            const std::string IOSettings::parserThreadsOptionName = "parserthreads";
             const std::string IOSettings::prismInputOptionName = "prism";
             const std::string IOSettings::janiInputOptionName = "jani";
             const std::string IOSettings::prismToJaniOptionName = "prism2jani";
@@ -50,17 +55,26 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportJaniDotOptionName, "", "If given, the loaded jani model will be written to the specified file in the dot format.")
                                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file to which the model is to be written.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportCdfOptionName, false, "Exports the cumulative density function for reward bounded properties into a .csv file.").setShortName(exportCdfOptionShortName).addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "A path to an existing directory where the cdf files will be stored.").build()).build());
-                this->addOption(storm::settings::OptionBuilder(moduleName, exportExplicitOptionName, "", "If given, the loaded model will be written to the specified file in the drn format.")
+                this->addOption(storm::settings::OptionBuilder(moduleName, exportExplicitOptionName, "", "If given, the loaded model will be written to the specified file in the drn format. Files ending in .gz are compressed.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "the name of the file to which the model is to be writen.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, exportThreadsOptionName, false, "Sets the number of threads used to format the model when exporting it in the drn format.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 for the number of hardware threads).").setDefaultValueUnsignedInteger(1).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, exportBinaryOptionName, "", "If given, the loaded model will be written to the specified file in the binary format (only for models with double values).")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file to which the model is to be written.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, explicitOptionName, false, "Parses the model given in an explicit (sparse) representation.").setShortName(explicitOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("transition filename", "The name of the file from which to read the transitions.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build())
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("labeling filename", "The name of the file from which to read the state labeling.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, explicitDrnOptionName, false, "Parses the model given in the DRN format.").setShortName(explicitDrnOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("drn filename", "The name of the DRN file containing the model.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build())
                                 .build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, explicitBinaryOptionName, false, "Parses the model given in the binary format written by --" + exportBinaryOptionName + " (only for models with double values).").setShortName(explicitBinaryOptionShortName)
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("binary filename", "The name of the binary file containing the model.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build())
+                                .build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, explicitImcaOptionName, false, "Parses the model given in the IMCA format.").setShortName(explicitImcaOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("imca filename", "The name of the imca file containing the model.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build())
                                 .build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, parserThreadsOptionName, false, "Sets the number of threads used to parse models given in the explicit or the DRN format.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 for the number of hardware threads).").setDefaultValueUnsignedInteger(1).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, prismInputOptionName, false, "Parses the model given in the PRISM format.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file from which to read the PRISM input.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, janiInputOptionName, false, "Parses the model given in the JANI format.")
@@ -107,6 +121,18 @@ namespace storm {
                 return this->getOption(exportExplicitOptionName).getArgumentByName("filename").getValueAsString();
             }
             
+            uint_fast64_t IOSettings::getNumberOfExportThreads() const {
+                return this->getOption(exportThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+
+            bool IOSettings::isExportBinarySet() const {
+                return this->getOption(exportBinaryOptionName).getHasOptionBeenSet();
+            }
+
+            std::string IOSettings::getExportBinaryFilename() const {
+                return this->getOption(exportBinaryOptionName).getArgumentByName("filename").getValueAsString();
+            }
+            
             bool IOSettings::isExportCdfSet() const {
                 return this->getOption(exportCdfOptionName).getHasOptionBeenSet();
             }
@@ -139,6 +165,14 @@ namespace storm {
                 return this->getOption(explicitDrnOptionName).getArgumentByName("drn filename").getValueAsString();
             }
 
+            bool IOSettings::isExplicitBinarySet() const {
+                return this->getOption(explicitBinaryOptionName).getHasOptionBeenSet();
+            }
+
+            std::string IOSettings::getExplicitBinaryFilename() const {
+                return this->getOption(explicitBinaryOptionName).getArgumentByName("binary filename").getValueAsString();
+            }
+
             bool IOSettings::isExplicitIMCASet() const {
                 return this->getOption(explicitImcaOptionName).getHasOptionBeenSet();
             }
@@ -147,6 +181,10 @@ namespace storm {
                 return this->getOption(explicitImcaOptionName).getArgumentByName("imca filename").getValueAsString();
             }
 
+            uint_fast64_t IOSettings::getNumberOfParserThreads() const {
+                return this->getOption(parserThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+
             bool IOSettings::isPrismInputSet() const {
                 return this->getOption(prismInputOptionName).getHasOptionBeenSet();
             }
@@ -233,11 +271,12 @@ namespace storm {
 
                 // Ensure that not two explicit input models were given.
                 STORM_LOG_THROW(!isExplicitSet() || !isExplicitDRNSet(), storm::exceptions::InvalidSettingsException, "Explicit model ");
+                STORM_LOG_THROW(!isExplicitBinarySet() || (!isExplicitSet() && !isExplicitDRNSet()), storm::exceptions::InvalidSettingsException, "Explicit model ");
 
                 STORM_LOG_THROW(!isExportJaniDotSet() || isJaniInputSet(), storm::exceptions::InvalidSettingsException, "Jani-to-dot export is only available for jani models" );
 
                 // Ensure that the model was given either symbolically or explicitly.
-                STORM_LOG_THROW(!isJaniInputSet() || !isPrismInputSet() || !isExplicitSet() || !isExplicitDRNSet(), storm::exceptions::InvalidSettingsException, "The model may be either given in an explicit or a symbolic format (PRISM or JANI), but not both.");
+                STORM_LOG_THROW(!isJaniInputSet() || !isPrismInputSet() || !isExplicitSet() || !isExplicitDRNSet() || !isExplicitBinarySet(), storm::exceptions::InvalidSettingsException, "The model may be either given in an explicit or a symbolic format (PRISM or JANI), but not both.");
                 
                 // Make sure PRISM-to-JANI conversion is only set if the actual input is in PRISM format.
                 STORM_LOG_THROW(!isPrismToJaniSet() || isPrismInputSet(), storm::exceptions::InvalidSettingsException, "For the transformation from PRISM to JANI, the input model must be given in the prism format.");
@@ -62,6 +62,27 @@ namespace storm {
                  * @return The name of the file in which to write the exported mode.
                  */
                 std::string getExportExplicitFilename() const;
+
+                /*!
+                 * Retrieves the number of threads used to format the model when exporting it in the drn format.
+                 *
+                 * @return The number of threads (zero for the number of hardware threads).
+                 */
+                uint_fast64_t getNumberOfExportThreads() const;
+
+                /*!
+                 * Retrieves whether the export-to-binary option was set
+                 *
+                 * @return True if the export-to-binary option was set
+                 */
+                bool isExportBinarySet() const;
+
+                /*!
+                 * Retrieves the name in which to write the model in binary format, if the option was set.
+                 *
+                 * @return The name of the file in which to write the exported model.
+                 */
+                std::string getExportBinaryFilename() const;
                 
                 /*!
                  * Retrieves whether the cumulative density function for reward bounded properties should be exported
@@ -109,6 +130,20 @@ namespace storm {
                  * @return The name of the DRN file that contains the model.
                  */
                 std::string getExplicitDRNFilename() const;
+
+                /*!
+                 * Retrieves whether the explicit option with the binary format was set.
+                 *
+                 * @return True if the explicit option with the binary format was set.
+                 */
+                bool isExplicitBinarySet() const;
+
+                /*!
+                 * Retrieves the name of the file that contains the model in the binary format.
+                 *
+                 * @return The name of the binary file that contains the model.
+                 */
+                std::string getExplicitBinaryFilename() const;
                 
                 /*!
                  * Retrieves whether the explicit option with IMCA was set.
@@ -124,6 +159,13 @@ namespace storm {
                  */
                 std::string getExplicitIMCAFilename() const;
 
+                /*!
+                 * Retrieves the number of threads used to parse models given in the explicit or the DRN format.
+                 *
+                 * @return The number of threads (zero for the number of hardware threads).
+                 */
+                uint_fast64_t getNumberOfParserThreads() const;
+
                 /*!
                  * Retrieves whether the PRISM language option was set.
                  *
@@ -270,14 +312,19 @@ namespace storm {
                 static const std::string exportDotOptionName;
                 static const std::string exportJaniDotOptionName;
                 static const std::string exportExplicitOptionName;
+                static const std::string exportBinaryOptionName;
+                static const std::string exportThreadsOptionName;
                 static const std::string exportCdfOptionName;
                 static const std::string exportCdfOptionShortName;
                 static const std::string explicitOptionName;
                 static const std::string explicitOptionShortName;
                 static const std::string explicitDrnOptionName;
                 static const std::string explicitDrnOptionShortName;
+                static const std::string explicitBinaryOptionName;
+                static const std::string explicitBinaryOptionShortName;
                 static const std::string explicitImcaOptionName;
                 static const std::string explicitImcaOptionShortName;
+                static const std::string parserThreadsOptionName;
                 static const std::string prismInputOptionName;
                 static const std::string janiInputOptionName;
                 static const std::string prismToJaniOptionName;
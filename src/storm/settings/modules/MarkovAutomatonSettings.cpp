@@ -13,10 +13,13 @@ namespace storm {
             
             const std::string MarkovAutomatonSettings::moduleName = "ma";
             const std::string MarkovAutomatonSettings::techniqueOptionName = "technique";
+            const std::string MarkovAutomatonSettings::threadsOptionName = "threads";
             
             MarkovAutomatonSettings::MarkovAutomatonSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> techniques = {"imca", "unifplus"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, techniqueOptionName, true, "The technique to use to solve bounded reachability queries.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the technique to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(techniques)).setDefaultValueString("imca").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true, "Sets the number of threads that compute the vectors of Unif+ concurrently.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 for the number of hardware threads).").setDefaultValueUnsignedInteger(1).build()).build());
             }
             
             MarkovAutomatonSettings::BoundedReachabilityTechnique MarkovAutomatonSettings::getTechnique() const {
@@ -26,6 +29,10 @@ namespace storm {
                 }
                 return MarkovAutomatonSettings::BoundedReachabilityTechnique::UnifPlus;
             }
+            
+            uint_fast64_t MarkovAutomatonSettings::getNumberOfThreads() const {
+                return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
         
         }
     }
@@ -25,12 +25,20 @@ namespace storm {
                  */
                 BoundedReachabilityTechnique getTechnique() const;
                 
+                /*!
+                 * Retrieves the number of threads that compute the vectors of Unif+ concurrently.
+                 *
+                 * @return The number of threads (zero for the number of hardware threads).
+                 */
+                uint_fast64_t getNumberOfThreads() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
             private:
                 // Define the string names of the options as constants.
                 static const std::string techniqueOptionName;
+                static const std::string threadsOptionName;
             };
             
         }
@@ -19,6 +19,8 @@ namespace storm {
             const std::string MinMaxEquationSolverSettings::absoluteOptionName = "absolute";
             const std::string MinMaxEquationSolverSettings::lraMethodOptionName = "lramethod";
             const std::string MinMaxEquationSolverSettings::valueIterationMultiplicationStyleOptionName = "vimult";
+            const std::string MinMaxEquationSolverSettings::valueIterationThreadsOptionName = "vithreads";
+            const std::string MinMaxEquationSolverSettings::valueIterationArithmeticOptionName = "viarith";
 
             MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> minMaxSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration", "linear-programming", "lp", "ratsearch"};
@@ -38,6 +40,13 @@ namespace storm {
                 std::vector<std::string> multiplicationStyles = {"gaussseidel", "regular", "gs", "r"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, valueIterationMultiplicationStyleOptionName, false, "Sets which method multiplication style to prefer for value iteration.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplication style.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(multiplicationStyles)).setDefaultValueString("gaussseidel").build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, valueIterationThreadsOptionName, false, "Sets the number of threads used for value iteration and topological solving. If more than one thread is used, value iteration uses regular multiplications.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 for the number of hardware threads).").setDefaultValueUnsignedInteger(1).build()).build());
+                
+                std::vector<std::string> arithmetics = {"double", "single", "mixed"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, valueIterationArithmeticOptionName, true, "Sets the arithmetic of (non-sound) value iteration. 'single' iterates in single precision, 'mixed' iterates in single precision until convergence and then continues in double precision.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the arithmetic.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(arithmetics)).setDefaultValueString("double").build()).build());
             }
             
             storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvingMethod() const {
@@ -106,6 +115,22 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown multiplication style '" << multiplicationStyleString << "'.");
             }
             
+            uint_fast64_t MinMaxEquationSolverSettings::getNumberOfValueIterationThreads() const {
+                return this->getOption(valueIterationThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            storm::solver::ValueIterationArithmetic MinMaxEquationSolverSettings::getValueIterationArithmetic() const {
+                std::string arithmeticString = this->getOption(valueIterationArithmeticOptionName).getArgumentByName("name").getValueAsString();
+                if (arithmeticString == "double") {
+                    return storm::solver::ValueIterationArithmetic::Double;
+                } else if (arithmeticString == "single") {
+                    return storm::solver::ValueIterationArithmetic::Single;
+                } else if (arithmeticString == "mixed") {
+                    return storm::solver::ValueIterationArithmetic::Mixed;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown value iteration arithmetic '" << arithmeticString << "'.");
+            }
+            
         }
     }
 }
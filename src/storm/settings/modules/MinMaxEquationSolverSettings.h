@@ -5,6 +5,7 @@
 
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/MultiplicationStyle.h"
+#include "storm/solver/ValueIterationArithmetic.h"
 
 namespace storm {
     namespace settings {
@@ -97,6 +98,20 @@ namespace storm {
                  */
                 storm::solver::MultiplicationStyle getValueIterationMultiplicationStyle() const;
                 
+                /*!
+                 * Retrieves the number of threads to use for value iteration.
+                 *
+                 * @return The number of threads. If zero, the number of hardware threads is to be used.
+                 */
+                uint_fast64_t getNumberOfValueIterationThreads() const;
+                
+                /*!
+                 * Retrieves the arithmetic to use for value iteration on double-precision equation systems.
+                 *
+                 * @return The arithmetic.
+                 */
+                storm::solver::ValueIterationArithmetic getValueIterationArithmetic() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
@@ -108,6 +123,8 @@ namespace storm {
                 static const std::string absoluteOptionName;
                 static const std::string lraMethodOptionName;
                 static const std::string valueIterationMultiplicationStyleOptionName;
+                static const std::string valueIterationThreadsOptionName;
+                static const std::string valueIterationArithmeticOptionName;
             };
             
         }
@@ -10,6 +10,7 @@
 
 #include "storm/utility/macros.h"
 #include "storm/exceptions/IllegalArgumentValueException.h"
+#include "storm/exceptions/InvalidSettingsException.h"
 
 namespace storm {
     namespace settings {
@@ -23,6 +24,7 @@ namespace storm {
             const std::string NativeEquationSolverSettings::precisionOptionName = "precision";
             const std::string NativeEquationSolverSettings::absoluteOptionName = "absolute";
             const std::string NativeEquationSolverSettings::powerMethodMultiplicationStyleOptionName = "powmult";
+            const std::string NativeEquationSolverSettings::compactMatrixLayoutOptionName = "compactlayout";
 
             NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> methods = { "jacobi", "gaussseidel", "sor", "walkerchae", "power", "ratsearch" };
@@ -39,6 +41,10 @@ namespace storm {
                 std::vector<std::string> multiplicationStyles = {"gaussseidel", "regular", "gs", "r"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, powerMethodMultiplicationStyleOptionName, false, "Sets which method multiplication style to prefer for the power method.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplication style.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(multiplicationStyles)).setDefaultValueString("gaussseidel").build()).build());
+                
+                std::vector<std::string> simdKernels = {"auto", "none", "avx2", "avx512"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, compactMatrixLayoutOptionName, true, "If set, matrix-vector multiplications are performed on a compact copy of the matrix.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("simd", "The vector instructions to use for the multiplications.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(simdKernels)).setDefaultValueString("auto").setIsOptional(true).build()).build());
             }
             
             bool NativeEquationSolverSettings::isLinearEquationSystemTechniqueSet() const {
@@ -105,9 +111,31 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown multiplication style '" << multiplicationStyleString << "'.");
             }
             
+            bool NativeEquationSolverSettings::isCompactMatrixLayoutSet() const {
+                return this->getOption(compactMatrixLayoutOptionName).getHasOptionBeenSet();
+            }
+            
+            storm::utility::simd::SimdKernel NativeEquationSolverSettings::getCompactMatrixLayoutKernel() const {
+                std::string kernelString = this->getOption(compactMatrixLayoutOptionName).getArgumentByName("simd").getValueAsString();
+                storm::utility::simd::SimdKernel kernel = storm::utility::simd::SimdKernel::None;
+                if (kernelString == "auto") {
+                    return storm::utility::simd::getBestSupportedKernel();
+                } else if (kernelString == "none") {
+                    kernel = storm::utility::simd::SimdKernel::None;
+                } else if (kernelString == "avx2") {
+                    kernel = storm::utility::simd::SimdKernel::Avx2;
+                } else if (kernelString == "avx512") {
+                    kernel = storm::utility::simd::SimdKernel::Avx512;
+                } else {
+                    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown SIMD kernel '" << kernelString << "'.");
+                }
+                STORM_LOG_THROW(storm::utility::simd::isSupported(kernel), storm::exceptions::InvalidSettingsException, "The " << kernel << " kernel is not supported on this machine.");
+                return kernel;
+            }
+            
             bool NativeEquationSolverSettings::check() const {
                 // This list does not include the precision, because this option is shared with other modules.
-                bool optionSet = isLinearEquationSystemTechniqueSet() || isMaximalIterationCountSet() || isConvergenceCriterionSet();
+                bool optionSet = isLinearEquationSystemTechniqueSet() || isMaximalIterationCountSet() || isConvergenceCriterionSet() || isCompactMatrixLayoutSet();
                 
                 STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver() == storm::solver::EquationSolverType::Native || !optionSet, "Native is not selected as the preferred equation solver, so setting options for native might have no effect.");
                 
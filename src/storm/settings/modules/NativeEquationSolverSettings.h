@@ -5,6 +5,7 @@
 
 #include "storm/solver/MultiplicationStyle.h"
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/utility/simd.h"
 
 namespace storm {
     namespace settings {
@@ -100,6 +101,21 @@ namespace storm {
                  */
                 storm::solver::MultiplicationStyle getPowerMethodMultiplicationStyle() const;
                 
+                /*!
+                 * Retrieves whether matrix-vector multiplications are to be performed on a compact copy of the matrix.
+                 *
+                 * @return True iff the compact matrix layout is to be used.
+                 */
+                bool isCompactMatrixLayoutSet() const;
+                
+                /*!
+                 * Retrieves the SIMD kernel that is to be used for multiplications with the compact matrix layout. If
+                 * the kernel was set to 'auto', the best kernel supported by the current machine is returned.
+                 *
+                 * @return The kernel to use.
+                 */
+                storm::utility::simd::SimdKernel getCompactMatrixLayoutKernel() const;
+                
                 bool check() const override;
                 
                 // The name of the module.
@@ -114,6 +130,7 @@ namespace storm {
                 static const std::string precisionOptionName;
                 static const std::string absoluteOptionName;
                 static const std::string powerMethodMultiplicationStyleOptionName;
+                static const std::string compactMatrixLayoutOptionName;
             };
             
         } // namespace modules
@@ -39,6 +39,20 @@ namespace storm {
                  */
                 uint_fast64_t getTimeoutInSeconds() const;
 
+                /*!
+                 * Retrieves whether a performance report shall be written at the end of a run.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isProfileSet() const;
+
+                /*!
+                 * Retrieves the name of the file to which the performance report is to be written.
+                 *
+                 * @return The name of the file.
+                 */
+                std::string getProfileFilename() const;
+
                 // The name of the module.
                 static const std::string moduleName;
 
@@ -48,6 +62,7 @@ namespace storm {
                 static const std::string timeoutOptionShortName;
                 static const std::string printTimeAndMemoryOptionName;
                 static const std::string printTimeAndMemoryOptionShortName;
+                static const std::string profileOptionName;
             };
         }
     }
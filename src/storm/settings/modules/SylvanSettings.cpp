@@ -7,6 +7,9 @@
 #include "storm/settings/ArgumentBuilder.h"
 #include "storm/settings/Argument.h"
 
+#include "storm/utility/macros.h"
+#include "storm/exceptions/IllegalArgumentValueException.h"
+
 namespace storm {
     namespace settings {
         namespace modules {
@@ -14,10 +17,19 @@ namespace storm {
             const std::string SylvanSettings::moduleName = "sylvan";
             const std::string SylvanSettings::maximalMemoryOptionName = "maxmem";
             const std::string SylvanSettings::threadCountOptionName = "threads";
+            const std::string SylvanSettings::pinningOptionName = "pin";
+            const std::string SylvanSettings::interleaveOptionName = "interleave";
+            const std::string SylvanSettings::adaptiveCacheOptionName = "adaptivecache";
+            const std::string SylvanSettings::statisticsOptionName = "stats";
             
             SylvanSettings::SylvanSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, maximalMemoryOptionName, true, "Sets the upper bound of memory available to Sylvan in MB.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The memory available to Sylvan.").setDefaultValueUnsignedInteger(4096).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, threadCountOptionName, true, "Sets the number of threads used by Sylvan.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The number of threads available to Sylvan (0 means 'auto-detect').").build()).build());
+                std::vector<std::string> pinningStrategies = {"none", "compact", "scatter"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, pinningOptionName, true, "Sets how the threads of Sylvan are pinned to cores. Requires hwloc.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("strategy", "The pinning strategy. Available are: none, compact (fill one NUMA node after the other) and scatter (round-robin over the NUMA nodes).").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(pinningStrategies)).setDefaultValueString("none").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, interleaveOptionName, true, "If set, the memory of the unique table is interleaved across all NUMA nodes. Requires hwloc.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, adaptiveCacheOptionName, true, "If set, the operation cache is grown whenever its hit rate exceeds the given value.").addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("hitrate", "The minimal hit rate since the last garbage collection.").setDefaultValueDouble(0.3).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorIncluding(0.0, 1.0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, statisticsOptionName, true, "If set, statistics about the unique table, the garbage collections and the operation cache are printed when Sylvan is shut down.").build());
             }
             
             uint_fast64_t SylvanSettings::getMaximalMemory() const {
@@ -32,6 +44,34 @@ namespace storm {
                 return this->getOption(threadCountOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
             }
             
+            SylvanSettings::PinningStrategy SylvanSettings::getPinningStrategy() const {
+                std::string strategyAsString = this->getOption(pinningOptionName).getArgumentByName("strategy").getValueAsString();
+                if (strategyAsString == "none") {
+                    return PinningStrategy::None;
+                } else if (strategyAsString == "compact") {
+                    return PinningStrategy::Compact;
+                } else if (strategyAsString == "scatter") {
+                    return PinningStrategy::Scatter;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown pinning strategy '" << strategyAsString << "'.");
+            }
+            
+            bool SylvanSettings::isInterleaveTableSet() const {
+                return this->getOption(interleaveOptionName).getHasOptionBeenSet();
+            }
+            
+            bool SylvanSettings::isAdaptiveCacheSet() const {
+                return this->getOption(adaptiveCacheOptionName).getHasOptionBeenSet();
+            }
+            
+            double SylvanSettings::getAdaptiveCacheHitRate() const {
+                return this->getOption(adaptiveCacheOptionName).getArgumentByName("hitrate").getValueAsDouble();
+            }
+            
+            bool SylvanSettings::isShowStatisticsSet() const {
+                return this->getOption(statisticsOptionName).getHasOptionBeenSet();
+            }
+            
         } // namespace modules
     } // namespace settings
 } // namespace storm
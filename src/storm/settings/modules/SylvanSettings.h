@@ -12,6 +12,9 @@ namespace storm {
              */
             class SylvanSettings : public ModuleSettings {
             public:
+                // An enumeration of the strategies to pin the worker threads of Sylvan to cores.
+                enum class PinningStrategy { None, Compact, Scatter };
+                
                 /*!
                  * Creates a new set of Sylvan settings.
                  */
@@ -37,6 +40,40 @@ namespace storm {
                  */
                 bool isNumberOfThreadsSet() const;
                 
+                /*!
+                 * Retrieves the strategy with which the worker threads of Sylvan are pinned to cores. Compact fills
+                 * the cores of one NUMA node before using the next one, whereas scatter distributes the workers
+                 * round-robin over the NUMA nodes.
+                 *
+                 * @return The pinning strategy.
+                 */
+                PinningStrategy getPinningStrategy() const;
+                
+                /*!
+                 * Retrieves whether the memory of the unique table is to be interleaved across all NUMA nodes.
+                 */
+                bool isInterleaveTableSet() const;
+                
+                /*!
+                 * Retrieves whether the operation cache is to be grown based on its hit rate (rather than only
+                 * together with the unique table).
+                 */
+                bool isAdaptiveCacheSet() const;
+                
+                /*!
+                 * Retrieves the hit rate of the operation cache (since the previous garbage collection) from which on
+                 * the cache is grown if the adaptive cache is enabled.
+                 *
+                 * @return The minimal hit rate.
+                 */
+                double getAdaptiveCacheHitRate() const;
+                
+                /*!
+                 * Retrieves whether statistics about the unique table, the garbage collections and the operation cache
+                 * are to be reported when Sylvan is shut down.
+                 */
+                bool isShowStatisticsSet() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
@@ -44,6 +81,10 @@ namespace storm {
                 // Define the string names of the options as constants.
                 static const std::string maximalMemoryOptionName;
                 static const std::string threadCountOptionName;
+                static const std::string pinningOptionName;
+                static const std::string interleaveOptionName;
+                static const std::string adaptiveCacheOptionName;
+                static const std::string statisticsOptionName;
             };
             
         } // namespace modules
@@ -5,6 +5,7 @@
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 
 #include "storm/utility/vector.h"
+#include "storm/utility/Instrumentation.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 
@@ -227,6 +228,8 @@ namespace storm {
                 // Make sure that all results conform to the (global) bounds.
                 storm::utility::vector::clip(x, this->lowerBound, this->upperBound);
                 
+                storm::utility::instrumentation::addToCounter("iterations", numberOfIterations);
+                
                 // Check if the solver converged and issue a warning otherwise.
                 if (converged) {
                     STORM_LOG_INFO("Iterative solver converged after " << numberOfIterations << " iterations.");
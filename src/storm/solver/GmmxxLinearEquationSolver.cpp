@@ -10,6 +10,7 @@
 
 #include "storm/utility/vector.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/Instrumentation.h"
 
 #include "storm/utility/gmm.h"
 #include "storm/utility/vector.h"
@@ -102,6 +103,8 @@ namespace storm {
                 // Make sure that all results conform to the bounds.
                 storm::utility::vector::clip(x, this->lowerBound, this->upperBound);
                 
+                storm::utility::instrumentation::addToCounter("iterations", iter.get_iteration());
+                
                 // Check if the solver converged and issue a warning otherwise.
                 if (iter.converged()) {
                     STORM_LOG_INFO("Iterative solver converged after " << iter.get_iteration() << " iterations.");
@@ -1,5 +1,7 @@
 #include "storm/solver/IterativeMinMaxLinearEquationSolver.h"
 
+#include <algorithm>
+
 #include "storm/utility/ConstantsComparator.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
@@ -8,6 +10,7 @@
 #include "storm/utility/NumberTraits.h"
 
 #include "storm/utility/vector.h"
+#include "storm/utility/Instrumentation.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -252,8 +255,8 @@ namespace storm {
             // Get handle to linear equation solver.
             storm::solver::LinearEquationSolver<ValueType> const& linearEquationSolver = *this->linEqSolverA;
             
-            // Allow aliased multiplications.
-            bool useGaussSeidelMultiplication = linearEquationSolver.supportsGaussSeidelMultiplication() && multiplicationStyle == storm::solver::MultiplicationStyle::GaussSeidel;
+            // Allow aliased multiplications. The parallel multiplication is always regular.
+            bool useGaussSeidelMultiplication = !parallelValueIterationHelper && linearEquationSolver.supportsGaussSeidelMultiplication() && multiplicationStyle == storm::solver::MultiplicationStyle::GaussSeidel;
             
             // Proceed with the iterations as long as the method did not converge or reach the maximum number of iterations.
             uint64_t iterations = currentIterations;
@@ -262,18 +265,23 @@ namespace storm {
             
             SolverStatus status = SolverStatus::InProgress;
             while (status == SolverStatus::InProgress) {
-                // Compute x' = min/max(A*x + b).
-                if (useGaussSeidelMultiplication) {
-                    // Copy over the current vector so we can modify it in-place.
-                    *newX = *currentX;
-                    linearEquationSolver.multiplyAndReduceGaussSeidel(dir, this->A->getRowGroupIndices(), *newX, &b);
+                // Compute x' = min/max(A*x + b) and determine whether the method converged.
+                if (parallelValueIterationHelper) {
+                    if (parallelValueIterationHelper->multiplyAndReduceAndCheckConvergence(dir, *currentX, b, *newX, precision, relative)) {
+                        status = SolverStatus::Converged;
+                    }
                 } else {
-                    linearEquationSolver.multiplyAndReduce(dir, this->A->getRowGroupIndices(), *currentX, &b, *newX);
-                }
-                
-                // Determine whether the method converged.
-                if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, precision, relative)) {
-                    status = SolverStatus::Converged;
+                    if (useGaussSeidelMultiplication) {
+                        // Copy over the current vector so we can modify it in-place.
+                        *newX = *currentX;
+                        linearEquationSolver.multiplyAndReduceGaussSeidel(dir, this->A->getRowGroupIndices(), *newX, &b);
+                    } else {
+                        linearEquationSolver.multiplyAndReduce(dir, this->A->getRowGroupIndices(), *currentX, &b, *newX);
+                    }
+                    
+                    if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, precision, relative)) {
+                        status = SolverStatus::Converged;
+                    }
                 }
                 
                 // Update environment variables.
@@ -293,6 +301,49 @@ namespace storm {
             return ValueIterationResult(iterations - currentIterations, status);
         }
         
+        namespace {
+            // Single-precision iterations can not detect convergence reliably below this precision.
+            double const minimalSinglePrecision = 1e-6;
+            
+            template<typename ValueType>
+            std::pair<uint64_t, SolverStatus> performSinglePrecisionValueIteration(storm::storage::SparseMatrix<ValueType> const&, OptimizationDirection, std::vector<ValueType>&, std::vector<ValueType> const&, ValueType const&, bool, uint64_t) {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Value iteration in single precision is only available for double-precision equation systems.");
+            }
+            
+            /*!
+             * Performs value iteration on a single-precision copy of the given equation system, starting from the given
+             * values. The result is written back to the given values.
+             */
+            template<>
+            std::pair<uint64_t, SolverStatus> performSinglePrecisionValueIteration(storm::storage::SparseMatrix<double> const& A, OptimizationDirection dir, std::vector<double>& x, std::vector<double> const& b, double const& precision, bool relative, uint64_t maximalNumberOfIterations) {
+                storm::utility::instrumentation::Scope scope("single-precision value iteration");
+                storm::storage::SparseMatrix<float> singleA = A.toValueType<float>();
+                std::vector<float> const singleB = storm::utility::vector::toValueType<float>(b);
+                std::vector<float> currentX = storm::utility::vector::toValueType<float>(x);
+                std::vector<float> newX(currentX.size());
+                float singlePrecision = static_cast<float>(std::max(precision, minimalSinglePrecision));
+                
+                uint64_t iterations = 0;
+                SolverStatus status = SolverStatus::InProgress;
+                while (status == SolverStatus::InProgress) {
+                    singleA.multiplyAndReduce(dir, singleA.getRowGroupIndices(), currentX, &singleB, newX, nullptr);
+                    storm::utility::instrumentation::countMultiplication(singleA.getEntryCount());
+                    if (storm::utility::vector::equalModuloPrecision<float>(currentX, newX, singlePrecision, relative)) {
+                        status = SolverStatus::Converged;
+                    }
+                    std::swap(currentX, newX);
+                    ++iterations;
+                    if (status != SolverStatus::Converged && iterations >= maximalNumberOfIterations) {
+                        status = SolverStatus::MaximalIterationsExceeded;
+                    }
+                }
+                
+                x = storm::utility::vector::toValueType<double>(currentX);
+                STORM_LOG_INFO("Value iteration in single precision stopped after " << iterations << " iterations.");
+                return std::make_pair(iterations, status);
+            }
+        }
+        
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             if (!this->linEqSolverA) {
@@ -304,6 +355,8 @@ namespace storm {
                 auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
             }
             
+            setUpParallelValueIteration(env);
+            
             // By default, we can not provide any guarantee
             SolverGuarantee guarantee = SolverGuarantee::None;
             
@@ -343,8 +396,40 @@ namespace storm {
             std::vector<ValueType>* newX = auxiliaryRowGroupVector.get();
             std::vector<ValueType>* currentX = &x;
             
-            this->startMeasureProgress();
-            ValueIterationResult result = performValueIteration(dir, currentX, newX, b, storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), env.solver().minMax().getRelativeTerminationCriterion(), guarantee, 0, env.solver().minMax().getMaximalNumberOfIterations(), env.solver().minMax().getMultiplicationStyle());
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+            bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+            
+            // Rounding errors in single precision may move the values past the solution, so they are not used if the
+            // values need to approach the solution from one side. This is the case if the termination condition relies
+            // on it or if the iteration has been set up with a guarantee, in particular when the system has no unique
+            // solution (e.g. because of end components) and the iteration needs to start from a bound to converge to
+            // the correct fixed point.
+            ValueIterationArithmetic arithmetic = env.solver().minMax().getValueIterationArithmetic();
+            bool useSinglePrecision = arithmetic != ValueIterationArithmetic::Double;
+            if (useSinglePrecision && !std::is_same<ValueType, double>::value) {
+                STORM_LOG_WARN("Value iteration in single precision is only available for double-precision equation systems. Falling back to regular value iteration.");
+                useSinglePrecision = false;
+            } else if (useSinglePrecision && this->hasCustomTerminationCondition()) {
+                STORM_LOG_WARN("Value iteration in single precision is not used as the termination condition requires a guarantee on the values. Falling back to regular value iteration.");
+                useSinglePrecision = false;
+            } else if (useSinglePrecision && (!this->hasUniqueSolution() || guarantee != SolverGuarantee::None)) {
+                STORM_LOG_WARN("Value iteration in single precision is not used as the equation system may not have a unique solution or the initial values carry a guarantee. Falling back to regular value iteration.");
+                useSinglePrecision = false;
+            }
+            
+            ValueIterationResult result(0, SolverStatus::InProgress);
+            if (useSinglePrecision) {
+                STORM_LOG_WARN_COND(arithmetic != ValueIterationArithmetic::Single || storm::utility::convertNumber<double>(precision) >= minimalSinglePrecision, "The requested precision can not be achieved in single precision, using precision " << minimalSinglePrecision << " instead.");
+                auto singlePrecisionResult = performSinglePrecisionValueIteration(*this->A, dir, x, b, precision, relative, env.solver().minMax().getMaximalNumberOfIterations());
+                result = ValueIterationResult(singlePrecisionResult.first, singlePrecisionResult.second);
+                guarantee = SolverGuarantee::None;
+            }
+            
+            if (!useSinglePrecision || arithmetic == ValueIterationArithmetic::Mixed) {
+                this->startMeasureProgress();
+                ValueIterationResult doublePrecisionResult = performValueIteration(dir, currentX, newX, b, precision, relative, guarantee, result.iterations, env.solver().minMax().getMaximalNumberOfIterations(), env.solver().minMax().getMultiplicationStyle());
+                result = ValueIterationResult(result.iterations + doublePrecisionResult.iterations, doublePrecisionResult.status);
+            }
 
             // Swap the result into the output x.
             if (currentX == auxiliaryRowGroupVector.get()) {
@@ -409,8 +494,10 @@ namespace storm {
                 auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
             }
             
-            // Allow aliased multiplications.
-            bool useGaussSeidelMultiplication = this->linEqSolverA->supportsGaussSeidelMultiplication() && env.solver().minMax().getMultiplicationStyle() == storm::solver::MultiplicationStyle::GaussSeidel;
+            setUpParallelValueIteration(env);
+            
+            // Allow aliased multiplications. The parallel multiplication is always regular.
+            bool useGaussSeidelMultiplication = !parallelValueIterationHelper && this->linEqSolverA->supportsGaussSeidelMultiplication() && env.solver().minMax().getMultiplicationStyle() == storm::solver::MultiplicationStyle::GaussSeidel;
             
             std::vector<ValueType>* lowerX = &x;
             this->createLowerBoundsVector(*lowerX);
@@ -440,6 +527,16 @@ namespace storm {
             if (!relative) {
                 precision *= storm::utility::convertNumber<ValueType>(2.0);
             }
+            
+            // Performs a regular multiplication and returns the difference at the relevant values (if required).
+            auto multiplyAndReduce = [&] (std::vector<ValueType> const& currentX, std::vector<ValueType>& newX) -> ValueType {
+                if (parallelValueIterationHelper) {
+                    return parallelValueIterationHelper->multiplyAndReduceAndComputeMaximalDifference(dir, currentX, b, newX, useDiffs ? &this->getRelevantValues() : nullptr);
+                }
+                this->linEqSolverA->multiplyAndReduce(dir, this->A->getRowGroupIndices(), currentX, &b, newX);
+                return useDiffs ? computeMaxAbsDiff(currentX, newX, this->getRelevantValues()) : storm::utility::zero<ValueType>();
+            };
+            
             this->startMeasureProgress();
             while (status == SolverStatus::InProgress && iterations < env.solver().minMax().getMaximalNumberOfIterations()) {
                 // Remember in which directions we took steps in this iteration.
@@ -464,15 +561,9 @@ namespace storm {
                             maxUpperDiff = computeMaxAbsDiff(*upperX, this->getRelevantValues(), oldValues);
                         }
                     } else {
-                        this->linEqSolverA->multiplyAndReduce(dir, this->A->getRowGroupIndices(), *lowerX, &b, *tmp);
-                        if (useDiffs) {
-                            maxLowerDiff = computeMaxAbsDiff(*lowerX, *tmp, this->getRelevantValues());
-                        }
+                        maxLowerDiff = multiplyAndReduce(*lowerX, *tmp);
                         std::swap(lowerX, tmp);
-                        this->linEqSolverA->multiplyAndReduce(dir, this->A->getRowGroupIndices(), *upperX, &b, *tmp);
-                        if (useDiffs) {
-                            maxUpperDiff = computeMaxAbsDiff(*upperX, *tmp, this->getRelevantValues());
-                        }
+                        maxUpperDiff = multiplyAndReduce(*upperX, *tmp);
                         std::swap(upperX, tmp);
                     }
                 } else {
@@ -499,17 +590,11 @@ namespace storm {
                         }
                     } else {
                         if (maxLowerDiff >= maxUpperDiff) {
-                            this->linEqSolverA->multiplyAndReduce(dir, this->A->getRowGroupIndices(), *lowerX, &b, *tmp);
-                            if (useDiffs) {
-                                maxLowerDiff = computeMaxAbsDiff(*lowerX, *tmp, this->getRelevantValues());
-                            }
+                            maxLowerDiff = multiplyAndReduce(*lowerX, *tmp);
                             std::swap(tmp, lowerX);
                             lowerStep = true;
                         } else {
-                            this->linEqSolverA->multiplyAndReduce(dir, this->A->getRowGroupIndices(), *upperX, &b, *tmp);
-                            if (useDiffs) {
-                                maxUpperDiff = computeMaxAbsDiff(*upperX, *tmp, this->getRelevantValues());
-                            }
+                            maxUpperDiff = multiplyAndReduce(*upperX, *tmp);
                             std::swap(tmp, upperX);
                             upperStep = true;
                         }
@@ -523,7 +608,9 @@ namespace storm {
 
                 if (doConvergenceCheck) {
                     // Determine whether the method converged.
-                    if (this->hasRelevantValues()) {
+                    if (parallelValueIterationHelper) {
+                        status = parallelValueIterationHelper->equalModuloPrecision(*lowerX, *upperX, precision, relative, this->hasRelevantValues() ? &this->getRelevantValues() : nullptr) ? SolverStatus::Converged : status;
+                    } else if (this->hasRelevantValues()) {
                         status = storm::utility::vector::equalModuloPrecision<ValueType>(*lowerX, *upperX, this->getRelevantValues(), precision, relative) ? SolverStatus::Converged : status;
                     } else {
                         status = storm::utility::vector::equalModuloPrecision<ValueType>(*lowerX, *upperX, precision, relative) ? SolverStatus::Converged : status;
@@ -891,6 +978,7 @@ namespace storm {
         
         template<typename ValueType>
         void IterativeMinMaxLinearEquationSolver<ValueType>::reportStatus(SolverStatus status, uint64_t iterations) {
+            storm::utility::instrumentation::addToCounter("iterations", iterations);
             switch (status) {
                 case SolverStatus::Converged: STORM_LOG_INFO("Iterative solver converged after " << iterations << " iterations."); break;
                 case SolverStatus::TerminatedEarly: STORM_LOG_INFO("Iterative solver terminated early after " << iterations << " iterations."); break;
@@ -905,9 +993,22 @@ namespace storm {
             auxiliaryRowGroupVector.reset();
             auxiliaryRowGroupVector2.reset();
             rowGroupOrdering.reset();
+            parallelValueIterationHelper.reset();
             StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
         }
         
+        template<typename ValueType>
+        void IterativeMinMaxLinearEquationSolver<ValueType>::setUpParallelValueIteration(Environment const& env) const {
+            uint64_t numberOfThreads = env.solver().minMax().getNumberOfThreads();
+            if (numberOfThreads == 1) {
+                parallelValueIterationHelper.reset();
+            } else if (!parallelValueIterationHelper || (numberOfThreads != 0 && parallelValueIterationHelper->getNumberOfThreads() != numberOfThreads)) {
+                STORM_LOG_INFO_COND(env.solver().minMax().getMultiplicationStyle() != storm::solver::MultiplicationStyle::GaussSeidel, "Parallel value iteration uses regular instead of Gauss-Seidel multiplications.");
+                parallelValueIterationHelper = std::make_unique<ParallelValueIterationHelper<ValueType>>(*this->A, numberOfThreads);
+                STORM_LOG_INFO("Performing value iteration with " << parallelValueIterationHelper->getNumberOfThreads() << " threads.");
+            }
+        }
+        
         template<typename ValueType>
         IterativeMinMaxLinearEquationSolverFactory<ValueType>::IterativeMinMaxLinearEquationSolverFactory() : StandardMinMaxLinearEquationSolverFactory<ValueType>() {
             // Intentionally left empty
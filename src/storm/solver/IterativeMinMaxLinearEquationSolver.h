@@ -6,6 +6,7 @@
 
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
+#include "storm/solver/ParallelValueIterationHelper.h"
 
 #include "storm/solver/SolverStatus.h"
 
@@ -70,10 +71,17 @@ namespace storm {
             
             void createLinearEquationSolver(Environment const& env) const;
             
+            /*!
+             * Creates the helper for parallel value iteration if the environment requests more than one thread and
+             * removes it otherwise.
+             */
+            void setUpParallelValueIteration(Environment const& env) const;
+            
             // possibly cached data
             mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector; // A.rowGroupCount() entries
             mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector2; // A.rowGroupCount() entries
             mutable std::unique_ptr<std::vector<uint64_t>> rowGroupOrdering; // A.rowGroupCount() entries
+            mutable std::unique_ptr<ParallelValueIterationHelper<ValueType>> parallelValueIterationHelper;
             
             SolverStatus updateStatusIfNotConverged(SolverStatus status, std::vector<ValueType> const& x, uint64_t iterations, uint64_t maximalNumberOfIterations, SolverGuarantee const& guarantee) const;
             static void reportStatus(SolverStatus status, uint64_t iterations);
@@ -12,6 +12,7 @@
 
 #include "storm/environment/solver/SolverEnvironment.h"
 
+#include "storm/utility/Instrumentation.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
@@ -26,6 +27,7 @@ namespace storm {
         
         template<typename ValueType>
         bool LinearEquationSolver<ValueType>::solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            storm::utility::instrumentation::Scope scope("solve linear equations");
             return this->internalSolveEquations(env, x, b);
         }
         
@@ -9,6 +9,7 @@
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
+#include "storm/utility/Instrumentation.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/InvalidSettingsException.h"
@@ -30,6 +31,7 @@ namespace storm {
         template<typename ValueType>
         bool MinMaxLinearEquationSolver<ValueType>::solveEquations(Environment const& env, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             STORM_LOG_WARN_COND_DEBUG(this->isRequirementsCheckedSet(), "The requirements of the solver have not been marked as checked. Please provide the appropriate check or mark the requirements as checked (if applicable).");
+            storm::utility::instrumentation::Scope scope("solve min-max equations");
             return internalSolveEquations(env, d, x, b);
         }
         
@@ -7,6 +7,7 @@
 #include "storm/utility/NumberTraits.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
+#include "storm/utility/Instrumentation.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
@@ -33,6 +34,7 @@ namespace storm {
         template<typename ValueType>
         void NativeLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType> const& A) {
             localA.reset();
+            compactA.reset();
             this->A = &A;
             clearCache();
         }
@@ -40,6 +42,7 @@ namespace storm {
         template<typename ValueType>
         void NativeLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType>&& A) {
             localA = std::make_unique<storm::storage::SparseMatrix<ValueType>>(std::move(A));
+            compactA.reset();
             this->A = localA.get();
             clearCache();
         }
@@ -284,6 +287,7 @@ namespace storm {
                 clearCache();
             }
 
+            storm::utility::instrumentation::addToCounter("iterations", iterations);
             if (converged) {
                 STORM_LOG_INFO("Iterative solver converged in " << iterations << " iterations.");
             } else {
@@ -308,7 +312,7 @@ namespace storm {
                     *newX = *currentX;
                     this->multiplier.multAddGaussSeidelBackward(*this->A, *newX, &b);
                 } else {
-                    this->multiplier.multAdd(*this->A, *currentX, &b, *newX);
+                    this->multAdd(*currentX, &b, *newX);
                 }
                 
                 // Now check for termination.
@@ -454,12 +458,12 @@ namespace storm {
                             maxUpperDiff = computeMaxAbsDiff(*upperX, this->getRelevantValues(), oldValues);
                         }
                     } else {
-                        this->multiplier.multAdd(*this->A, *lowerX, &b, *tmp);
+                        this->multAdd(*lowerX, &b, *tmp);
                         if (useDiffs) {
                             maxLowerDiff = computeMaxAbsDiff(*lowerX, *tmp, this->getRelevantValues());
                         }
                         std::swap(tmp, lowerX);
-                        this->multiplier.multAdd(*this->A, *upperX, &b, *tmp);
+                        this->multAdd(*upperX, &b, *tmp);
                         if (useDiffs) {
                             maxUpperDiff = computeMaxAbsDiff(*upperX, *tmp, this->getRelevantValues());
                         }
@@ -489,14 +493,14 @@ namespace storm {
                         }
                     } else {
                         if (maxLowerDiff >= maxUpperDiff) {
-                            this->multiplier.multAdd(*this->A, *lowerX, &b, *tmp);
+                            this->multAdd(*lowerX, &b, *tmp);
                             if (useDiffs) {
                                 maxLowerDiff = computeMaxAbsDiff(*lowerX, *tmp, this->getRelevantValues());
                             }
                             std::swap(tmp, lowerX);
                             lowerStep = true;
                         } else {
-                            this->multiplier.multAdd(*this->A, *upperX, &b, *tmp);
+                            this->multAdd(*upperX, &b, *tmp);
                             if (useDiffs) {
                                 maxUpperDiff = computeMaxAbsDiff(*upperX, *tmp, this->getRelevantValues());
                             }
@@ -807,6 +811,7 @@ namespace storm {
         
         template<typename ValueType>
         void NativeLinearEquationSolver<ValueType>::logIterations(bool converged, bool terminate, uint64_t iterations) const {
+            storm::utility::instrumentation::addToCounter("iterations", iterations);
             if (converged) {
                 STORM_LOG_INFO("Iterative solver converged in " << iterations << " iterations.");
             } else if (terminate) {
@@ -867,14 +872,14 @@ namespace storm {
         template<typename ValueType>
         void NativeLinearEquationSolver<ValueType>::multiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
             if (&x != &result) {
-                multiplier.multAdd(*A, x, b, result);
+                multAdd(x, b, result);
             } else {
                 // If the two vectors are aliases, we need to create a temporary.
                 if (!this->cachedRowVector) {
                     this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
                 }
                 
-                multiplier.multAdd(*A, x, b, *this->cachedRowVector);
+                multAdd(x, b, *this->cachedRowVector);
                 result.swap(*this->cachedRowVector);
                 
                 if (!this->isCachingEnabled()) {
@@ -886,14 +891,14 @@ namespace storm {
         template<typename ValueType>
         void NativeLinearEquationSolver<ValueType>::multiplyAndReduce(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
             if (&x != &result) {
-                multiplier.multAddReduce(dir, rowGroupIndices, *A, x, b, result, choices);
+                multAddReduce(dir, rowGroupIndices, x, b, result, choices);
             } else {
                 // If the two vectors are aliases, we need to create a temporary.
                 if (!this->cachedRowVector) {
                     this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
                 }
             
-                multiplier.multAddReduce(dir, rowGroupIndices, *A, x, b, *this->cachedRowVector, choices);
+                multAddReduce(dir, rowGroupIndices, x, b, *this->cachedRowVector, choices);
                 result.swap(*this->cachedRowVector);
                 
                 if (!this->isCachingEnabled()) {
@@ -902,6 +907,30 @@ namespace storm {
             }
         }
         
+        template<typename ValueType>
+        void NativeLinearEquationSolver<ValueType>::multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            if (multiplier.useCompactMatrixLayout()) {
+                if (!compactA) {
+                    compactA = multiplier.createCompactMatrix(*A);
+                }
+                multiplier.multAdd(*compactA, x, b, result);
+            } else {
+                multiplier.multAdd(*A, x, b, result);
+            }
+        }
+        
+        template<typename ValueType>
+        void NativeLinearEquationSolver<ValueType>::multAddReduce(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            if (multiplier.useCompactMatrixLayout()) {
+                if (!compactA) {
+                    compactA = multiplier.createCompactMatrix(*A);
+                }
+                multiplier.multAddReduce(dir, rowGroupIndices, *compactA, x, b, result, choices);
+            } else {
+                multiplier.multAddReduce(dir, rowGroupIndices, *A, x, b, result, choices);
+            }
+        }
+        
         template<typename ValueType>
         bool NativeLinearEquationSolver<ValueType>::supportsGaussSeidelMultiplication() const {
             return true;
@@ -7,6 +7,7 @@
 
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/NativeMultiplier.h"
+#include "storm/storage/CompactSparseMatrix.h"
 #include "storm/solver/SolverStatus.h"
 
 #include "storm/utility/NumberTraits.h"
@@ -61,6 +62,11 @@ namespace storm {
             
             void logIterations(bool converged, bool terminate, uint64_t iterations) const;
             
+            // Dispatch the (non-Gauss-Seidel) multiplications with the matrix either to the matrix itself or to its
+            // compact copy, depending on the settings of the multiplier.
+            void multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+            void multAddReduce(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+            
             virtual uint64_t getMatrixRowCount() const override;
             virtual uint64_t getMatrixColumnCount() const override;
 
@@ -95,6 +101,10 @@ namespace storm {
             
             // An object to dispatch all multiplication operations.
             NativeMultiplier<ValueType> multiplier;
+            
+            // A compact copy of the matrix that is created on demand if the multiplier requests it. As the copy is only
+            // invalidated when the matrix changes, it is not part of the cached auxiliary data.
+            mutable std::unique_ptr<storm::storage::CompactSparseMatrix<ValueType>> compactA;
 
             // cached auxiliary data
             mutable std::unique_ptr<std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>>> jacobiDecomposition;
@@ -3,18 +3,28 @@
 #include "storm-config.h"
 
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/CompactSparseMatrix.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/NativeEquationSolverSettings.h"
 
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm/utility/Instrumentation.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
     namespace solver {
         
         template<typename ValueType>
-        NativeMultiplier<ValueType>::NativeMultiplier() : storm::utility::VectorHelper<ValueType>() {
-            // Intentionally left empty.
+        NativeMultiplier<ValueType>::NativeMultiplier() : storm::utility::VectorHelper<ValueType>(), doUseCompactMatrixLayout(false), compactMatrixKernel(storm::utility::simd::SimdKernel::None) {
+            auto const& nativeSettings = storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>();
+            if (nativeSettings.isCompactMatrixLayoutSet()) {
+                STORM_LOG_WARN_COND(!this->parallelize(), "The compact matrix layout is not used for parallel multiplications.");
+                doUseCompactMatrixLayout = !this->parallelize();
+                compactMatrixKernel = nativeSettings.getCompactMatrixLayoutKernel();
+            }
         }
 
         template<typename ValueType>
@@ -27,6 +37,7 @@ namespace storm {
                 target = temporary.get();
             }
             
+            storm::utility::instrumentation::countMultiplication(matrix.getEntryCount());
             if (this->parallelize()) {
                 multAddParallel(matrix, x, b, result);
             } else {
@@ -40,6 +51,7 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multAddGaussSeidelBackward(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType>& x, std::vector<ValueType> const* b) const {
+            storm::utility::instrumentation::countMultiplication(matrix.getEntryCount());
             matrix.multiplyWithVectorBackward(x, x, b);
         }
         
@@ -53,6 +65,7 @@ namespace storm {
                 target = temporary.get();
             }
             
+            storm::utility::instrumentation::countMultiplication(matrix.getEntryCount());
             if (this->parallelize()) {
                 multAddReduceParallel(dir, rowGroupIndices, matrix, x, b, *target, choices);
             } else {
@@ -66,6 +79,7 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multAddReduceGaussSeidelBackward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint64_t>* choices) const {
+            storm::utility::instrumentation::countMultiplication(matrix.getEntryCount());
             matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
         }
                 
@@ -89,6 +103,43 @@ namespace storm {
 #endif
         }
 
+        
+        template<typename ValueType>
+        bool NativeMultiplier<ValueType>::useCompactMatrixLayout() const {
+            return doUseCompactMatrixLayout;
+        }
+        
+        template<typename ValueType>
+        std::unique_ptr<storm::storage::CompactSparseMatrix<ValueType>> NativeMultiplier<ValueType>::createCompactMatrix(storm::storage::SparseMatrix<ValueType> const& matrix) const {
+            STORM_LOG_TRACE("Creating compact copy of matrix with " << matrix.getEntryCount() << " entries using the " << compactMatrixKernel << " kernel.");
+            return std::make_unique<storm::storage::CompactSparseMatrix<ValueType>>(matrix, compactMatrixKernel);
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multAdd(storm::storage::CompactSparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            storm::utility::instrumentation::countMultiplication(matrix.getEntryCount());
+            if (&x == &result) {
+                STORM_LOG_WARN("Using temporary in 'multAdd'.");
+                std::vector<ValueType> temporary(result.size());
+                matrix.multiplyWithVector(x, temporary, b);
+                std::swap(result, temporary);
+            } else {
+                matrix.multiplyWithVector(x, result, b);
+            }
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, storm::storage::CompactSparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+            storm::utility::instrumentation::countMultiplication(matrix.getEntryCount());
+            if (&x == &result) {
+                STORM_LOG_WARN("Using temporary in 'multAddReduce'.");
+                std::vector<ValueType> temporary(result.size());
+                matrix.multiplyAndReduce(dir, rowGroupIndices, x, b, temporary, choices);
+                std::swap(result, temporary);
+            } else {
+                matrix.multiplyAndReduce(dir, rowGroupIndices, x, b, result, choices);
+            }
+        }
 
         template class NativeMultiplier<double>;
         
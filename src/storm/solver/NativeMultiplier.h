@@ -1,13 +1,19 @@
 #pragma once
 
+#include <memory>
+
 #include "storm/utility/VectorHelper.h"
 
 #include "storm/solver/OptimizationDirection.h"
+#include "storm/utility/simd.h"
 
 namespace storm {
     namespace storage {
         template<typename ValueType>
         class SparseMatrix;
+        
+        template<typename ValueType>
+        class CompactSparseMatrix;
     }
     
     namespace solver {
@@ -25,6 +31,27 @@ namespace storm {
             
             void multAddParallel(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
             void multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+            
+            /*!
+             * Retrieves whether (non-Gauss-Seidel) multiplications are to be performed on a compact copy of the matrix.
+             * This is not the case if the multiplications are parallelized.
+             */
+            bool useCompactMatrixLayout() const;
+            
+            /*!
+             * Creates a compact copy of the given matrix that uses the selected SIMD kernel.
+             */
+            std::unique_ptr<storm::storage::CompactSparseMatrix<ValueType>> createCompactMatrix(storm::storage::SparseMatrix<ValueType> const& matrix) const;
+            
+            void multAdd(storm::storage::CompactSparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+            void multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, storm::storage::CompactSparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+            
+        private:
+            // A flag that stores whether the compact matrix layout is to be used.
+            bool doUseCompactMatrixLayout;
+            
+            // The kernel to use for multiplications with compact matrices.
+            storm::utility::simd::SimdKernel compactMatrixKernel;
         };
         
     }
@@ -0,0 +1,152 @@
+#include "storm/solver/ParallelValueIterationHelper.h"
+
+#include <atomic>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/BitVector.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/vector.h"
+#include "storm/utility/Instrumentation.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace solver {
+
+        template<typename ValueType>
+        ParallelValueIterationHelper<ValueType>::ParallelValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t numberOfThreads) : matrix(matrix), threadPool(numberOfThreads) {
+            // We use several chunks per thread, so threads that finish early can steal work from the others.
+            uint64_t const chunksPerThread = 16;
+            uint64_t rowGroupCount = matrix.getRowGroupCount();
+            uint64_t numberOfChunks = std::max<uint64_t>(1, std::min(rowGroupCount, threadPool.getNumberOfThreads() * chunksPerThread));
+
+            // Balance the chunks by the work they induce. Besides the entries, every row causes some overhead.
+            uint64_t totalWork = matrix.getEntryCount() + matrix.getRowCount();
+            uint64_t accumulatedWork = 0;
+            chunkStarts.reserve(numberOfChunks + 1);
+            chunkStarts.push_back(0);
+            std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+            for (uint64_t group = 0; group < rowGroupCount; ++group) {
+                accumulatedWork += matrix.getRowGroupEntryCount(group) + (rowGroupIndices[group + 1] - rowGroupIndices[group]);
+                if (group + 1 < rowGroupCount && accumulatedWork * numberOfChunks >= totalWork * chunkStarts.size()) {
+                    chunkStarts.push_back(group + 1);
+                }
+            }
+            chunkStarts.push_back(rowGroupCount);
+            STORM_LOG_TRACE("Divided " << rowGroupCount << " row groups into " << getNumberOfChunks() << " chunks for " << threadPool.getNumberOfThreads() << " threads.");
+        }
+
+        template<typename ValueType>
+        bool ParallelValueIterationHelper<ValueType>::multiplyAndReduceAndCheckConvergence(OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& result, ValueType const& precision, bool relative) {
+            STORM_LOG_ASSERT(&x != &result, "Vectors must not be aliased.");
+            storm::utility::instrumentation::countMultiplication(matrix.getEntryCount());
+            bool minimize = storm::solver::minimize(dir);
+            std::atomic<bool> converged(true);
+            threadPool.execute(getNumberOfChunks(), [&] (uint64_t chunk, uint64_t) {
+                bool chunkConverged = converged.load(std::memory_order_relaxed);
+                for (uint64_t group = chunkStarts[chunk], groupEnd = chunkStarts[chunk + 1]; group < groupEnd; ++group) {
+                    result[group] = computeOptimalValue(minimize, group, x, b);
+                    // Once some value did not converge, there is no need to check the others.
+                    if (chunkConverged && !storm::utility::vector::equalModuloPrecision<ValueType>(x[group], result[group], precision, relative)) {
+                        chunkConverged = false;
+                        converged.store(false, std::memory_order_relaxed);
+                    }
+                }
+            });
+            return converged.load();
+        }
+
+        template<typename ValueType>
+        ValueType ParallelValueIterationHelper<ValueType>::multiplyAndReduceAndComputeMaximalDifference(OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& result, storm::storage::BitVector const* positions) {
+            STORM_LOG_ASSERT(&x != &result, "Vectors must not be aliased.");
+            storm::utility::instrumentation::countMultiplication(matrix.getEntryCount());
+            bool minimize = storm::solver::minimize(dir);
+            std::vector<ValueType> chunkDifferences(getNumberOfChunks(), storm::utility::zero<ValueType>());
+            threadPool.execute(getNumberOfChunks(), [&] (uint64_t chunk, uint64_t) {
+                uint64_t groupEnd = chunkStarts[chunk + 1];
+                for (uint64_t group = chunkStarts[chunk]; group < groupEnd; ++group) {
+                    result[group] = computeOptimalValue(minimize, group, x, b);
+                }
+                if (positions) {
+                    ValueType& difference = chunkDifferences[chunk];
+                    for (uint64_t position = positions->getNextSetIndex(chunkStarts[chunk]); position < groupEnd; position = positions->getNextSetIndex(position + 1)) {
+                        difference = storm::utility::max<ValueType>(difference, storm::utility::abs<ValueType>(result[position] - x[position]));
+                    }
+                }
+            });
+
+            ValueType maximalDifference = storm::utility::zero<ValueType>();
+            for (auto const& difference : chunkDifferences) {
+                maximalDifference = storm::utility::max<ValueType>(maximalDifference, difference);
+            }
+            return maximalDifference;
+        }
+
+        template<typename ValueType>
+        bool ParallelValueIterationHelper<ValueType>::equalModuloPrecision(std::vector<ValueType> const& vector1, std::vector<ValueType> const& vector2, ValueType const& precision, bool relative, storm::storage::BitVector const* positions) {
+            STORM_LOG_ASSERT(vector1.size() == vector2.size(), "Lengths of vectors does not match.");
+            std::atomic<bool> equal(true);
+            threadPool.execute(getNumberOfChunks(), [&] (uint64_t chunk, uint64_t) {
+                // Skip the chunk if another one already found a difference.
+                if (!equal.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                uint64_t end = chunkStarts[chunk + 1];
+                uint64_t position = positions ? positions->getNextSetIndex(chunkStarts[chunk]) : chunkStarts[chunk];
+                while (position < end) {
+                    if (!storm::utility::vector::equalModuloPrecision<ValueType>(vector1[position], vector2[position], precision, relative)) {
+                        equal.store(false, std::memory_order_relaxed);
+                        return;
+                    }
+                    position = positions ? positions->getNextSetIndex(position + 1) : position + 1;
+                }
+            });
+            return equal.load();
+        }
+
+        template<typename ValueType>
+        uint64_t ParallelValueIterationHelper<ValueType>::getNumberOfThreads() const {
+            return threadPool.getNumberOfThreads();
+        }
+
+        template<typename ValueType>
+        uint64_t ParallelValueIterationHelper<ValueType>::getNumberOfChunks() const {
+            return chunkStarts.size() - 1;
+        }
+
+        template<typename ValueType>
+        ValueType ParallelValueIterationHelper<ValueType>::computeOptimalValue(bool minimize, uint64_t group, std::vector<ValueType> const& x, std::vector<ValueType> const& b) const {
+            std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+            uint64_t row = rowGroupIndices[group];
+            uint64_t rowEnd = rowGroupIndices[group + 1];
+
+            // Empty row groups get the value zero, as in the sequential multiplication.
+            if (row == rowEnd) {
+                return storm::utility::zero<ValueType>();
+            }
+
+            ValueType optimalValue = b[row];
+            for (auto const& entry : matrix.getRow(row)) {
+                optimalValue += entry.getValue() * x[entry.getColumn()];
+            }
+            for (++row; row < rowEnd; ++row) {
+                ValueType value = b[row];
+                for (auto const& entry : matrix.getRow(row)) {
+                    value += entry.getValue() * x[entry.getColumn()];
+                }
+                if (minimize ? value < optimalValue : value > optimalValue) {
+                    optimalValue = value;
+                }
+            }
+            return optimalValue;
+        }
+
+        template class ParallelValueIterationHelper<double>;
+
+#ifdef STORM_HAVE_CARL
+        template class ParallelValueIterationHelper<storm::RationalNumber>;
+#endif
+    }
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/utility/ThreadPool.h"
+
+namespace storm {
+    namespace storage {
+        template<typename ValueType>
+        class SparseMatrix;
+
+        class BitVector;
+    }
+
+    namespace solver {
+
+        /*!
+         * Performs the steps of (sound) value iteration with several threads without relying on third-party
+         * libraries. The row groups of the matrix are split into chunks that contain roughly the same number of
+         * entries, so that the work is balanced even if the sizes of the row groups are very skewed. The chunks are
+         * processed by a work-stealing thread pool. Convergence checks are fused with the multiplication, such that
+         * every thread only inspects the values it just computed.
+         */
+        template<typename ValueType>
+        class ParallelValueIterationHelper {
+        public:
+            /*!
+             * Creates a helper for the given matrix.
+             *
+             * @param matrix The matrix. It must not be changed while the helper is used.
+             * @param numberOfThreads The number of threads to use (zero for the number of hardware threads).
+             */
+            ParallelValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t numberOfThreads);
+
+            /*!
+             * Computes result = min/max(A*x + b) and checks whether x and result are equal modulo the precision.
+             *
+             * @return True iff all entries of x and the result are equal modulo the precision.
+             */
+            bool multiplyAndReduceAndCheckConvergence(OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& result, ValueType const& precision, bool relative);
+
+            /*!
+             * Computes result = min/max(A*x + b) and the maximal absolute difference between x and the result at the
+             * given positions.
+             *
+             * @param positions If given, the positions at which to compute the difference. If not given, the
+             * difference is not computed and zero is returned.
+             * @return The maximal absolute difference.
+             */
+            ValueType multiplyAndReduceAndComputeMaximalDifference(OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& result, storm::storage::BitVector const* positions);
+
+            /*!
+             * Checks whether the two given vectors are equal modulo the precision (at the given positions).
+             *
+             * @param positions If given, only these positions are compared.
+             */
+            bool equalModuloPrecision(std::vector<ValueType> const& vector1, std::vector<ValueType> const& vector2, ValueType const& precision, bool relative, storm::storage::BitVector const* positions);
+
+            /*!
+             * Retrieves the number of threads used by this helper.
+             */
+            uint64_t getNumberOfThreads() const;
+
+            /*!
+             * Retrieves the number of chunks into which the row groups are divided.
+             */
+            uint64_t getNumberOfChunks() const;
+
+        private:
+            /*!
+             * Computes the optimal value of the given row group.
+             */
+            ValueType computeOptimalValue(bool minimize, uint64_t group, std::vector<ValueType> const& x, std::vector<ValueType> const& b) const;
+
+            // The matrix of the equation system.
+            storm::storage::SparseMatrix<ValueType> const& matrix;
+
+            // The pool of threads processing the chunks.
+            storm::utility::ThreadPool threadPool;
+
+            // The first row group of each chunk followed by the number of row groups.
+            std::vector<uint64_t> chunkStarts;
+        };
+
+    }
+}
@@ -35,12 +35,14 @@ namespace storm {
         void StandardMinMaxLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType> const& matrix) {
             this->localA = nullptr;
             this->A = &matrix;
+            this->clearCache();
         }
         
         template<typename ValueType>
         void StandardMinMaxLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType>&& matrix) {
             this->localA = std::make_unique<storm::storage::SparseMatrix<ValueType>>(std::move(matrix));
             this->A = this->localA.get();
+            this->clearCache();
         }
         
         template<typename ValueType>
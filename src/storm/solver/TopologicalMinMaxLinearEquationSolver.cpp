@@ -1,5 +1,11 @@
 #include "storm/solver/TopologicalMinMaxLinearEquationSolver.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+
 #include "storm/utility/vector.h"
 #include "storm/utility/graph.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
@@ -13,6 +19,7 @@
 #include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm-config.h"
 #ifdef STORM_HAVE_CUDA
 #	include "cudaForStorm.h"
@@ -136,164 +143,41 @@ namespace storm {
 				throw storm::exceptions::InvalidStateException() << "The useGpu Flag of a SCC was set, but this version of storm does not support CUDA acceleration. Internal Error!";
 #endif
 			} else {
+				uint64_t numberOfThreads = env.solver().minMax().getNumberOfThreads();
 				storm::storage::BitVector fullSystem(this->A->getRowGroupCount(), true);
-				storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccDecomposition(*this->A, fullSystem, false, false);
+				storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccDecomposition(*this->A, fullSystem, false, false, numberOfThreads);
 
                 STORM_LOG_THROW(sccDecomposition.size() > 0, storm::exceptions::IllegalArgumentException, "Can not solve given equation system as the SCC decomposition returned no SCCs.");
 
                 storm::storage::SparseMatrix<ValueType> stronglyConnectedComponentsDependencyGraph = sccDecomposition.extractPartitionDependencyGraph(*this->A);
-				std::vector<uint_fast64_t> topologicalSort = storm::utility::graph::getTopologicalSort(stronglyConnectedComponentsDependencyGraph);
-
-				// Calculate the optimal distribution of sccs
-				std::vector<std::pair<bool, storm::storage::StateBlock>> optimalSccs = this->getOptimalGroupingFromTopologicalSccDecomposition(sccDecomposition, topologicalSort, *this->A);
-				STORM_LOG_INFO("Optimized SCC Decomposition, originally " << topologicalSort.size() << " SCCs, optimized to " << optimalSccs.size() << " SCCs.");
 
-				std::vector<ValueType>* currentX = nullptr;
-				std::vector<ValueType>* swap = nullptr;
 				size_t currentMaxLocalIterations = 0;
-				size_t localIterations = 0;
-				size_t globalIterations = 0;
 				bool converged = true;
 
-				// Iterate over all SCCs of the MDP as specified by the topological sort. This guarantees that an SCC is only
-				// solved after all SCCs it depends on have been solved.
-				for (auto sccIndexIt = optimalSccs.cbegin(); sccIndexIt != optimalSccs.cend() && converged; ++sccIndexIt) {
-					bool const useGpu = sccIndexIt->first;
-					storm::storage::StateBlock const& scc = sccIndexIt->second;
-
-					// Generate a sub matrix
-					storm::storage::BitVector subMatrixIndices(this->A->getColumnCount(), scc.cbegin(), scc.cend());
-					storm::storage::SparseMatrix<ValueType> sccSubmatrix = this->A->getSubmatrix(true, subMatrixIndices, subMatrixIndices);
-					std::vector<ValueType> sccSubB(sccSubmatrix.getRowCount());
-					storm::utility::vector::selectVectorValues<ValueType>(sccSubB, subMatrixIndices, nondeterministicChoiceIndices, b);
-					std::vector<ValueType> sccSubX(sccSubmatrix.getColumnCount());
-					std::vector<ValueType> sccSubXSwap(sccSubmatrix.getColumnCount());
-					std::vector<ValueType> sccMultiplyResult(sccSubmatrix.getRowCount());
-
-					// Prepare the pointers for swapping in the calculation
-					currentX = &sccSubX;
-					swap = &sccSubXSwap;
-
-					storm::utility::vector::selectVectorValues<ValueType>(sccSubX, subMatrixIndices, x); // x is getCols() large, where as b and multiplyResult are getRows() (nondet. choices times states)
-					std::vector<uint_fast64_t> sccSubNondeterministicChoiceIndices(sccSubmatrix.getColumnCount() + 1);
-					sccSubNondeterministicChoiceIndices.at(0) = 0;
-
-					// Pre-process all dependent states
-					// Remove outgoing transitions and create the ChoiceIndices
-					uint_fast64_t innerIndex = 0;
-					uint_fast64_t outerIndex = 0;
-					for (uint_fast64_t state : scc) {
-						// Choice Indices
-						sccSubNondeterministicChoiceIndices.at(outerIndex + 1) = sccSubNondeterministicChoiceIndices.at(outerIndex) + (nondeterministicChoiceIndices[state + 1] - nondeterministicChoiceIndices[state]);
-
-						for (auto rowGroupIt = nondeterministicChoiceIndices[state]; rowGroupIt != nondeterministicChoiceIndices[state + 1]; ++rowGroupIt) {
-							typename storm::storage::SparseMatrix<ValueType>::const_rows row = this->A->getRow(rowGroupIt);
-							for (auto rowIt = row.begin(); rowIt != row.end(); ++rowIt) {
-								if (!subMatrixIndices.get(rowIt->getColumn())) {
-									// This is an outgoing transition of a state in the SCC to a state not included in the SCC
-									// Subtracting Pr(tau) * x_other from b fixes that
-									sccSubB.at(innerIndex) = sccSubB.at(innerIndex) + (rowIt->getValue() * x.at(rowIt->getColumn()));
-								}
-							}
-							++innerIndex;
-						}
-						++outerIndex;
-					}
-
-					// For the current SCC, we need to perform value iteration until convergence.
-					if (useGpu) {
-#ifdef STORM_HAVE_CUDA
-                        STORM_LOG_THROW(resetCudaDevice(), storm::exceptions::InvalidStateException, "Could not reset CUDA Device, can not use CUDA-based equation solver.");
+				if (numberOfThreads != 1 && !__USE_CUDAFORSTORM_OPT) {
+					// Solve independent SCCs concurrently as soon as all SCCs they depend on have been solved.
+					converged = this->solveSccsConcurrently(dir, sccDecomposition, stronglyConnectedComponentsDependencyGraph, x, b, precision, relative, maxIters, numberOfThreads, currentMaxLocalIterations);
+				} else {
+					std::vector<uint_fast64_t> topologicalSort = storm::utility::graph::getTopologicalSort(stronglyConnectedComponentsDependencyGraph);
 
-						//STORM_LOG_INFO("Device has " << getTotalCudaMemory() << " Bytes of Memory with " << getFreeCudaMemory() << "Bytes free (" << (static_cast<double>(getFreeCudaMemory()) / static_cast<double>(getTotalCudaMemory())) * 100 << "%).");
-						//STORM_LOG_INFO("We will allocate " << (sizeof(uint_fast64_t)* sccSubmatrix.rowIndications.size() + sizeof(uint_fast64_t)* sccSubmatrix.columnsAndValues.size() * 2 + sizeof(double)* sccSubX.size() + sizeof(double)* sccSubX.size() + sizeof(double)* sccSubB.size() + sizeof(double)* sccSubB.size() + sizeof(uint_fast64_t)* sccSubNondeterministicChoiceIndices.size()) << " Bytes.");
-						//STORM_LOG_INFO("The CUDA Runtime Version is " << getRuntimeCudaVersion());
+					// Calculate the optimal distribution of sccs
+					std::vector<std::pair<bool, storm::storage::StateBlock>> optimalSccs = this->getOptimalGroupingFromTopologicalSccDecomposition(sccDecomposition, topologicalSort, *this->A);
+					STORM_LOG_INFO("Optimized SCC Decomposition, originally " << topologicalSort.size() << " SCCs, optimized to " << optimalSccs.size() << " SCCs.");
 
-						bool result = false;
-						localIterations = 0;
-						if (dir == OptimizationDirection::Minimum) {
-							result = __basicValueIteration_mvReduce_minimize<uint_fast64_t, ValueType>(maxIters, precision, relative, sccSubmatrix.rowIndications, sccSubmatrix.columnsAndValues, *currentX, sccSubB, sccSubNondeterministicChoiceIndices, localIterations);
-						} else {
-							result = __basicValueIteration_mvReduce_maximize<uint_fast64_t, ValueType>(maxIters, precision, relative, sccSubmatrix.rowIndications, sccSubmatrix.columnsAndValues, *currentX, sccSubB, sccSubNondeterministicChoiceIndices, localIterations);
-						}
-						STORM_LOG_INFO("Executed " << localIterations << " of max. " << maximalNumberOfIterations << " Iterations on GPU.");
-
-						if (!result) {
-							converged = false;
-							STORM_LOG_ERROR("An error occurred in the CUDA Plugin. Can not continue.");
-							throw storm::exceptions::InvalidStateException() << "An error occurred in the CUDA Plugin. Can not continue.";
-						} else {
-							converged = true;
-						}
+					// Iterate over all SCCs of the MDP as specified by the topological sort. This guarantees that an SCC is only
+					// solved after all SCCs it depends on have been solved.
+					for (auto sccIndexIt = optimalSccs.cbegin(); sccIndexIt != optimalSccs.cend() && converged; ++sccIndexIt) {
+						size_t localIterations = 0;
+						converged = this->solveScc(dir, sccIndexIt->first, sccIndexIt->second, x, b, precision, relative, maxIters, localIterations);
 
 						// As the "number of iterations" of the full method is the maximum of the local iterations, we need to keep
 						// track of the maximum.
 						if (localIterations > currentMaxLocalIterations) {
 							currentMaxLocalIterations = localIterations;
 						}
-						globalIterations += localIterations;
-#else
-						STORM_LOG_ERROR("The useGpu Flag of a SCC was set, but this version of storm does not support CUDA acceleration. Internal Error!");
-						throw storm::exceptions::InvalidStateException() << "The useGpu Flag of a SCC was set, but this version of storm does not support CUDA acceleration. Internal Error!";
-#endif
-					} else {
-						//std::cout << "WARNING: Using CPU based TopoSolver! (double)" << std::endl;
-						STORM_LOG_INFO("Performance Warning: Using CPU based TopoSolver! (double)");
-						localIterations = 0;
-						converged = false;
-						while (!converged && localIterations < maxIters) {
-							// Compute x' = A*x + b.
-							sccSubmatrix.multiplyWithVector(*currentX, sccMultiplyResult);
-							storm::utility::vector::addVectors<ValueType>(sccMultiplyResult, sccSubB, sccMultiplyResult);
-
-							//A.multiplyWithVector(scc, nondeterministicChoiceIndices, *currentX, multiplyResult);
-							//storm::utility::addVectors(scc, nondeterministicChoiceIndices, multiplyResult, b);
-
-							/*
-							Versus:
-							A.multiplyWithVector(*currentX, *multiplyResult);
-							storm::utility::vector::addVectorsInPlace(*multiplyResult, b);
-							*/
-
-							// Reduce the vector x' by applying min/max for all non-deterministic choices.
-							storm::utility::vector::reduceVectorMinOrMax<ValueType>(dir,sccMultiplyResult, *swap, sccSubNondeterministicChoiceIndices);
-							
-							// Determine whether the method converged.
-							// TODO: It seems that the equalModuloPrecision call that compares all values should have a higher
-							// running time. In fact, it is faster. This has to be investigated.
-							// converged = storm::utility::equalModuloPrecision(*currentX, *newX, scc, precision, relative);
-							converged = storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *swap, precision, relative);
-
-							// Update environment variables.
-							std::swap(currentX, swap);
-
-							++localIterations;
-							++globalIterations;
-						}
-						STORM_LOG_INFO("Executed " << localIterations << " of max. " << maxIters << " Iterations.");
-					}
-
-
-					// The Result of this SCC has to be taken back into the main result vector
-					innerIndex = 0;
-					for (uint_fast64_t state : scc) {
-						x.at(state) = currentX->at(innerIndex);
-						++innerIndex;
-					}
-
-					// Since the pointers for swapping in the calculation point to temps they should not be valid anymore
-					currentX = nullptr;
-					swap = nullptr;
-
-					// As the "number of iterations" of the full method is the maximum of the local iterations, we need to keep
-					// track of the maximum.
-					if (localIterations > currentMaxLocalIterations) {
-						currentMaxLocalIterations = localIterations;
 					}
 				}
 
-				//std::cout << "Used a total of " << globalIterations << " iterations with a maximum of " << localIterations << " iterations in a single block." << std::endl;
-
 				// Check if the solver converged and issue a warning otherwise.
 				if (converged) {
 					STORM_LOG_INFO("Iterative solver converged after " << currentMaxLocalIterations << " iterations.");
@@ -305,6 +189,232 @@ namespace storm {
 			}
         }
 
+        template<typename ValueType>
+        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(OptimizationDirection dir, bool useGpu, storm::storage::StateBlock const& scc, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision, bool relative, uint64_t maxIters, size_t& localIterations) const {
+            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->A->getRowGroupIndices();
+
+            // An SCC consisting of a single state without a self-loop does not require iterating.
+            if (!useGpu && scc.size() == 1) {
+                uint_fast64_t state = *scc.begin();
+                bool hasSelfLoop = false;
+                for (auto const& entry : this->A->getRowGroup(state)) {
+                    if (entry.getColumn() == state) {
+                        hasSelfLoop = true;
+                        break;
+                    }
+                }
+                if (!hasSelfLoop) {
+                    ValueType optimalValue = storm::utility::zero<ValueType>();
+                    for (auto row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+                        ValueType value = b[row] + this->A->multiplyRowWithVector(row, x);
+                        if (row == nondeterministicChoiceIndices[state] || (minimize(dir) ? value < optimalValue : value > optimalValue)) {
+                            optimalValue = value;
+                        }
+                    }
+                    x[state] = optimalValue;
+                    localIterations = 1;
+                    return true;
+                }
+            }
+
+            // Generate a sub matrix. As the states of the SCC are sorted, we can map the columns by a binary search
+            // which avoids touching data whose size depends on the full system. Outgoing transitions of a state in the
+            // SCC to a state not included in the SCC are incorporated into b, which fixes their (already computed)
+            // contribution.
+            storm::storage::SparseMatrixBuilder<ValueType> sccSubmatrixBuilder(0, scc.size(), 0, false, true, scc.size());
+            std::vector<ValueType> sccSubB;
+            uint_fast64_t innerIndex = 0;
+            for (uint_fast64_t state : scc) {
+                sccSubmatrixBuilder.newRowGroup(innerIndex);
+                for (auto row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+                    ValueType sccB = b[row];
+                    for (auto const& entry : this->A->getRow(row)) {
+                        auto columnIt = std::lower_bound(scc.begin(), scc.end(), entry.getColumn());
+                        if (columnIt != scc.end() && *columnIt == entry.getColumn()) {
+                            sccSubmatrixBuilder.addNextValue(innerIndex, std::distance(scc.begin(), columnIt), entry.getValue());
+                        } else {
+                            sccB += entry.getValue() * x[entry.getColumn()];
+                        }
+                    }
+                    sccSubB.push_back(sccB);
+                    ++innerIndex;
+                }
+            }
+            storm::storage::SparseMatrix<ValueType> sccSubmatrix = sccSubmatrixBuilder.build(innerIndex, scc.size(), scc.size());
+            std::vector<uint_fast64_t> const& sccSubNondeterministicChoiceIndices = sccSubmatrix.getRowGroupIndices();
+
+            std::vector<ValueType> sccSubX;
+            sccSubX.reserve(scc.size());
+            for (uint_fast64_t state : scc) {
+                sccSubX.push_back(x[state]);
+            }
+            std::vector<ValueType> sccSubXSwap(sccSubmatrix.getColumnCount());
+            std::vector<ValueType> sccMultiplyResult(sccSubmatrix.getRowCount());
+
+            // Prepare the pointers for swapping in the calculation
+            std::vector<ValueType>* currentX = &sccSubX;
+            std::vector<ValueType>* swap = &sccSubXSwap;
+
+            bool converged = false;
+            localIterations = 0;
+
+            // For the current SCC, we need to perform value iteration until convergence.
+            if (useGpu) {
+#ifdef STORM_HAVE_CUDA
+                STORM_LOG_THROW(resetCudaDevice(), storm::exceptions::InvalidStateException, "Could not reset CUDA Device, can not use CUDA-based equation solver.");
+
+                //STORM_LOG_INFO("Device has " << getTotalCudaMemory() << " Bytes of Memory with " << getFreeCudaMemory() << "Bytes free (" << (static_cast<double>(getFreeCudaMemory()) / static_cast<double>(getTotalCudaMemory())) * 100 << "%).");
+                //STORM_LOG_INFO("We will allocate " << (sizeof(uint_fast64_t)* sccSubmatrix.rowIndications.size() + sizeof(uint_fast64_t)* sccSubmatrix.columnsAndValues.size() * 2 + sizeof(double)* sccSubX.size() + sizeof(double)* sccSubX.size() + sizeof(double)* sccSubB.size() + sizeof(double)* sccSubB.size() + sizeof(uint_fast64_t)* sccSubNondeterministicChoiceIndices.size()) << " Bytes.");
+                //STORM_LOG_INFO("The CUDA Runtime Version is " << getRuntimeCudaVersion());
+
+                bool result = false;
+                localIterations = 0;
+                if (dir == OptimizationDirection::Minimum) {
+                    result = __basicValueIteration_mvReduce_minimize<uint_fast64_t, ValueType>(maxIters, precision, relative, sccSubmatrix.rowIndications, sccSubmatrix.columnsAndValues, *currentX, sccSubB, sccSubNondeterministicChoiceIndices, localIterations);
+                } else {
+                    result = __basicValueIteration_mvReduce_maximize<uint_fast64_t, ValueType>(maxIters, precision, relative, sccSubmatrix.rowIndications, sccSubmatrix.columnsAndValues, *currentX, sccSubB, sccSubNondeterministicChoiceIndices, localIterations);
+                }
+                STORM_LOG_INFO("Executed " << localIterations << " of max. " << maximalNumberOfIterations << " Iterations on GPU.");
+
+                if (!result) {
+                    converged = false;
+                    STORM_LOG_ERROR("An error occurred in the CUDA Plugin. Can not continue.");
+                    throw storm::exceptions::InvalidStateException() << "An error occurred in the CUDA Plugin. Can not continue.";
+                } else {
+                    converged = true;
+                }
+#else
+                STORM_LOG_ERROR("The useGpu Flag of a SCC was set, but this version of storm does not support CUDA acceleration. Internal Error!");
+                throw storm::exceptions::InvalidStateException() << "The useGpu Flag of a SCC was set, but this version of storm does not support CUDA acceleration. Internal Error!";
+#endif
+            } else {
+                //std::cout << "WARNING: Using CPU based TopoSolver! (double)" << std::endl;
+                STORM_LOG_INFO("Performance Warning: Using CPU based TopoSolver! (double)");
+                while (!converged && localIterations < maxIters) {
+                    // Compute x' = A*x + b.
+                    sccSubmatrix.multiplyWithVector(*currentX, sccMultiplyResult);
+                    storm::utility::vector::addVectors<ValueType>(sccMultiplyResult, sccSubB, sccMultiplyResult);
+
+                    //A.multiplyWithVector(scc, nondeterministicChoiceIndices, *currentX, multiplyResult);
+                    //storm::utility::addVectors(scc, nondeterministicChoiceIndices, multiplyResult, b);
+
+                    /*
+                    Versus:
+                    A.multiplyWithVector(*currentX, *multiplyResult);
+                    storm::utility::vector::addVectorsInPlace(*multiplyResult, b);
+                    */
+
+                    // Reduce the vector x' by applying min/max for all non-deterministic choices.
+                    storm::utility::vector::reduceVectorMinOrMax<ValueType>(dir,sccMultiplyResult, *swap, sccSubNondeterministicChoiceIndices);
+
+                    // Determine whether the method converged.
+                    // TODO: It seems that the equalModuloPrecision call that compares all values should have a higher
+                    // running time. In fact, it is faster. This has to be investigated.
+                    // converged = storm::utility::equalModuloPrecision(*currentX, *newX, scc, precision, relative);
+                    converged = storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *swap, precision, relative);
+
+                    // Update environment variables.
+                    std::swap(currentX, swap);
+
+                    ++localIterations;
+                }
+                STORM_LOG_INFO("Executed " << localIterations << " of max. " << maxIters << " Iterations.");
+            }
+
+            // The Result of this SCC has to be taken back into the main result vector
+            innerIndex = 0;
+            for (uint_fast64_t state : scc) {
+                x[state] = (*currentX)[innerIndex];
+                ++innerIndex;
+            }
+
+            return converged;
+        }
+
+        template<typename ValueType>
+        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveSccsConcurrently(OptimizationDirection dir, storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& sccDecomposition, storm::storage::SparseMatrix<ValueType> const& dependencyGraph, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision, bool relative, uint64_t maxIters, uint64_t numberOfThreads, size_t& maxLocalIterations) const {
+            uint64_t const numberOfSccs = sccDecomposition.size();
+            uint64_t const noScc = std::numeric_limits<uint64_t>::max();
+
+            // The SCCs that depend on a given SCC and the number of unsolved SCCs each SCC depends on.
+            storm::storage::SparseMatrix<ValueType> dependentSccs = dependencyGraph.transpose();
+            std::unique_ptr<std::atomic<uint64_t>[]> numberOfUnsolvedDependencies(new std::atomic<uint64_t>[numberOfSccs]);
+            std::vector<uint64_t> readySccs;
+            for (uint64_t scc = 0; scc < numberOfSccs; ++scc) {
+                numberOfUnsolvedDependencies[scc].store(dependencyGraph.getRow(scc).getNumberOfEntries(), std::memory_order_relaxed);
+                if (dependencyGraph.getRow(scc).getNumberOfEntries() == 0) {
+                    readySccs.push_back(scc);
+                }
+            }
+
+            storm::utility::ThreadPool threadPool(numberOfThreads);
+            std::vector<size_t> maxLocalIterationsPerThread(threadPool.getNumberOfThreads(), 0);
+            std::mutex mutex;
+            std::condition_variable sccsReady;
+            std::atomic<uint64_t> numberOfSolvedSccs(0);
+            std::atomic<bool> converged(true);
+
+            // Every thread repeatedly solves an SCC whose dependencies are solved. To avoid synchronization, a thread
+            // directly continues with one of the SCCs that became ready by solving the previous one (if any).
+            threadPool.execute(threadPool.getNumberOfThreads(), [&] (uint64_t, uint64_t thread) {
+                std::vector<uint64_t> newReadySccs;
+                uint64_t scc = noScc;
+                while (converged.load(std::memory_order_relaxed)) {
+                    if (scc == noScc) {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        sccsReady.wait(lock, [&] { return !readySccs.empty() || !converged.load() || numberOfSolvedSccs.load() == numberOfSccs; });
+                        if (readySccs.empty() || !converged.load()) {
+                            return;
+                        }
+                        scc = readySccs.back();
+                        readySccs.pop_back();
+                    }
+
+                    size_t localIterations = 0;
+                    bool sccConverged = false;
+                    try {
+                        sccConverged = this->solveScc(dir, false, sccDecomposition[scc], x, b, precision, relative, maxIters, localIterations);
+                    } catch (...) {
+                        // Make sure the other threads do not wait for this SCC.
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            converged.store(false);
+                        }
+                        sccsReady.notify_all();
+                        throw;
+                    }
+                    maxLocalIterationsPerThread[thread] = std::max(maxLocalIterationsPerThread[thread], localIterations);
+
+                    uint64_t nextScc = noScc;
+                    for (auto const& dependentScc : dependentSccs.getRow(scc)) {
+                        if (numberOfUnsolvedDependencies[dependentScc.getColumn()].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                            if (nextScc == noScc) {
+                                nextScc = dependentScc.getColumn();
+                            } else {
+                                newReadySccs.push_back(dependentScc.getColumn());
+                            }
+                        }
+                    }
+                    bool allSccsSolved = numberOfSolvedSccs.fetch_add(1) + 1 == numberOfSccs;
+                    if (!newReadySccs.empty() || allSccsSolved || !sccConverged) {
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            readySccs.insert(readySccs.end(), newReadySccs.begin(), newReadySccs.end());
+                            if (!sccConverged) {
+                                converged.store(false);
+                            }
+                        }
+                        sccsReady.notify_all();
+                        newReadySccs.clear();
+                    }
+                    scc = nextScc;
+                }
+            });
+
+            maxLocalIterations = *std::max_element(maxLocalIterationsPerThread.begin(), maxLocalIterationsPerThread.end());
+            return converged.load();
+        }
+
 		template<typename ValueType>
 		std::vector<std::pair<bool, storm::storage::StateBlock>>
 			TopologicalMinMaxLinearEquationSolver<ValueType>::getOptimalGroupingFromTopologicalSccDecomposition(storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& sccDecomposition, std::vector<uint_fast64_t> const& topologicalSort, storm::storage::SparseMatrix<ValueType> const& matrix) const {
@@ -46,6 +46,27 @@ namespace storm {
             std::unique_ptr<storm::storage::SparseMatrix<ValueType>> localA;
             
             bool enableCuda;
+            
+            /*!
+             * Solves the equation system restricted to the given SCC (or group of SCCs). The values of all states
+             * outside the SCC that are reachable from it have to be final.
+             *
+             * @param useGpu If set, the SCC is solved on the GPU.
+             * @param localIterations Is set to the number of iterations that were performed.
+             * @return True iff the iteration converged.
+             */
+            bool solveScc(OptimizationDirection dir, bool useGpu, storm::storage::StateBlock const& scc, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision, bool relative, uint64_t maxIters, size_t& localIterations) const;
+            
+            /*!
+             * Solves all SCCs with the given number of threads. An SCC is solved as soon as all SCCs it depends on are
+             * solved, so independent SCCs are solved concurrently.
+             *
+             * @param dependencyGraph The dependency graph of the SCCs.
+             * @param maxLocalIterations Is set to the maximal number of iterations performed for a single SCC.
+             * @return True iff the iterations converged for all SCCs.
+             */
+            bool solveSccsConcurrently(OptimizationDirection dir, storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& sccDecomposition, storm::storage::SparseMatrix<ValueType> const& dependencyGraph, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision, bool relative, uint64_t maxIters, uint64_t numberOfThreads, size_t& maxLocalIterations) const;
+            
             /*!
              * Given a topological sort of a SCC Decomposition, this will calculate the optimal grouping of SCCs with respect to the size of the GPU memory.
              */
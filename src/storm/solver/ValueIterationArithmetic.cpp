@@ -0,0 +1,16 @@
+#include "storm/solver/ValueIterationArithmetic.h"
+
+namespace storm {
+    namespace solver {
+        
+        std::ostream& operator<<(std::ostream& out, ValueIterationArithmetic const& arithmetic) {
+            switch (arithmetic) {
+                case ValueIterationArithmetic::Double: out << "double"; break;
+                case ValueIterationArithmetic::Single: out << "single"; break;
+                case ValueIterationArithmetic::Mixed: out << "mixed"; break;
+            }
+            return out;
+        }
+        
+    }
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <iostream>
+
+namespace storm {
+    namespace solver {
+        
+        /*!
+         * The arithmetic used by (non-sound) value iteration on double-precision equation systems. With single
+         * precision, the iterations are performed on a single-precision copy of the system. The mixed mode first
+         * iterates in single precision and then continues in double precision from the obtained values.
+         */
+        enum class ValueIterationArithmetic { Double, Single, Mixed };
+     
+        std::ostream& operator<<(std::ostream& out, ValueIterationArithmetic const& arithmetic);
+        
+    }
+}
@@ -1,9 +1,16 @@
 #include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
 
+#include "storm-config.h"
+
 #include "storm/solver/stateelimination/StatePriorityQueue.h"
 
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/storage/BitVector.h"
+
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/ThreadPool.h"
 
 #include "StaticStatePriorityQueue.h"
 
@@ -11,13 +18,27 @@ namespace storm {
     namespace solver {
         namespace stateelimination {
 
+            // Exact numbers are reference counted without synchronization, so they must not be shared between threads.
+            // Rational functions may only be shared if carl was built thread-safe.
+            template<typename ValueType>
+            bool supportsConcurrentElimination() {
+                return std::is_same<ValueType, double>::value;
+            }
+            
+#if defined(STORM_HAVE_CARL) && defined(STORM_CARL_THREAD_SAFE)
+            template<>
+            bool supportsConcurrentElimination<storm::RationalFunction>() {
+                return true;
+            }
+#endif
+            
             template<typename ValueType>
             PrioritizedStateEliminator<ValueType>::PrioritizedStateEliminator(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, std::vector<storm::storage::sparse::state_type> const& statesToEliminate, std::vector<ValueType>& stateValues)
             : PrioritizedStateEliminator(transitionMatrix, backwardTransitions, std::make_shared<StaticStatePriorityQueue>(statesToEliminate), stateValues)
             {}
 
             template<typename ValueType>
-            PrioritizedStateEliminator<ValueType>::PrioritizedStateEliminator(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, PriorityQueuePointer priorityQueue, std::vector<ValueType>& stateValues) : StateEliminator<ValueType>(transitionMatrix, backwardTransitions), priorityQueue(priorityQueue), stateValues(stateValues) {
+            PrioritizedStateEliminator<ValueType>::PrioritizedStateEliminator(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, PriorityQueuePointer priorityQueue, std::vector<ValueType>& stateValues) : StateEliminator<ValueType>(transitionMatrix, backwardTransitions), priorityQueue(priorityQueue), stateValues(stateValues), numberOfThreads(1), postponePriorityUpdates(false) {
             }
             
             template<typename ValueType>
@@ -32,25 +53,140 @@ namespace storm {
             
             template<typename ValueType>
             void PrioritizedStateEliminator<ValueType>::updatePriority(storm::storage::sparse::state_type const& state) {
-                priorityQueue->update(state);
+                // The priority queue is not thread-safe, so concurrent eliminations leave the updates to the end of the round.
+                if (!postponePriorityUpdates) {
+                    priorityQueue->update(state);
+                }
             }
 
             template<typename ValueType>
             void PrioritizedStateEliminator<ValueType>::eliminateAll(bool removeForwardTransitions) {
+                eliminateAll([removeForwardTransitions] (storm::storage::sparse::state_type const&) { return removeForwardTransitions; });
+            }
+            
+            template<typename ValueType>
+            void PrioritizedStateEliminator<ValueType>::eliminateAll(std::function<bool (storm::storage::sparse::state_type const&)> const& removeForwardTransitions) {
+                // The neighbourhoods of the states are only determined for matrices with trivial row grouping.
+                if (numberOfThreads != 1 && this->matrix.hasTrivialRowGrouping()) {
+                    eliminateAllInParallel(removeForwardTransitions);
+                    return;
+                }
+                
                 while (priorityQueue->hasNext()) {
                     storm::storage::sparse::state_type state = priorityQueue->pop();
-                    this->eliminateState(state, removeForwardTransitions);
-                    if (removeForwardTransitions) {
+                    bool removeForwardTransitionsOfState = removeForwardTransitions(state);
+                    this->eliminateState(state, removeForwardTransitionsOfState);
+                    if (removeForwardTransitionsOfState) {
                         clearStateValues(state);
                     }
                 }
             }
+            
+            template<typename ValueType>
+            void PrioritizedStateEliminator<ValueType>::eliminateAllInParallel(std::function<bool (storm::storage::sparse::state_type const&)> const& removeForwardTransitions) {
+                storm::utility::ThreadPool threadPool(numberOfThreads);
+                
+                // The number of states from the front of the priority queue that are considered in each round. States
+                // that are not independent of the states picked before them are considered again in the next round.
+                uint64_t maximalNumberOfCandidates = 4 * threadPool.getNumberOfThreads();
+                std::vector<storm::storage::sparse::state_type> candidates;
+                std::vector<storm::storage::sparse::state_type> postponedCandidates;
+                
+                // The states eliminated in the current round together with whether their forward transitions are removed.
+                std::vector<std::pair<storm::storage::sparse::state_type, bool>> statesOfRound;
+                
+                // The states in the neighbourhoods of the states of the current round.
+                storm::storage::BitVector neighbourhoodStates(this->matrix.getRowCount());
+                std::vector<storm::storage::sparse::state_type> neighbourhoodStateList;
+                
+                // The predecessors whose priority needs to be updated after the current round.
+                std::vector<storm::storage::sparse::state_type> predecessors;
+                
+                uint64_t numberOfRounds = 0;
+                while (!candidates.empty() || priorityQueue->hasNext()) {
+                    while (candidates.size() < maximalNumberOfCandidates && priorityQueue->hasNext()) {
+                        candidates.push_back(priorityQueue->pop());
+                    }
+                    
+                    // Greedily pick the candidates (in the order of their priority) whose neighbourhood is disjoint from
+                    // the neighbourhoods of the candidates picked before. The first candidate is always picked.
+                    for (auto const& state : candidates) {
+                        auto const& successors = this->matrix.getRow(state);
+                        auto const& statePredecessors = this->transposedMatrix.getRow(state);
+                        bool independent = !neighbourhoodStates.get(state);
+                        for (auto successorIt = successors.begin(), successorIte = successors.end(); independent && successorIt != successorIte; ++successorIt) {
+                            independent = !neighbourhoodStates.get(successorIt->getColumn());
+                        }
+                        for (auto predecessorIt = statePredecessors.begin(), predecessorIte = statePredecessors.end(); independent && predecessorIt != predecessorIte; ++predecessorIt) {
+                            independent = !neighbourhoodStates.get(predecessorIt->getColumn());
+                        }
+                        
+                        if (!independent) {
+                            postponedCandidates.push_back(state);
+                            continue;
+                        }
+                        
+                        statesOfRound.emplace_back(state, removeForwardTransitions(state));
+                        neighbourhoodStates.set(state);
+                        neighbourhoodStateList.push_back(state);
+                        for (auto const& entry : successors) {
+                            if (!neighbourhoodStates.get(entry.getColumn())) {
+                                neighbourhoodStates.set(entry.getColumn());
+                                neighbourhoodStateList.push_back(entry.getColumn());
+                            }
+                        }
+                        for (auto const& entry : statePredecessors) {
+                            if (entry.getColumn() != state) {
+                                predecessors.push_back(entry.getColumn());
+                            }
+                            if (!neighbourhoodStates.get(entry.getColumn())) {
+                                neighbourhoodStates.set(entry.getColumn());
+                                neighbourhoodStateList.push_back(entry.getColumn());
+                            }
+                        }
+                    }
+                    
+                    postponePriorityUpdates = true;
+                    threadPool.execute(statesOfRound.size(), [&] (uint64_t chunk, uint64_t) {
+                        storm::storage::sparse::state_type state = statesOfRound[chunk].first;
+                        this->eliminateState(state, statesOfRound[chunk].second);
+                        if (statesOfRound[chunk].second) {
+                            clearStateValues(state);
+                        }
+                    });
+                    postponePriorityUpdates = false;
+                    
+                    for (auto const& predecessor : predecessors) {
+                        priorityQueue->update(predecessor);
+                    }
+                    
+                    for (auto const& state : neighbourhoodStateList) {
+                        neighbourhoodStates.set(state, false);
+                    }
+                    neighbourhoodStateList.clear();
+                    predecessors.clear();
+                    statesOfRound.clear();
+                    candidates.clear();
+                    std::swap(candidates, postponedCandidates);
+                    ++numberOfRounds;
+                }
+                STORM_LOG_DEBUG("Eliminated states in " << numberOfRounds << " rounds using " << threadPool.getNumberOfThreads() << " threads.");
+            }
 
             template<typename ValueType>
             void PrioritizedStateEliminator<ValueType>::clearStateValues(storm::storage::sparse::state_type const &state) {
                 stateValues[state] = storm::utility::zero<ValueType>();
             }
             
+            template<typename ValueType>
+            void PrioritizedStateEliminator<ValueType>::setNumberOfThreads(uint64_t numberOfThreads) {
+                if (numberOfThreads != 1 && !supportsConcurrentElimination<ValueType>()) {
+                    STORM_LOG_WARN("Eliminating states concurrently is only supported for floating point numbers and for rational functions if carl was built thread-safe. Falling back to a single thread.");
+                    numberOfThreads = 1;
+                }
+                this->numberOfThreads = numberOfThreads;
+            }
+            
             template class PrioritizedStateEliminator<double>;
 
 #ifdef STORM_HAVE_CARL
@@ -1,6 +1,8 @@
 #ifndef STORM_SOLVER_STATEELIMINATION_PRIORITIZEDSTATEELIMINATOR_H_
 #define STORM_SOLVER_STATEELIMINATION_PRIORITIZEDSTATEELIMINATOR_H_
 
+#include <functional>
+
 #include "storm/solver/stateelimination/StateEliminator.h"
 
 namespace storm {
@@ -23,10 +25,47 @@ namespace storm {
                 virtual void updatePriority(storm::storage::sparse::state_type const& state) override;
 
                 virtual void eliminateAll(bool eliminateForwardTransitions = true);
+                
+                /*!
+                 * Eliminates all states of the priority queue.
+                 *
+                 * @param removeForwardTransitions Decides for every eliminated state whether its forward transitions
+                 * are removed (and its values cleared).
+                 */
+                void eliminateAll(std::function<bool (storm::storage::sparse::state_type const&)> const& removeForwardTransitions);
+                
                 virtual void clearStateValues(storm::storage::sparse::state_type const& state);
+                
+                /*!
+                 * Sets the number of threads used by eliminateAll. If more than one thread is used, the states are
+                 * eliminated in rounds. In each round, states whose neighbourhoods (the state together with its
+                 * predecessors and successors) are pairwise disjoint are picked from the front of the priority queue
+                 * and eliminated concurrently. As the elimination of a state only modifies the rows and values of
+                 * states in its neighbourhood, the eliminations of a round do not interfere.
+                 *
+                 * Note that the methods that update the values must be safe to call concurrently for distinct states.
+                 * Exact numbers are always eliminated by a single thread, and rational functions only use several
+                 * threads if carl was built thread-safe (STORM_CARL_THREAD_SAFE).
+                 *
+                 * @param numberOfThreads The number of threads. If zero, the number of hardware threads is used.
+                 */
+                void setNumberOfThreads(uint64_t numberOfThreads);
+                
             protected:
                 PriorityQueuePointer priorityQueue;
                 std::vector<ValueType>& stateValues;
+                
+            private:
+                /*!
+                 * Eliminates all states of the priority queue in rounds of independent states (see setNumberOfThreads).
+                 */
+                void eliminateAllInParallel(std::function<bool (storm::storage::sparse::state_type const&)> const& removeForwardTransitions);
+                
+                // The number of threads used by eliminateAll.
+                uint64_t numberOfThreads;
+                
+                // Whether priority updates are postponed, because states are currently eliminated concurrently.
+                bool postponePriorityUpdates;
             };
             
         } // namespace stateelimination
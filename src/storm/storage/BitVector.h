@@ -518,6 +518,9 @@ namespace storm {
             template<typename StateType>
             friend struct Murmur3BitVectorHash;
             
+            template<typename IndexType, typename Hash>
+            friend class ConcurrentBitVectorHashMap;
+            
         private:
             /*!
              * Creates an empty bit vector with the given number of buckets.
@@ -0,0 +1,344 @@
+#include "storm/storage/CompactSparseMatrix.h"
+
+#include <limits>
+#include <type_traits>
+
+#ifdef STORM_HAVE_X86_SIMD_KERNELS
+#include <immintrin.h>
+#endif
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace storage {
+        namespace detail {
+
+            // Computes the product of a row with a vector without vector instructions.
+            template<typename ValueType, typename ColumnType>
+            struct ScalarRowMultiplier {
+                inline ValueType operator()(ValueType result, uint64_t start, uint64_t end) const {
+                    for (uint64_t entry = start; entry < end; ++entry) {
+                        result += values[entry] * vector[columns[entry]];
+                    }
+                    return result;
+                }
+
+                ColumnType const* columns;
+                ValueType const* values;
+                ValueType const* vector;
+            };
+
+            template<typename ValueType, typename RowMultiplier, typename RowIndexType>
+            inline void multiplyWithVector(RowMultiplier const& multiplyRow, std::vector<RowIndexType> const& rowIndications, std::vector<ValueType> const* summand, std::vector<ValueType>& result) {
+                for (uint64_t row = 0, rowCount = result.size(); row < rowCount; ++row) {
+                    result[row] = multiplyRow(summand ? (*summand)[row] : storm::utility::zero<ValueType>(), rowIndications[row], rowIndications[row + 1]);
+                }
+            }
+
+            template<typename ValueType, typename RowMultiplier, typename RowIndexType>
+            inline void multiplyAndReduce(storm::solver::OptimizationDirection const& dir, RowMultiplier const& multiplyRow, std::vector<RowIndexType> const& rowIndications, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices) {
+                bool minimize = storm::solver::minimize(dir);
+                for (uint64_t group = 0, groupCount = result.size(); group < groupCount; ++group) {
+                    ValueType currentValue = storm::utility::zero<ValueType>();
+                    uint64_t currentChoice = 0;
+
+                    // Only multiply and reduce if there is at least one row in the group.
+                    uint64_t row = rowGroupIndices[group];
+                    uint64_t rowEnd = rowGroupIndices[group + 1];
+                    if (row < rowEnd) {
+                        currentValue = multiplyRow(summand ? (*summand)[row] : storm::utility::zero<ValueType>(), rowIndications[row], rowIndications[row + 1]);
+                        for (++row; row < rowEnd; ++row) {
+                            ValueType newValue = multiplyRow(summand ? (*summand)[row] : storm::utility::zero<ValueType>(), rowIndications[row], rowIndications[row + 1]);
+                            if (minimize ? newValue < currentValue : newValue > currentValue) {
+                                currentValue = newValue;
+                                currentChoice = row - rowGroupIndices[group];
+                            }
+                        }
+                    }
+
+                    result[group] = currentValue;
+                    if (choices) {
+                        (*choices)[group] = currentChoice;
+                    }
+                }
+            }
+
+#ifdef STORM_HAVE_X86_SIMD_KERNELS
+            // The functions below are compiled for the respective instruction set only. The entry points are flattened,
+            // so all helpers are inlined into them and no call to a vectorized function remains in the generic code.
+
+            __attribute__((target("avx2,fma")))
+            inline __m256d gatherAvx2(double const* vector, uint32_t const* columns) {
+                __m128i indices = _mm_loadu_si128(reinterpret_cast<__m128i const*>(columns));
+                return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), vector, indices, _mm256_castsi256_pd(_mm256_set1_epi64x(-1)), 8);
+            }
+
+            __attribute__((target("avx2,fma")))
+            inline __m256d gatherAvx2(double const* vector, uint64_t const* columns) {
+                __m256i indices = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(columns));
+                return _mm256_mask_i64gather_pd(_mm256_setzero_pd(), vector, indices, _mm256_castsi256_pd(_mm256_set1_epi64x(-1)), 8);
+            }
+
+            // Computes the product of a row with a vector using AVX2 instructions. The entries that do not fill a full
+            // register are processed without vector instructions.
+            template<typename ColumnType>
+            struct Avx2RowMultiplier {
+                __attribute__((target("avx2,fma")))
+                inline double operator()(double result, uint64_t start, uint64_t end) const {
+                    __m256d sums = _mm256_setzero_pd();
+                    uint64_t entry = start;
+                    for (; entry + 4 <= end; entry += 4) {
+                        sums = _mm256_fmadd_pd(_mm256_loadu_pd(values + entry), gatherAvx2(vector, columns + entry), sums);
+                    }
+                    __m128d halfSums = _mm_add_pd(_mm256_castpd256_pd128(sums), _mm256_extractf128_pd(sums, 1));
+                    result += _mm_cvtsd_f64(_mm_add_sd(halfSums, _mm_unpackhi_pd(halfSums, halfSums)));
+                    for (; entry < end; ++entry) {
+                        result += values[entry] * vector[columns[entry]];
+                    }
+                    return result;
+                }
+
+                ColumnType const* columns;
+                double const* values;
+                double const* vector;
+            };
+
+            __attribute__((target("avx512f")))
+            inline __m512d gatherAvx512(double const* vector, uint32_t const* columns, __mmask8 mask) {
+                __m256i indices = _mm512_castsi512_si256(_mm512_maskz_loadu_epi32(static_cast<__mmask16>(mask), columns));
+                return _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, indices, vector, 8);
+            }
+
+            __attribute__((target("avx512f")))
+            inline __m512d gatherAvx512(double const* vector, uint64_t const* columns, __mmask8 mask) {
+                __m512i indices = _mm512_maskz_loadu_epi64(mask, columns);
+                return _mm512_mask_i64gather_pd(_mm512_setzero_pd(), mask, indices, vector, 8);
+            }
+
+            // Computes the product of a row with a vector using AVX-512 instructions. The remaining entries of a row
+            // are processed with masked instructions.
+            template<typename ColumnType>
+            struct Avx512RowMultiplier {
+                __attribute__((target("avx512f")))
+                inline double operator()(double result, uint64_t start, uint64_t end) const {
+                    __m512d sums = _mm512_setzero_pd();
+                    uint64_t entry = start;
+                    for (; entry + 8 <= end; entry += 8) {
+                        sums = _mm512_fmadd_pd(_mm512_loadu_pd(values + entry), gatherAvx512(vector, columns + entry, 0xFF), sums);
+                    }
+                    if (entry < end) {
+                        __mmask8 mask = static_cast<__mmask8>((1u << (end - entry)) - 1);
+                        sums = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, values + entry), gatherAvx512(vector, columns + entry, mask), sums);
+                    }
+                    return result + _mm512_reduce_add_pd(sums);
+                }
+
+                ColumnType const* columns;
+                double const* values;
+                double const* vector;
+            };
+
+            template<typename ColumnType, typename RowIndexType>
+            __attribute__((target("avx2,fma"), flatten))
+            void multiplyWithVectorAvx2(ColumnType const* columns, std::vector<double> const& values, std::vector<RowIndexType> const& rowIndications, std::vector<double> const& vector, std::vector<double> const* summand, std::vector<double>& result) {
+                multiplyWithVector(Avx2RowMultiplier<ColumnType>{columns, values.data(), vector.data()}, rowIndications, summand, result);
+            }
+
+            template<typename ColumnType, typename RowIndexType>
+            __attribute__((target("avx512f"), flatten))
+            void multiplyWithVectorAvx512(ColumnType const* columns, std::vector<double> const& values, std::vector<RowIndexType> const& rowIndications, std::vector<double> const& vector, std::vector<double> const* summand, std::vector<double>& result) {
+                multiplyWithVector(Avx512RowMultiplier<ColumnType>{columns, values.data(), vector.data()}, rowIndications, summand, result);
+            }
+
+            template<typename ColumnType, typename RowIndexType>
+            __attribute__((target("avx2,fma"), flatten))
+            void multiplyAndReduceAvx2(storm::solver::OptimizationDirection const& dir, ColumnType const* columns, std::vector<double> const& values, std::vector<RowIndexType> const& rowIndications, std::vector<uint64_t> const& rowGroupIndices, std::vector<double> const& vector, std::vector<double> const* summand, std::vector<double>& result, std::vector<uint64_t>* choices) {
+                multiplyAndReduce(dir, Avx2RowMultiplier<ColumnType>{columns, values.data(), vector.data()}, rowIndications, rowGroupIndices, summand, result, choices);
+            }
+
+            template<typename ColumnType, typename RowIndexType>
+            __attribute__((target("avx512f"), flatten))
+            void multiplyAndReduceAvx512(storm::solver::OptimizationDirection const& dir, ColumnType const* columns, std::vector<double> const& values, std::vector<RowIndexType> const& rowIndications, std::vector<uint64_t> const& rowGroupIndices, std::vector<double> const& vector, std::vector<double> const* summand, std::vector<double>& result, std::vector<uint64_t>* choices) {
+                multiplyAndReduce(dir, Avx512RowMultiplier<ColumnType>{columns, values.data(), vector.data()}, rowIndications, rowGroupIndices, summand, result, choices);
+            }
+#endif
+
+            template<typename ValueType, typename ColumnType, typename RowIndexType>
+            void dispatchMultiplyWithVector(storm::utility::simd::SimdKernel const&, ColumnType const* columns, std::vector<ValueType> const& values, std::vector<RowIndexType> const& rowIndications, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result) {
+                multiplyWithVector(ScalarRowMultiplier<ValueType, ColumnType>{columns, values.data(), vector.data()}, rowIndications, summand, result);
+            }
+
+            template<typename ColumnType, typename RowIndexType>
+            void dispatchMultiplyWithVector(storm::utility::simd::SimdKernel const& kernel, ColumnType const* columns, std::vector<double> const& values, std::vector<RowIndexType> const& rowIndications, std::vector<double> const& vector, std::vector<double> const* summand, std::vector<double>& result) {
+                switch (kernel) {
+#ifdef STORM_HAVE_X86_SIMD_KERNELS
+                    case storm::utility::simd::SimdKernel::Avx512:
+                        multiplyWithVectorAvx512(columns, values, rowIndications, vector, summand, result);
+                        return;
+                    case storm::utility::simd::SimdKernel::Avx2:
+                        multiplyWithVectorAvx2(columns, values, rowIndications, vector, summand, result);
+                        return;
+#endif
+                    default:
+                        multiplyWithVector(ScalarRowMultiplier<double, ColumnType>{columns, values.data(), vector.data()}, rowIndications, summand, result);
+                }
+            }
+
+            template<typename ValueType, typename ColumnType, typename RowIndexType>
+            void dispatchMultiplyAndReduce(storm::utility::simd::SimdKernel const&, storm::solver::OptimizationDirection const& dir, ColumnType const* columns, std::vector<ValueType> const& values, std::vector<RowIndexType> const& rowIndications, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices) {
+                multiplyAndReduce(dir, ScalarRowMultiplier<ValueType, ColumnType>{columns, values.data(), vector.data()}, rowIndications, rowGroupIndices, summand, result, choices);
+            }
+
+            template<typename ColumnType, typename RowIndexType>
+            void dispatchMultiplyAndReduce(storm::utility::simd::SimdKernel const& kernel, storm::solver::OptimizationDirection const& dir, ColumnType const* columns, std::vector<double> const& values, std::vector<RowIndexType> const& rowIndications, std::vector<uint64_t> const& rowGroupIndices, std::vector<double> const& vector, std::vector<double> const* summand, std::vector<double>& result, std::vector<uint64_t>* choices) {
+                switch (kernel) {
+#ifdef STORM_HAVE_X86_SIMD_KERNELS
+                    case storm::utility::simd::SimdKernel::Avx512:
+                        multiplyAndReduceAvx512(dir, columns, values, rowIndications, rowGroupIndices, vector, summand, result, choices);
+                        return;
+                    case storm::utility::simd::SimdKernel::Avx2:
+                        multiplyAndReduceAvx2(dir, columns, values, rowIndications, rowGroupIndices, vector, summand, result, choices);
+                        return;
+#endif
+                    default:
+                        multiplyAndReduce(dir, ScalarRowMultiplier<double, ColumnType>{columns, values.data(), vector.data()}, rowIndications, rowGroupIndices, summand, result, choices);
+                }
+            }
+        }
+
+        template<typename ValueType>
+        CompactSparseMatrix<ValueType>::CompactSparseMatrix(storm::storage::SparseMatrix<ValueType> const& matrix, storm::utility::simd::SimdKernel const& kernel) : columnCount(matrix.getColumnCount()), kernel(kernel) {
+            STORM_LOG_THROW(storm::utility::simd::isSupported(kernel), storm::exceptions::NotSupportedException, "The " << kernel << " kernel is not supported on this machine.");
+            STORM_LOG_WARN_COND(kernel == storm::utility::simd::SimdKernel::None || std::is_same<ValueType, double>::value, "The " << kernel << " kernel is only available for double precision, falling back to scalar multiplications.");
+
+            // The gather instructions interpret 32-bit indices as signed integers, so we only use them if all column
+            // indices are non-negative in that interpretation. The row indications are positions of entries, so they
+            // only need to be unsigned.
+            bool useCompactColumns = columnCount <= static_cast<uint64_t>(std::numeric_limits<int32_t>::max());
+            bool useCompactRowIndications = matrix.getEntryCount() <= static_cast<uint64_t>(std::numeric_limits<uint32_t>::max());
+            if (useCompactRowIndications) {
+                compactRowIndications.reserve(matrix.getRowCount() + 1);
+                compactRowIndications.push_back(0);
+            } else {
+                rowIndications.reserve(matrix.getRowCount() + 1);
+                rowIndications.push_back(0);
+            }
+            values.reserve(matrix.getEntryCount());
+            if (useCompactColumns) {
+                compactColumns.reserve(matrix.getEntryCount());
+            } else {
+                columns.reserve(matrix.getEntryCount());
+            }
+
+            for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                for (auto const& entry : matrix.getRow(row)) {
+                    if (useCompactColumns) {
+                        compactColumns.push_back(static_cast<uint32_t>(entry.getColumn()));
+                    } else {
+                        columns.push_back(entry.getColumn());
+                    }
+                    values.push_back(entry.getValue());
+                }
+                if (useCompactRowIndications) {
+                    compactRowIndications.push_back(static_cast<uint32_t>(values.size()));
+                } else {
+                    rowIndications.push_back(values.size());
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
+            STORM_LOG_ASSERT(vector.size() >= getColumnCount(), "Vector is too small.");
+            STORM_LOG_ASSERT(result.size() == getRowCount(), "Result vector has wrong size.");
+            STORM_LOG_ASSERT(&vector != &result, "Vector and result must not be aliases.");
+            if (hasCompactRowIndications()) {
+                multiplyWithVector(compactRowIndications, vector, result, summand);
+            } else {
+                multiplyWithVector(rowIndications, vector, result, summand);
+            }
+        }
+
+        template<typename ValueType>
+        template<typename RowIndexType>
+        void CompactSparseMatrix<ValueType>::multiplyWithVector(std::vector<RowIndexType> const& rowStarts, std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
+            if (hasCompactColumnIndices()) {
+                detail::dispatchMultiplyWithVector(kernel, compactColumns.data(), values, rowStarts, vector, summand, result);
+            } else {
+                detail::dispatchMultiplyWithVector(kernel, columns.data(), values, rowStarts, vector, summand, result);
+            }
+        }
+
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+            STORM_LOG_ASSERT(vector.size() >= getColumnCount(), "Vector is too small.");
+            STORM_LOG_ASSERT(rowGroupIndices.size() == result.size() + 1, "Result vector does not match the row grouping.");
+            STORM_LOG_ASSERT(&vector != &result, "Vector and result must not be aliases.");
+            if (hasCompactRowIndications()) {
+                multiplyAndReduce(compactRowIndications, dir, rowGroupIndices, vector, summand, result, choices);
+            } else {
+                multiplyAndReduce(rowIndications, dir, rowGroupIndices, vector, summand, result, choices);
+            }
+        }
+
+        template<typename ValueType>
+        template<typename RowIndexType>
+        void CompactSparseMatrix<ValueType>::multiplyAndReduce(std::vector<RowIndexType> const& rowStarts, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+            if (hasCompactColumnIndices()) {
+                detail::dispatchMultiplyAndReduce(kernel, dir, compactColumns.data(), values, rowStarts, rowGroupIndices, vector, summand, result, choices);
+            } else {
+                detail::dispatchMultiplyAndReduce(kernel, dir, columns.data(), values, rowStarts, rowGroupIndices, vector, summand, result, choices);
+            }
+        }
+
+#ifdef STORM_HAVE_CARL
+        template<>
+        void CompactSparseMatrix<storm::RationalFunction>::multiplyAndReduce(storm::solver::OptimizationDirection const&, std::vector<uint64_t> const&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, std::vector<storm::RationalFunction>&, std::vector<uint64_t>*) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+
+        template<typename ValueType>
+        uint64_t CompactSparseMatrix<ValueType>::getRowCount() const {
+            return (hasCompactRowIndications() ? compactRowIndications.size() : rowIndications.size()) - 1;
+        }
+
+        template<typename ValueType>
+        uint64_t CompactSparseMatrix<ValueType>::getColumnCount() const {
+            return columnCount;
+        }
+
+        template<typename ValueType>
+        uint64_t CompactSparseMatrix<ValueType>::getEntryCount() const {
+            return values.size();
+        }
+
+        template<typename ValueType>
+        bool CompactSparseMatrix<ValueType>::hasCompactColumnIndices() const {
+            return columns.empty();
+        }
+
+        template<typename ValueType>
+        bool CompactSparseMatrix<ValueType>::hasCompactRowIndications() const {
+            return rowIndications.empty();
+        }
+
+        template<typename ValueType>
+        storm::utility::simd::SimdKernel const& CompactSparseMatrix<ValueType>::getKernel() const {
+            return kernel;
+        }
+
+        template class CompactSparseMatrix<double>;
+
+#ifdef STORM_HAVE_CARL
+        template class CompactSparseMatrix<storm::RationalNumber>;
+        template class CompactSparseMatrix<storm::RationalFunction>;
+#endif
+    }
+}
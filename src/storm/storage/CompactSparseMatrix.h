@@ -0,0 +1,124 @@
+#ifndef STORM_STORAGE_COMPACTSPARSEMATRIX_H_
+#define STORM_STORAGE_COMPACTSPARSEMATRIX_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/utility/simd.h"
+
+namespace storm {
+    namespace storage {
+        template<typename ValueType>
+        class SparseMatrix;
+
+        /*!
+         * A read-only copy of a sparse matrix that is tailored towards fast matrix-vector multiplication. In contrast to
+         * the sparse matrix, the column indices and values of the entries are stored in two separate arrays and the
+         * column indices and row indications are stored with 32 bits whenever the number of columns and entries,
+         * respectively, permits it. This reduces the memory required by the copy and the memory bandwidth required by
+         * a multiplication and allows to load several entries with single vector instructions.
+         *
+         * For double-precision matrices, the multiplications are performed with AVX2 or AVX-512 instructions if the
+         * corresponding kernel is selected. Note that this may change the order in which the products of a row are
+         * summed up, so the results can deviate from the ones of the sparse matrix in the last bits.
+         */
+        template<typename ValueType>
+        class CompactSparseMatrix {
+        public:
+            /*!
+             * Creates a compact copy of the given matrix.
+             *
+             * @param matrix The matrix to copy.
+             * @param kernel The kernel that is to be used for multiplications. The kernel must be supported by the
+             * current machine.
+             */
+            CompactSparseMatrix(storm::storage::SparseMatrix<ValueType> const& matrix, storm::utility::simd::SimdKernel const& kernel = storm::utility::simd::SimdKernel::None);
+
+            /*!
+             * Multiplies the matrix with the given vector and writes the result to the given result vector.
+             *
+             * @param vector The vector with which to multiply the matrix.
+             * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             */
+            void multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand = nullptr) const;
+
+            /*!
+             * Multiplies the matrix with the given vector, reduces it according to the given direction and row grouping
+             * and writes the result to the given result vector. This is equivalent to the method of the same name of
+             * the sparse matrix.
+             *
+             * @param dir The optimization direction for the reduction.
+             * @param rowGroupIndices The row groups for the reduction.
+             * @param vector The vector with which to multiply the matrix.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param choices If given, the choices made in the reduction process will be written to this vector.
+             */
+            void multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const;
+
+            /*!
+             * Retrieves the number of rows of the matrix.
+             */
+            uint64_t getRowCount() const;
+
+            /*!
+             * Retrieves the number of columns of the matrix.
+             */
+            uint64_t getColumnCount() const;
+
+            /*!
+             * Retrieves the number of entries of the matrix.
+             */
+            uint64_t getEntryCount() const;
+
+            /*!
+             * Retrieves whether the column indices are stored with 32 bits.
+             */
+            bool hasCompactColumnIndices() const;
+
+            /*!
+             * Retrieves whether the row indications are stored with 32 bits.
+             */
+            bool hasCompactRowIndications() const;
+
+            /*!
+             * Retrieves the kernel that is used for multiplications.
+             */
+            storm::utility::simd::SimdKernel const& getKernel() const;
+
+        private:
+            // Performs the multiplication with the given row indications, which are one of the two arrays below.
+            template<typename RowIndexType>
+            void multiplyWithVector(std::vector<RowIndexType> const& rowStarts, std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const;
+
+            // Performs the multiplication and reduction with the given row indications, which are one of the two
+            // arrays below.
+            template<typename RowIndexType>
+            void multiplyAndReduce(std::vector<RowIndexType> const& rowStarts, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const;
+
+            // The number of columns of the matrix.
+            uint64_t columnCount;
+
+            // The kernel that is used for multiplications.
+            storm::utility::simd::SimdKernel kernel;
+
+            // The positions at which the rows start in the arrays of column indices and values. Only one of the two
+            // vectors is used, depending on whether the number of entries fits into 32 bits.
+            std::vector<uint32_t> compactRowIndications;
+            std::vector<uint64_t> rowIndications;
+
+            // The column indices of the entries. Only one of the two vectors is used, depending on whether the column
+            // indices fit into 32 bits.
+            std::vector<uint32_t> compactColumns;
+            std::vector<uint64_t> columns;
+
+            // The values of the entries.
+            std::vector<ValueType> values;
+        };
+
+    }
+}
+
+#endif /* STORM_STORAGE_COMPACTSPARSEMATRIX_H_ */
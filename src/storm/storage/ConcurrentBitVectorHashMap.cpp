@@ -0,0 +1,251 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <cstring>
+#include <limits>
+#include <thread>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/OutOfRangeException.h"
+
+namespace storm {
+    namespace storage {
+        template<class IndexType, class Hash>
+        ConcurrentBitVectorHashMap<IndexType, Hash>::ConcurrentBitVectorHashMapIterator::ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map, IndexType index) : map(map), index(index) {
+            // Intentionally left empty.
+        }
+
+        template<class IndexType, class Hash>
+        bool ConcurrentBitVectorHashMap<IndexType, Hash>::ConcurrentBitVectorHashMapIterator::operator==(ConcurrentBitVectorHashMapIterator const& other) {
+            return &map == &other.map && index == other.index;
+        }
+
+        template<class IndexType, class Hash>
+        bool ConcurrentBitVectorHashMap<IndexType, Hash>::ConcurrentBitVectorHashMapIterator::operator!=(ConcurrentBitVectorHashMapIterator const& other) {
+            return !(*this == other);
+        }
+
+        template<class IndexType, class Hash>
+        typename ConcurrentBitVectorHashMap<IndexType, Hash>::ConcurrentBitVectorHashMapIterator& ConcurrentBitVectorHashMap<IndexType, Hash>::ConcurrentBitVectorHashMapIterator::operator++(int) {
+            ++index;
+            return *this;
+        }
+
+        template<class IndexType, class Hash>
+        typename ConcurrentBitVectorHashMap<IndexType, Hash>::ConcurrentBitVectorHashMapIterator& ConcurrentBitVectorHashMap<IndexType, Hash>::ConcurrentBitVectorHashMapIterator::operator++() {
+            ++index;
+            return *this;
+        }
+
+        template<class IndexType, class Hash>
+        std::pair<storm::storage::BitVector, IndexType> ConcurrentBitVectorHashMap<IndexType, Hash>::ConcurrentBitVectorHashMapIterator::operator*() const {
+            return std::make_pair(map.getKey(index), index);
+        }
+
+        template<class IndexType, class Hash>
+        ConcurrentBitVectorHashMap<IndexType, Hash>::Table::Table(uint64_t logCapacity) : logCapacity(logCapacity), slots(new std::atomic<uint64_t>[1ull << logCapacity]), numberOfClaimedSlots(0), next(nullptr) {
+            for (uint64_t slot = 0; slot < (1ull << logCapacity); ++slot) {
+                slots[slot].store(0, std::memory_order_relaxed);
+            }
+        }
+
+        template<class IndexType, class Hash>
+        ConcurrentBitVectorHashMap<IndexType, Hash>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor) : loadFactor(loadFactor), bucketSize(bucketSize), wordsPerKey(bucketSize / 64), numberOfElements(0) {
+            STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+            STORM_LOG_ASSERT(loadFactor > 0 && loadFactor < 1, "Load factor must be in (0, 1).");
+
+            // Reserve enough slots to hold the initial number of keys without exceeding the load factor.
+            uint64_t logCapacity = 4;
+            while (static_cast<double>(1ull << logCapacity) * loadFactor < initialSize) {
+                ++logCapacity;
+            }
+            firstTable = std::make_unique<Table>(logCapacity);
+
+            for (auto& segment : keySegments) {
+                segment.store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        template<class IndexType, class Hash>
+        ConcurrentBitVectorHashMap<IndexType, Hash>::~ConcurrentBitVectorHashMap() {
+            Table* table = firstTable->next.load();
+            while (table != nullptr) {
+                Table* next = table->next.load();
+                delete table;
+                table = next;
+            }
+            for (auto& segment : keySegments) {
+                delete[] segment.load();
+            }
+        }
+
+        template<class IndexType, class Hash>
+        std::pair<IndexType, bool> ConcurrentBitVectorHashMap<IndexType, Hash>::findOrAdd(storm::storage::BitVector const& key) {
+            std::pair<uint64_t, bool> indexFlagPair = findOrInsert(key, true);
+            return std::make_pair(static_cast<IndexType>(indexFlagPair.first - 1), indexFlagPair.second);
+        }
+
+        template<class IndexType, class Hash>
+        IndexType ConcurrentBitVectorHashMap<IndexType, Hash>::getValue(storm::storage::BitVector const& key) const {
+            uint64_t index = findOrInsert(key, false).first;
+            STORM_LOG_ASSERT(index != 0, "Unknown key.");
+            return static_cast<IndexType>(index - 1);
+        }
+
+        template<class IndexType, class Hash>
+        bool ConcurrentBitVectorHashMap<IndexType, Hash>::contains(storm::storage::BitVector const& key) const {
+            return findOrInsert(key, false).first != 0;
+        }
+
+        template<class IndexType, class Hash>
+        storm::storage::BitVector ConcurrentBitVectorHashMap<IndexType, Hash>::getKey(IndexType index) const {
+            storm::storage::BitVector result(wordsPerKey, bucketSize);
+            std::memcpy(result.buckets, getKeyStorage(index, false), wordsPerKey * sizeof(uint64_t));
+            return result;
+        }
+
+        template<class IndexType, class Hash>
+        typename ConcurrentBitVectorHashMap<IndexType, Hash>::const_iterator ConcurrentBitVectorHashMap<IndexType, Hash>::begin() const {
+            return const_iterator(*this, 0);
+        }
+
+        template<class IndexType, class Hash>
+        typename ConcurrentBitVectorHashMap<IndexType, Hash>::const_iterator ConcurrentBitVectorHashMap<IndexType, Hash>::end() const {
+            return const_iterator(*this, static_cast<IndexType>(size()));
+        }
+
+        template<class IndexType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<IndexType, Hash>::size() const {
+            return numberOfElements.load();
+        }
+
+        template<class IndexType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<IndexType, Hash>::capacity() const {
+            uint64_t result = 0;
+            for (Table const* table = firstTable.get(); table != nullptr; table = table->next.load()) {
+                result += 1ull << table->logCapacity;
+            }
+            return result;
+        }
+
+        template<class IndexType, class Hash>
+        std::pair<uint64_t, bool> ConcurrentBitVectorHashMap<IndexType, Hash>::findOrInsert(storm::storage::BitVector const& key, bool insert) const {
+            uint64_t hash = hasher(key);
+            uint64_t fragment = hash << indexBits;
+
+            // The correctness of the insertion relies on the following invariant: a thread only inserts the key into
+            // a table if the table had no successor before it started probing and still has none after it claimed
+            // the slot. Since every thread searches the tables from the oldest to the newest one and reads the
+            // successor before probing a table, no key can be inserted into two tables.
+            Table* table = firstTable.get();
+            while (true) {
+                Table* next = table->next.load();
+                uint64_t mask = (1ull << table->logCapacity) - 1;
+                uint64_t bucket = hash >> (64 - table->logCapacity);
+
+                while (true) {
+                    uint64_t slot = table->slots[bucket].load();
+                    if (slot == 0) {
+                        // The key is not contained in this table.
+                        if (next != nullptr || !insert) {
+                            break;
+                        }
+                        if (!table->slots[bucket].compare_exchange_strong(slot, fragment | busyMarker)) {
+                            // Another thread claimed the slot in the meantime, so we need to inspect it again.
+                            continue;
+                        }
+                        table->numberOfClaimedSlots.fetch_add(1);
+
+                        if (table->next.load() != nullptr) {
+                            // A successor was appended while we were probing, so the key might have been inserted
+                            // there. We therefore release the slot and continue the search in the successor.
+                            table->slots[bucket].store(releasedMarker);
+                            next = table->next.load();
+                            break;
+                        }
+
+                        uint64_t index = numberOfElements.fetch_add(1);
+                        if (index >= releasedMarker - 1 || index >= std::numeric_limits<IndexType>::max()) {
+                            // Release the slot before throwing, as other threads probing this bucket wait for it.
+                            numberOfElements.fetch_sub(1);
+                            table->slots[bucket].store(releasedMarker);
+                            STORM_LOG_THROW(false, storm::exceptions::OutOfRangeException, "Too many keys in concurrent hash map.");
+                        }
+                        std::memcpy(getKeyStorage(index, true), key.buckets, wordsPerKey * sizeof(uint64_t));
+                        table->slots[bucket].store(fragment | (index + 1));
+
+                        if (static_cast<double>(table->numberOfClaimedSlots.load()) >= loadFactor * (1ull << table->logCapacity)) {
+                            appendTable(*table);
+                        }
+                        return std::make_pair(index + 1, true);
+                    }
+
+                    if ((slot & ~indexMask) == fragment) {
+                        // Wait until the thread that claimed the slot has stored the key.
+                        while ((slot & indexMask) == busyMarker) {
+                            std::this_thread::yield();
+                            slot = table->slots[bucket].load();
+                        }
+                        uint64_t index = slot & indexMask;
+                        if (index != releasedMarker && keyMatches(index - 1, key)) {
+                            return std::make_pair(index, false);
+                        }
+                    }
+                    bucket = (bucket + 1) & mask;
+                }
+
+                if (next == nullptr) {
+                    return std::make_pair(0, false);
+                }
+                table = next;
+            }
+        }
+
+        template<class IndexType, class Hash>
+        void ConcurrentBitVectorHashMap<IndexType, Hash>::appendTable(Table& table) const {
+            if (table.next.load() != nullptr) {
+                return;
+            }
+
+            // The new table is four times as large as its predecessor to keep the chain of tables short.
+            Table* newTable = new Table(table.logCapacity + 2);
+            Table* expected = nullptr;
+            if (table.next.compare_exchange_strong(expected, newTable)) {
+                STORM_LOG_TRACE("Appended table with " << (1ull << newTable->logCapacity) << " slots to concurrent hash map.");
+            } else {
+                // Another thread appended a table first.
+                delete newTable;
+            }
+        }
+
+        template<class IndexType, class Hash>
+        uint64_t* ConcurrentBitVectorHashMap<IndexType, Hash>::getKeyStorage(uint64_t index, bool allocate) const {
+            // Segment i holds the keys with indices in [2^(i+l) - 2^l, 2^(i+l+1) - 2^l), where l is the logarithm of
+            // the size of the first segment.
+            uint64_t position = index + (1ull << logFirstSegmentSize);
+            uint64_t logPosition = 63 - __builtin_clzll(position);
+            uint64_t segmentIndex = logPosition - logFirstSegmentSize;
+            uint64_t offset = position - (1ull << logPosition);
+
+            uint64_t* segment = keySegments[segmentIndex].load();
+            if (segment == nullptr && allocate) {
+                uint64_t* newSegment = new uint64_t[(1ull << logPosition) * wordsPerKey];
+                if (keySegments[segmentIndex].compare_exchange_strong(segment, newSegment)) {
+                    segment = newSegment;
+                } else {
+                    // Another thread allocated the segment first.
+                    delete[] newSegment;
+                }
+            }
+            STORM_LOG_ASSERT(segment != nullptr, "Access to key that was not stored.");
+            return segment + offset * wordsPerKey;
+        }
+
+        template<class IndexType, class Hash>
+        bool ConcurrentBitVectorHashMap<IndexType, Hash>::keyMatches(uint64_t index, storm::storage::BitVector const& key) const {
+            return std::memcmp(getKeyStorage(index, false), key.buckets, wordsPerKey * sizeof(uint64_t)) == 0;
+        }
+
+        template class ConcurrentBitVectorHashMap<uint64_t>;
+        template class ConcurrentBitVectorHashMap<uint32_t>;
+    }
+}
@@ -0,0 +1,219 @@
+#ifndef STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_
+#define STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_
+
+#include <cstdint>
+#include <atomic>
+#include <array>
+#include <memory>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * This class represents a hash map whose keys are bit vectors of a fixed length (that must be a multiple of 64)
+         * and that can be accessed by several threads concurrently. In contrast to the BitVectorHashMap, the map does
+         * not store arbitrary values, but assigns the indices 0, 1, 2, ... to the keys in the order of their insertion.
+         * These indices are stable, i.e. they do not change when the map grows, and the key of a given index can be
+         * retrieved.
+         *
+         * Insertions and lookups do not acquire any locks. The map consists of a chain of open-addressing tables. If
+         * the load of the newest table exceeds the load factor, a larger table is appended to the chain and all further
+         * keys are inserted into that one. Existing entries are never moved, so growing does not require rehashing
+         * the entries while other threads are waiting.
+         */
+        template<typename IndexType, typename Hash = Murmur3BitVectorHash<uint64_t>>
+        class ConcurrentBitVectorHashMap {
+        public:
+            class ConcurrentBitVectorHashMapIterator {
+            public:
+                /*!
+                 * Creates an iterator that points to the key with the given index in the given map.
+                 *
+                 * @param map The map of the iterator.
+                 * @param index The index of the key the iterator points to.
+                 */
+                ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map, IndexType index);
+
+                // Methods to compare two iterators.
+                bool operator==(ConcurrentBitVectorHashMapIterator const& other);
+                bool operator!=(ConcurrentBitVectorHashMapIterator const& other);
+
+                // Methods to move iterator forward.
+                ConcurrentBitVectorHashMapIterator& operator++(int);
+                ConcurrentBitVectorHashMapIterator& operator++();
+
+                // Method to retrieve the currently pointed-to bit vector and its index.
+                std::pair<storm::storage::BitVector, IndexType> operator*() const;
+
+            private:
+                // The map this iterator refers to.
+                ConcurrentBitVectorHashMap const& map;
+
+                // The index of the key this iterator points to.
+                IndexType index;
+            };
+
+            typedef ConcurrentBitVectorHashMapIterator const_iterator;
+
+            /*!
+             * Creates a new hash map for keys of the given size.
+             *
+             * @param bucketSize The size of the keys that this map can hold. This value must be a multiple of 64.
+             * @param initialSize The number of keys for which space is initially reserved.
+             * @param loadFactor The load factor that determines at which point a new table is appended.
+             */
+            ConcurrentBitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.5);
+
+            ~ConcurrentBitVectorHashMap();
+
+            ConcurrentBitVectorHashMap(ConcurrentBitVectorHashMap const&) = delete;
+            ConcurrentBitVectorHashMap& operator=(ConcurrentBitVectorHashMap const&) = delete;
+
+            /*!
+             * Searches for the given key in the map. If it is not found, it is inserted and assigned the next free
+             * index. This method may be called by several threads concurrently.
+             *
+             * @param key The key to search or insert.
+             * @return A pair whose first component is the index of the key and whose second component indicates
+             * whether the key was inserted by this call.
+             */
+            std::pair<IndexType, bool> findOrAdd(storm::storage::BitVector const& key);
+
+            /*!
+             * Retrieves the index of the given key. If the key does not exist, the behaviour is undefined.
+             *
+             * @param key The key to search.
+             * @return The index of the given key.
+             */
+            IndexType getValue(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Checks if the given key is already contained in the map.
+             *
+             * @param key The key to search.
+             * @return True if the key is already contained in the map.
+             */
+            bool contains(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Retrieves the key with the given index.
+             *
+             * @param index The index of the key. This must be smaller than the size of the map.
+             * @return The key with the given index.
+             */
+            storm::storage::BitVector getKey(IndexType index) const;
+
+            /*!
+             * Retrieves an iterator to the elements of the map. The elements are visited in the order of their indices.
+             * The map must not be modified while it is iterated.
+             *
+             * @return The iterator.
+             */
+            const_iterator begin() const;
+
+            /*!
+             * Retrieves an iterator that points one past the elements of the map.
+             *
+             * @return The iterator.
+             */
+            const_iterator end() const;
+
+            /*!
+             * Retrieves the size of the map in terms of the number of keys it stores. If keys are inserted concurrently,
+             * this also includes the keys whose insertion has not yet been completed.
+             *
+             * @return The size of the map.
+             */
+            uint64_t size() const;
+
+            /*!
+             * Retrieves the number of slots of all tables of the map.
+             *
+             * @return The capacity of the map.
+             */
+            uint64_t capacity() const;
+
+        private:
+            // One of the open-addressing tables in the chain of tables.
+            struct Table {
+                Table(uint64_t logCapacity);
+
+                // The number of slots is 2^logCapacity.
+                uint64_t logCapacity;
+
+                // The slots of the table. Each slot holds a fragment of the hash of the key in its upper bits and the
+                // index of the key (plus one) in its lower bits. A value of zero represents an empty slot.
+                std::unique_ptr<std::atomic<uint64_t>[]> slots;
+
+                // The number of slots that were claimed.
+                std::atomic<uint64_t> numberOfClaimedSlots;
+
+                // The next (larger) table in the chain. Once this is set, no more keys are inserted into this table.
+                std::atomic<Table*> next;
+            };
+
+            /*!
+             * Searches the key in the table chain. If the key is not found and the corresponding flag is set, it is
+             * inserted into the newest table.
+             *
+             * @param key The key to search.
+             * @param insert If set, the key is inserted if it is not found.
+             * @return A pair whose first component is the index of the key plus one (or zero if it was not found) and
+             * whose second component indicates whether the key was inserted.
+             */
+            std::pair<uint64_t, bool> findOrInsert(storm::storage::BitVector const& key, bool insert) const;
+
+            /*!
+             * Appends a new table to the given table if there is no successor yet.
+             */
+            void appendTable(Table& table) const;
+
+            /*!
+             * Retrieves a pointer to the storage of the key with the given index. If the corresponding segment was not
+             * yet allocated and the flag is set, it is allocated.
+             */
+            uint64_t* getKeyStorage(uint64_t index, bool allocate) const;
+
+            /*!
+             * Checks whether the key with the given index is equal to the given key.
+             */
+            bool keyMatches(uint64_t index, storm::storage::BitVector const& key) const;
+
+            // The number of low-order bits of a slot that store the index of the key.
+            static const uint64_t indexBits = 40;
+            static const uint64_t indexMask = (1ull << indexBits) - 1;
+
+            // Markers stored in the index part of a slot that is currently being filled or was released again.
+            static const uint64_t busyMarker = indexMask;
+            static const uint64_t releasedMarker = indexMask - 1;
+
+            // The number of keys of the first segment of the key storage is 2^logFirstSegmentSize. Every further
+            // segment is twice as large as its predecessor.
+            static const uint64_t logFirstSegmentSize = 10;
+
+            // The load factor determining when a new table is appended.
+            double loadFactor;
+
+            // The size of one key in bits and in 64-bit words.
+            uint64_t bucketSize;
+            uint64_t wordsPerKey;
+
+            // The first table of the chain of tables.
+            std::unique_ptr<Table> firstTable;
+
+            // The segments storing the keys. The segments are allocated on demand.
+            mutable std::array<std::atomic<uint64_t*>, 64 - logFirstSegmentSize> keySegments;
+
+            // The number of indices that were assigned so far.
+            mutable std::atomic<uint64_t> numberOfElements;
+
+            // Functor object that is used to perform the actual hashing.
+            Hash hasher;
+        };
+
+    }
+}
+
+#endif /* STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_ */
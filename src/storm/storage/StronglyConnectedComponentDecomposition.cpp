@@ -2,6 +2,11 @@
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/ThreadPool.h"
+#include "storm/utility/Instrumentation.h"
+
+#include <atomic>
+#include <limits>
 
 namespace storm {
     namespace storage {
@@ -42,8 +47,8 @@ namespace storm {
         }
 
         template <typename ValueType>
-        StronglyConnectedComponentDecomposition<ValueType>::StronglyConnectedComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, bool dropNaiveSccs, bool onlyBottomSccs) {
-            performSccDecomposition(transitionMatrix, subsystem, dropNaiveSccs, onlyBottomSccs);
+        StronglyConnectedComponentDecomposition<ValueType>::StronglyConnectedComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, bool dropNaiveSccs, bool onlyBottomSccs, uint64_t numberOfThreads) {
+            performSccDecomposition(transitionMatrix, subsystem, dropNaiveSccs, onlyBottomSccs, numberOfThreads);
         }
         
         template <typename ValueType>
@@ -69,31 +74,42 @@ namespace storm {
         }
 
         template <typename ValueType>
-        void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, bool dropNaiveSccs, bool onlyBottomSccs) {
+        void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, bool dropNaiveSccs, bool onlyBottomSccs, uint64_t numberOfThreads) {
+            storm::utility::instrumentation::Scope scope("scc decomposition");
             uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
 
-            // Set up the environment of the algorithm.
-            // Start with the two stacks it maintains.
-            std::vector<uint_fast64_t> s;
-            s.reserve(numberOfStates);
-            std::vector<uint_fast64_t> p;
-            p.reserve(numberOfStates);
-            
-            // We also need to store the preorder numbers of states and which states have been assigned to which SCC.
-            std::vector<uint_fast64_t> preorderNumbers(numberOfStates);
-            storm::storage::BitVector hasPreorderNumber(numberOfStates);
-            storm::storage::BitVector stateHasScc(numberOfStates);
             std::vector<uint_fast64_t> stateToSccMapping(numberOfStates);
             uint_fast64_t sccCount = 0;
             
-            // Finally, we need to keep track of the states with a self-loop to identify naive SCCs.
+            // We need to keep track of the states with a self-loop to identify naive SCCs.
             storm::storage::BitVector statesWithSelfLoop(numberOfStates);
             
-            // Start the search for SCCs from every state in the block.
-            uint_fast64_t currentIndex = 0;
-            for (auto state : subsystem) {
-                if (!hasPreorderNumber.get(state)) {
-                    performSccDecompositionGCM(transitionMatrix, state, statesWithSelfLoop, subsystem, currentIndex, hasPreorderNumber, preorderNumbers, s, p, stateHasScc, stateToSccMapping, sccCount);
+            // Exact numbers are reference counted without synchronization, so they must not be shared between threads.
+            if (!std::is_same<ValueType, double>::value && numberOfThreads != 1) {
+                STORM_LOG_WARN("Computing SCCs concurrently is only supported for floating point numbers. Falling back to a single thread.");
+                numberOfThreads = 1;
+            }
+            if (numberOfThreads != 1) {
+                sccCount = performParallelSccDecomposition(transitionMatrix, subsystem, numberOfThreads, statesWithSelfLoop, stateToSccMapping);
+            } else {
+                // Set up the environment of the algorithm.
+                // Start with the two stacks it maintains.
+                std::vector<uint_fast64_t> s;
+                s.reserve(numberOfStates);
+                std::vector<uint_fast64_t> p;
+                p.reserve(numberOfStates);
+                
+                // We also need to store the preorder numbers of states and which states have been assigned to which SCC.
+                std::vector<uint_fast64_t> preorderNumbers(numberOfStates);
+                storm::storage::BitVector hasPreorderNumber(numberOfStates);
+                storm::storage::BitVector stateHasScc(numberOfStates);
+                
+                // Start the search for SCCs from every state in the block.
+                uint_fast64_t currentIndex = 0;
+                for (auto state : subsystem) {
+                    if (!hasPreorderNumber.get(state)) {
+                        performSccDecompositionGCM(transitionMatrix, state, statesWithSelfLoop, subsystem, currentIndex, hasPreorderNumber, preorderNumbers, s, p, stateHasScc, stateToSccMapping, sccCount);
+                    }
                 }
             }
 
@@ -167,6 +183,253 @@ namespace storm {
             performSccDecomposition(model.getTransitionMatrix(), fullSystem, dropNaiveSccs, onlyBottomSccs);
         }
         
+        template <typename ValueType>
+        uint_fast64_t StronglyConnectedComponentDecomposition<ValueType>::performParallelSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, uint64_t numberOfThreads, storm::storage::BitVector& statesWithSelfLoop, std::vector<uint_fast64_t>& stateToSccMapping) {
+            uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
+            storm::utility::ThreadPool threadPool(numberOfThreads);
+            
+            // Applies the given function to all given states. The states are split into contiguous chunks.
+            auto parallelForEach = [&threadPool] (std::vector<uint_fast64_t> const& states, auto const& function) {
+                uint64_t numberOfChunks = std::max<uint64_t>(1, std::min<uint64_t>(states.size() / 1024, threadPool.getNumberOfThreads() * 16));
+                threadPool.execute(numberOfChunks, [&] (uint64_t chunk, uint64_t) {
+                    for (uint64_t index = states.size() * chunk / numberOfChunks, end = states.size() * (chunk + 1) / numberOfChunks; index < end; ++index) {
+                        function(states[index]);
+                    }
+                });
+            };
+            
+            // First, we build the successor and predecessor relation of the subsystem. We drop self-loops, but
+            // remember the states that have one.
+            std::vector<uint_fast64_t> subsystemStates(subsystem.begin(), subsystem.end());
+            std::vector<uint_fast64_t> successorIndications(numberOfStates + 1, 0);
+            std::vector<char> hasSelfLoop(numberOfStates, 0);
+            parallelForEach(subsystemStates, [&] (uint_fast64_t state) {
+                uint_fast64_t numberOfSuccessors = 0;
+                for (auto const& successor : transitionMatrix.getRowGroup(state)) {
+                    if (subsystem.get(successor.getColumn()) && successor.getValue() != storm::utility::zero<ValueType>()) {
+                        if (successor.getColumn() == state) {
+                            hasSelfLoop[state] = 1;
+                        } else {
+                            ++numberOfSuccessors;
+                        }
+                    }
+                }
+                successorIndications[state + 1] = numberOfSuccessors;
+            });
+            for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+                successorIndications[state + 1] += successorIndications[state];
+                if (hasSelfLoop[state]) {
+                    statesWithSelfLoop.set(state);
+                }
+            }
+            std::vector<uint_fast64_t> successors(successorIndications.back());
+            parallelForEach(subsystemStates, [&] (uint_fast64_t state) {
+                uint_fast64_t position = successorIndications[state];
+                for (auto const& successor : transitionMatrix.getRowGroup(state)) {
+                    if (subsystem.get(successor.getColumn()) && successor.getValue() != storm::utility::zero<ValueType>() && successor.getColumn() != state) {
+                        successors[position++] = successor.getColumn();
+                    }
+                }
+            });
+            
+            std::vector<uint_fast64_t> predecessorIndications(numberOfStates + 1, 0);
+            for (auto const& successor : successors) {
+                ++predecessorIndications[successor + 1];
+            }
+            for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+                predecessorIndications[state + 1] += predecessorIndications[state];
+            }
+            std::vector<uint_fast64_t> predecessors(successors.size());
+            {
+                std::vector<uint_fast64_t> nextPosition(predecessorIndications.begin(), predecessorIndications.end() - 1);
+                for (auto state : subsystemStates) {
+                    for (uint_fast64_t index = successorIndications[state]; index < successorIndications[state + 1]; ++index) {
+                        predecessors[nextPosition[successors[index]]++] = state;
+                    }
+                }
+            }
+            
+            // States without predecessors or successors in the remaining subsystem form an SCC on their own. We
+            // remove them iteratively, which in particular covers all acyclic parts of the subsystem.
+            uint_fast64_t sccCount = 0;
+            storm::storage::BitVector remaining = subsystem;
+            {
+                std::vector<uint_fast64_t> numberOfRemainingSuccessors(numberOfStates);
+                std::vector<uint_fast64_t> numberOfRemainingPredecessors(numberOfStates);
+                std::vector<uint_fast64_t> trimmedStates;
+                for (auto state : subsystemStates) {
+                    numberOfRemainingSuccessors[state] = successorIndications[state + 1] - successorIndications[state];
+                    numberOfRemainingPredecessors[state] = predecessorIndications[state + 1] - predecessorIndications[state];
+                    if (numberOfRemainingSuccessors[state] == 0 || numberOfRemainingPredecessors[state] == 0) {
+                        remaining.set(state, false);
+                        trimmedStates.push_back(state);
+                    }
+                }
+                while (!trimmedStates.empty()) {
+                    uint_fast64_t state = trimmedStates.back();
+                    trimmedStates.pop_back();
+                    stateToSccMapping[state] = sccCount++;
+                    for (uint_fast64_t index = successorIndications[state]; index < successorIndications[state + 1]; ++index) {
+                        uint_fast64_t successor = successors[index];
+                        if (remaining.get(successor) && --numberOfRemainingPredecessors[successor] == 0) {
+                            remaining.set(successor, false);
+                            trimmedStates.push_back(successor);
+                        }
+                    }
+                    for (uint_fast64_t index = predecessorIndications[state]; index < predecessorIndications[state + 1]; ++index) {
+                        uint_fast64_t predecessor = predecessors[index];
+                        if (remaining.get(predecessor) && --numberOfRemainingSuccessors[predecessor] == 0) {
+                            remaining.set(predecessor, false);
+                            trimmedStates.push_back(predecessor);
+                        }
+                    }
+                }
+            }
+            STORM_LOG_TRACE("Trimmed " << (subsystemStates.size() - remaining.getNumberOfSetBits()) << " of " << subsystemStates.size() << " states before the parallel SCC decomposition.");
+            
+            // Decompose the remaining states by coloring. Each round identifies at least the SCC of the remaining
+            // state with the largest index.
+            uint_fast64_t const sequentialThreshold = 4096;
+            uint_fast64_t const noRoot = std::numeric_limits<uint_fast64_t>::max();
+            std::vector<uint_fast64_t> remainingStates(remaining.begin(), remaining.end());
+            std::unique_ptr<std::atomic<uint_fast64_t>[]> colors(new std::atomic<uint_fast64_t>[numberOfStates]);
+            std::vector<uint_fast64_t> sccRoots(numberOfStates, noRoot);
+            while (remainingStates.size() >= sequentialThreshold) {
+                // Propagate the maximal index of a state forward until the colors are stable. Afterwards, the color of
+                // each state is the largest index of a remaining state that can reach it.
+                for (auto state : remainingStates) {
+                    colors[state].store(state, std::memory_order_relaxed);
+                }
+                std::atomic<bool> changed(true);
+                while (changed.load()) {
+                    changed.store(false);
+                    parallelForEach(remainingStates, [&] (uint_fast64_t state) {
+                        uint_fast64_t color = colors[state].load(std::memory_order_relaxed);
+                        for (uint_fast64_t index = successorIndications[state]; index < successorIndications[state + 1]; ++index) {
+                            uint_fast64_t successor = successors[index];
+                            if (remaining.get(successor)) {
+                                uint_fast64_t successorColor = colors[successor].load(std::memory_order_relaxed);
+                                while (successorColor < color) {
+                                    if (colors[successor].compare_exchange_weak(successorColor, color, std::memory_order_relaxed)) {
+                                        changed.store(true, std::memory_order_relaxed);
+                                        break;
+                                    }
+                                }
+                            }
+                        }
+                    });
+                }
+                
+                // The SCC of a state that kept its own color consists of the states of this color that can reach it.
+                // As the searches only visit states of their own color, they do not interfere.
+                std::vector<uint_fast64_t> roots;
+                for (auto state : remainingStates) {
+                    if (colors[state].load(std::memory_order_relaxed) == state) {
+                        roots.push_back(state);
+                    }
+                }
+                parallelForEach(roots, [&] (uint_fast64_t root) {
+                    std::vector<uint_fast64_t> stack = {root};
+                    sccRoots[root] = root;
+                    while (!stack.empty()) {
+                        uint_fast64_t state = stack.back();
+                        stack.pop_back();
+                        for (uint_fast64_t index = predecessorIndications[state]; index < predecessorIndications[state + 1]; ++index) {
+                            uint_fast64_t predecessor = predecessors[index];
+                            if (remaining.get(predecessor) && colors[predecessor].load(std::memory_order_relaxed) == root && sccRoots[predecessor] != root) {
+                                sccRoots[predecessor] = root;
+                                stack.push_back(predecessor);
+                            }
+                        }
+                    }
+                });
+                
+                // Number the new SCCs and remove their states.
+                for (auto root : roots) {
+                    stateToSccMapping[root] = sccCount++;
+                }
+                std::vector<uint_fast64_t> newRemainingStates;
+                for (auto state : remainingStates) {
+                    if (sccRoots[state] != noRoot) {
+                        stateToSccMapping[state] = stateToSccMapping[sccRoots[state]];
+                        remaining.set(state, false);
+                    } else {
+                        newRemainingStates.push_back(state);
+                    }
+                }
+                STORM_LOG_TRACE("Found " << roots.size() << " SCCs in a coloring round, " << newRemainingStates.size() << " states remain.");
+                remainingStates = std::move(newRemainingStates);
+            }
+            
+            // Decompose the few remaining states sequentially.
+            if (!remainingStates.empty()) {
+                std::vector<uint_fast64_t> s;
+                std::vector<uint_fast64_t> p;
+                std::vector<uint_fast64_t> preorderNumbers(numberOfStates);
+                storm::storage::BitVector hasPreorderNumber(numberOfStates);
+                storm::storage::BitVector stateHasScc(numberOfStates);
+                uint_fast64_t currentIndex = 0;
+                for (auto state : remainingStates) {
+                    if (!hasPreorderNumber.get(state)) {
+                        performSccDecompositionGCM(transitionMatrix, state, statesWithSelfLoop, remaining, currentIndex, hasPreorderNumber, preorderNumbers, s, p, stateHasScc, stateToSccMapping, sccCount);
+                    }
+                }
+            }
+            
+            // Finally, we reorder the SCCs such that each SCC is preceded by the SCCs reachable from it. For this, we
+            // repeatedly pick an SCC all of whose successor SCCs were already picked.
+            std::vector<uint_fast64_t> sccStateIndications(sccCount + 1, 0);
+            std::vector<uint_fast64_t> numberOfOutgoingTransitions(sccCount, 0);
+            for (auto state : subsystemStates) {
+                uint_fast64_t scc = stateToSccMapping[state];
+                ++sccStateIndications[scc + 1];
+                for (uint_fast64_t index = successorIndications[state]; index < successorIndications[state + 1]; ++index) {
+                    if (stateToSccMapping[successors[index]] != scc) {
+                        ++numberOfOutgoingTransitions[scc];
+                    }
+                }
+            }
+            for (uint_fast64_t scc = 0; scc < sccCount; ++scc) {
+                sccStateIndications[scc + 1] += sccStateIndications[scc];
+            }
+            std::vector<uint_fast64_t> sccStates(subsystemStates.size());
+            {
+                std::vector<uint_fast64_t> nextPosition(sccStateIndications.begin(), sccStateIndications.end() - 1);
+                for (auto state : subsystemStates) {
+                    sccStates[nextPosition[stateToSccMapping[state]]++] = state;
+                }
+            }
+            std::vector<uint_fast64_t> sortedSccs;
+            sortedSccs.reserve(sccCount);
+            for (uint_fast64_t scc = 0; scc < sccCount; ++scc) {
+                if (numberOfOutgoingTransitions[scc] == 0) {
+                    sortedSccs.push_back(scc);
+                }
+            }
+            for (uint_fast64_t sortedIndex = 0; sortedIndex < sortedSccs.size(); ++sortedIndex) {
+                uint_fast64_t scc = sortedSccs[sortedIndex];
+                for (uint_fast64_t stateIndex = sccStateIndications[scc]; stateIndex < sccStateIndications[scc + 1]; ++stateIndex) {
+                    uint_fast64_t state = sccStates[stateIndex];
+                    for (uint_fast64_t index = predecessorIndications[state]; index < predecessorIndications[state + 1]; ++index) {
+                        uint_fast64_t predecessorScc = stateToSccMapping[predecessors[index]];
+                        if (predecessorScc != scc && --numberOfOutgoingTransitions[predecessorScc] == 0) {
+                            sortedSccs.push_back(predecessorScc);
+                        }
+                    }
+                }
+            }
+            STORM_LOG_ASSERT(sortedSccs.size() == sccCount, "Unable to sort the SCCs topologically.");
+            std::vector<uint_fast64_t> newSccIndices(sccCount);
+            for (uint_fast64_t sortedIndex = 0; sortedIndex < sccCount; ++sortedIndex) {
+                newSccIndices[sortedSccs[sortedIndex]] = sortedIndex;
+            }
+            for (auto state : subsystemStates) {
+                stateToSccMapping[state] = newSccIndices[stateToSccMapping[state]];
+            }
+            
+            return sccCount;
+        }
+        
         template <typename ValueType>
         void StronglyConnectedComponentDecomposition<ValueType>::performSccDecompositionGCM(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, uint_fast64_t startState, storm::storage::BitVector& statesWithSelfLoop, storm::storage::BitVector const& subsystem, uint_fast64_t& currentIndex, storm::storage::BitVector& hasPreorderNumber, std::vector<uint_fast64_t>& preorderNumbers, std::vector<uint_fast64_t>& s, std::vector<uint_fast64_t>& p, storm::storage::BitVector& stateHasScc, std::vector<uint_fast64_t>& stateToSccMapping, uint_fast64_t& sccCount) {
             
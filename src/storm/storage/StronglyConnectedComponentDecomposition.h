@@ -100,8 +100,12 @@ namespace storm {
              * without a self-loop) are to be kept in the decomposition.
              * @param onlyBottomSccs If set to true, only bottom SCCs, i.e. SCCs in which all states have no way of
              * leaving the SCC), are kept.
+             * @param numberOfThreads The number of threads used to compute the decomposition (zero for the number of
+             * hardware threads). Regardless of the number of threads, the SCCs are ordered such that each SCC is
+             * preceded by all SCCs reachable from it. Matrices with exact or parametric values are always decomposed
+             * by a single thread.
              */
-            StronglyConnectedComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, bool dropNaiveSccs = false, bool onlyBottomSccs = false);
+            StronglyConnectedComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, bool dropNaiveSccs = false, bool onlyBottomSccs = false, uint64_t numberOfThreads = 1);
             
             /*!
              * Creates an SCC decomposition by copying the given SCC decomposition.
@@ -155,8 +159,27 @@ namespace storm {
              * without a self-loop) are to be kept in the decomposition.
              * @param onlyBottomSccs If set to true, only bottom SCCs, i.e. SCCs in which all states have no way of
              * leaving the SCC), are kept.
+             * @param numberOfThreads The number of threads to use (zero for the number of hardware threads).
              */
-            void performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, bool dropNaiveSccs, bool onlyBottomSccs);
+            void performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, bool dropNaiveSccs, bool onlyBottomSccs, uint64_t numberOfThreads = 1);
+            
+            /*!
+             * Computes a mapping of states to their SCCs with several threads. States that can not be part of a
+             * non-trivial SCC are trimmed first. The remaining states are decomposed by repeatedly propagating the
+             * maximal state index forward (coloring) and then collecting the SCC of each state that kept its own
+             * color by a backward search restricted to the states of this color. Once only few states remain, the
+             * sequential algorithm is used for them. Finally, the SCC indices are reordered such that every SCC has a
+             * larger index than all SCCs reachable from it, as it is the case for the sequential algorithm.
+             *
+             * @param transitionMatrix The transition matrix of the system to decompose.
+             * @param subsystem The subsystem to decompose.
+             * @param numberOfThreads The number of threads to use (zero for the number of hardware threads).
+             * @param statesWithSelfLoop A bit vector that is to be filled with all states that have a self-loop.
+             * @param stateToSccMapping A mapping from states to the SCC indices they belong to that is filled for all
+             * states of the subsystem.
+             * @return The number of SCCs.
+             */
+            uint_fast64_t performParallelSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, uint64_t numberOfThreads, storm::storage::BitVector& statesWithSelfLoop, std::vector<uint_fast64_t>& stateToSccMapping);
             
             /*!
              * Uses the algorithm by Gabow/Cheriyan/Mehlhorn ("Path-based strongly connected component algorithm") to
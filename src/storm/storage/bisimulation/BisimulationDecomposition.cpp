@@ -7,6 +7,7 @@
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
+#include "storm/storage/Distribution.h"
 #include "storm/storage/bisimulation/DeterministicBlockData.h"
 
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
@@ -18,6 +19,7 @@
 #include "storm/logic/FormulaInformation.h"
 #include "storm/logic/FragmentSpecification.h"
 
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
 #include "storm/exceptions/InvalidOptionException.h"
@@ -47,7 +49,7 @@ namespace storm {
         }
         
         template<typename ModelType, typename BlockDataType>
-        BisimulationDecomposition<ModelType, BlockDataType>::Options::Options() : measureDrivenInitialPartition(false), phiStates(), psiStates(), respectedAtomicPropositions(), buildQuotient(true), keepRewards(false), type(BisimulationType::Strong), bounded(false) {
+        BisimulationDecomposition<ModelType, BlockDataType>::Options::Options() : measureDrivenInitialPartition(false), phiStates(), psiStates(), respectedAtomicPropositions(), buildQuotient(true), refinementMethod(SparseRefinementMethod::Splitter), numberOfThreads(1), keepRewards(false), type(BisimulationType::Strong), bounded(false) {
             // Intentionally left empty.
         }
         
@@ -230,6 +232,15 @@ namespace storm {
         
         template<typename ModelType, typename BlockDataType>
         void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefinement() {
+            if (options.refinementMethod == SparseRefinementMethod::Signature) {
+                if (options.getType() == BisimulationType::Strong) {
+                    this->performSignatureBasedPartitionRefinement();
+                    this->postProcessSignatureBasedRefinement();
+                    return;
+                }
+                STORM_LOG_WARN("Signature-based refinement only supports strong bisimulation, falling back to splitter-based refinement.");
+            }
+            
             // Insert all blocks into the splitter queue as a (potential) splitter.
             std::vector<Block<BlockDataType>*> splitterQueue;
             std::for_each(partition.getBlocks().begin(), partition.getBlocks().end(), [&] (std::unique_ptr<Block<BlockDataType>> const& block) { block->data().setSplitter(); splitterQueue.push_back(block.get()); } );
@@ -252,6 +263,117 @@ namespace storm {
             }
         }
         
+        template<typename ModelType, typename BlockDataType>
+        void BisimulationDecomposition<ModelType, BlockDataType>::performSignatureBasedPartitionRefinement() {
+            storm::storage::SparseMatrix<ValueType> const& transitionMatrix = model.getTransitionMatrix();
+            std::vector<uint_fast64_t> const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+            uint_fast64_t numberOfStates = model.getNumberOfStates();
+            
+            // Exact numbers are reference counted without synchronization, so they must not be shared between threads.
+            uint64_t numberOfThreads = options.numberOfThreads;
+            if (!std::is_same<ValueType, double>::value && numberOfThreads != 1) {
+                STORM_LOG_WARN("Refining the partition concurrently is only supported for floating point numbers. Falling back to a single thread.");
+                numberOfThreads = 1;
+            }
+            storm::utility::ThreadPool threadPool(numberOfThreads);
+            
+            // The signature of a state is the ordered set of its distributions over the blocks of the current partition.
+            // For deterministic models, this is just the single distribution of the state.
+            std::vector<std::vector<storm::storage::Distribution<ValueType>>> signatures(numberOfStates);
+            auto signatureLess = [&signatures, this] (storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) {
+                std::vector<storm::storage::Distribution<ValueType>> const& signature1 = signatures[state1];
+                std::vector<storm::storage::Distribution<ValueType>> const& signature2 = signatures[state2];
+                if (signature1.size() != signature2.size()) {
+                    return signature1.size() < signature2.size();
+                }
+                for (uint_fast64_t index = 0; index < signature1.size(); ++index) {
+                    if (signature1[index].less(signature2[index], comparator)) {
+                        return true;
+                    } else if (signature2[index].less(signature1[index], comparator)) {
+                        return false;
+                    }
+                }
+                return false;
+            };
+            
+            uint_fast64_t const statesPerChunk = 4096;
+            uint_fast64_t rounds = 0;
+            bool partitionChanged = true;
+            while (partitionChanged) {
+                ++rounds;
+                
+                // Only blocks with more than one state that are not absorbing can possibly be split.
+                std::vector<Block<BlockDataType>*> candidateBlocks;
+                for (auto const& block : partition.getBlocks()) {
+                    if (block->getNumberOfStates() > 1 && !block->data().absorbing()) {
+                        candidateBlocks.push_back(block.get());
+                    }
+                }
+                if (candidateBlocks.empty()) {
+                    break;
+                }
+                
+                // Compute the signatures of all states in the candidate blocks concurrently. The partition is only read
+                // in this phase.
+                threadPool.execute((numberOfStates + statesPerChunk - 1) / statesPerChunk, [&] (uint64_t chunk, uint64_t) {
+                    uint_fast64_t lastState = std::min(numberOfStates, (chunk + 1) * statesPerChunk);
+                    for (uint_fast64_t state = chunk * statesPerChunk; state < lastState; ++state) {
+                        std::vector<storm::storage::Distribution<ValueType>>& signature = signatures[state];
+                        signature.clear();
+                        
+                        Block<BlockDataType> const& block = partition.getBlock(state);
+                        if (block.getNumberOfStates() == 1 || block.data().absorbing()) {
+                            signature.shrink_to_fit();
+                            continue;
+                        }
+                        
+                        for (uint_fast64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice) {
+                            storm::storage::Distribution<ValueType> distribution;
+                            for (auto const& entry : transitionMatrix.getRow(choice)) {
+                                if (!comparator.isZero(entry.getValue())) {
+                                    distribution.addProbability(partition.getBlock(entry.getColumn()).getId(), entry.getValue());
+                                }
+                            }
+                            signature.push_back(std::move(distribution));
+                        }
+                        
+                        // Sort the distributions and keep only one of each group of equal distributions.
+                        std::sort(signature.begin(), signature.end(), [this] (storm::storage::Distribution<ValueType> const& distribution1, storm::storage::Distribution<ValueType> const& distribution2) { return distribution1.less(distribution2, comparator); });
+                        signature.erase(std::unique(signature.begin(), signature.end(), [this] (storm::storage::Distribution<ValueType> const& distribution1, storm::storage::Distribution<ValueType> const& distribution2) { return !distribution1.less(distribution2, comparator); }), signature.end());
+                    }
+                });
+                
+                // Sort the candidate blocks according to the signatures and determine the positions at which they need to
+                // be split. As the blocks occupy disjoint ranges of the partition, this can be done concurrently.
+                std::vector<std::vector<uint_fast64_t>> splitPositions(candidateBlocks.size());
+                threadPool.execute(candidateBlocks.size(), [&] (uint64_t blockIndex, uint64_t) {
+                    Block<BlockDataType> const& block = *candidateBlocks[blockIndex];
+                    partition.sortRange(block.getBeginIndex(), block.getEndIndex(), signatureLess);
+                    std::vector<uint_fast64_t> rangeStarts = partition.computeRangesOfEqualValue(block.getBeginIndex(), block.getEndIndex(), signatureLess);
+                    
+                    // The first and the last entry are the bounds of the block itself.
+                    splitPositions[blockIndex] = std::vector<uint_fast64_t>(rangeStarts.begin() + 1, rangeStarts.end() - 1);
+                });
+                
+                // Finally, split all blocks at once. Every split moves the front part of the block into a new block, so
+                // the positions need to be processed in ascending order.
+                partitionChanged = false;
+                for (uint_fast64_t blockIndex = 0; blockIndex < candidateBlocks.size(); ++blockIndex) {
+                    for (auto const& position : splitPositions[blockIndex]) {
+                        partition.splitBlock(*candidateBlocks[blockIndex], position);
+                        partitionChanged = true;
+                    }
+                }
+            }
+            
+            STORM_LOG_INFO("Signature-based refinement finished after " << rounds << " rounds with " << partition.size() << " blocks.");
+        }
+        
+        template<typename ModelType, typename BlockDataType>
+        void BisimulationDecomposition<ModelType, BlockDataType>::postProcessSignatureBasedRefinement() {
+            // Intentionally left empty.
+        }
+        
         template<typename ModelType, typename BlockDataType>
         std::shared_ptr<ModelType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotient() const {
             STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException, "Unable to retrieve quotient model from bisimulation decomposition, because it was not built.");
@@ -132,6 +132,13 @@ namespace storm {
                 /// A flag that governs whether the quotient model is actually built or only the decomposition is computed.
                 bool buildQuotient;
                 
+                /// The method that is used to refine the partition.
+                SparseRefinementMethod refinementMethod;
+                
+                /// The number of threads used by the signature-based refinement (zero for the number of hardware threads). Only models
+                /// with floating point values are refined by more than one thread.
+                uint64_t numberOfThreads;
+                
             private:
                 boost::optional<OptimizationDirection> optimalityType;
                 
@@ -213,6 +220,20 @@ namespace storm {
              */
             void performPartitionRefinement();
             
+            /*!
+             * Performs the partition refinement by repeatedly splitting all blocks according to the signatures of their
+             * states, i.e. the (sets of) distributions over the blocks of the current partition. In every round, the
+             * signatures are computed and the blocks are sorted concurrently, before all blocks are split at once.
+             * This computes the same partition as the splitter-based refinement, but only supports strong bisimulation.
+             */
+            void performSignatureBasedPartitionRefinement();
+            
+            /*!
+             * A function that can update auxiliary data structures after the partition was refined based on signatures.
+             * It is called after performSignatureBasedPartitionRefinement.
+             */
+            virtual void postProcessSignatureBasedRefinement();
+            
             /*!
              * Refines the partition by considering the given splitter. All blocks that become potential splitters
              * because of this refinement, are marked as splitters and inserted into the splitter vector.
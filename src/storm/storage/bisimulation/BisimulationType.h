@@ -5,6 +5,10 @@ namespace storm {
         
         enum class BisimulationType { Strong, Weak };
         enum class BisimulationTypeChoice { Strong, Weak, FromSettings };
+        
+        // The methods to refine the partition of a sparse model: splitter by splitter or by (parallel) signature
+        // computation for all states at once.
+        enum class SparseRefinementMethod { Splitter, Signature };
 
     }
 }
@@ -41,6 +41,8 @@ namespace storm {
             
             virtual void initialize() override;
             
+            virtual void postProcessSignatureBasedRefinement() override;
+            
         private:
             // Creates the mapping from the choice indices to the states.
             void createChoiceToStateMapping();
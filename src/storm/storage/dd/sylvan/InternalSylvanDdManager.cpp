@@ -12,19 +12,26 @@
 #include "storm/exceptions/InvalidSettingsException.h"
 
 #include "storm/utility/sylvan.h"
+#include "storm/utility/Instrumentation.h"
 
 #include "storm-config.h"
 
+#include "sylvan_cache.h"
+
+#ifdef STORM_HAVE_HWLOC
+#include <hwloc.h>
+#endif
+
 namespace storm {
     namespace dd {
         
-#ifndef NDEBUG
 #if defined(__clang__)
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wzero-length-array"
 #pragma clang diagnostic ignored "-Wc99-extensions"
 #endif
         
+#ifndef NDEBUG
         VOID_TASK_0(gc_start) {
             STORM_LOG_TRACE("Starting sylvan garbage collection...");
         }
@@ -33,10 +40,98 @@ namespace storm {
             STORM_LOG_TRACE("Sylvan garbage collection done.");
         }
         
-#if defined(__clang__)
-#pragma clang diagnostic pop
 #endif
         
+        namespace {
+            // The statistics of Sylvan. As Sylvan is a global resource, they are shared by all managers.
+            uint64_t numberOfGarbageCollections = 0;
+            uint64_t numberOfCacheGrowths = 0;
+            uint64_t cacheHitsAtLastGarbageCollection = 0;
+            uint64_t cacheMissesAtLastGarbageCollection = 0;
+            
+            // The hit rate of the operation cache from which on the cache is grown.
+            double adaptiveCacheHitRate = 0;
+            
+#ifdef STORM_HAVE_HWLOC
+            // The topology of the machine. It is only loaded if the workers are pinned or the table is interleaved.
+            hwloc_topology_t topology = nullptr;
+            storm::settings::modules::SylvanSettings::PinningStrategy pinningStrategy = storm::settings::modules::SylvanSettings::PinningStrategy::None;
+            
+            /*!
+             * Retrieves the core to which the worker with the given index is pinned (or null if there is none).
+             */
+            hwloc_obj_t getCoreOfWorker(uint64_t worker) {
+                int numberOfCores = hwloc_get_nbobjs_by_type(topology, HWLOC_OBJ_CORE);
+                if (numberOfCores <= 0) {
+                    return nullptr;
+                }
+                
+                int numberOfNodes = hwloc_get_nbobjs_by_type(topology, HWLOC_OBJ_NUMANODE);
+                if (pinningStrategy == storm::settings::modules::SylvanSettings::PinningStrategy::Scatter && numberOfNodes > 1) {
+                    // Distribute the workers round-robin over the NUMA nodes and use the cores of each node in order.
+                    hwloc_obj_t node = hwloc_get_obj_by_type(topology, HWLOC_OBJ_NUMANODE, worker % numberOfNodes);
+                    int numberOfCoresOfNode = hwloc_get_nbobjs_inside_cpuset_by_type(topology, node->cpuset, HWLOC_OBJ_CORE);
+                    if (numberOfCoresOfNode > 0) {
+                        return hwloc_get_obj_inside_cpuset_by_type(topology, node->cpuset, HWLOC_OBJ_CORE, (worker / numberOfNodes) % numberOfCoresOfNode);
+                    }
+                }
+                
+                // The logical order of the cores fills one NUMA node before the next one.
+                return hwloc_get_obj_by_type(topology, HWLOC_OBJ_CORE, worker % numberOfCores);
+            }
+#endif
+        }
+        
+#ifdef STORM_HAVE_HWLOC
+        VOID_TASK_0(pin_worker) {
+            // The first worker is the thread that initialized Sylvan. It also runs all other computations of storm and
+            // threads created by it inherit its binding, so it is not pinned.
+            uint64_t worker = LACE_WORKER_ID;
+            if (worker == 0) {
+                return;
+            }
+            hwloc_obj_t core = getCoreOfWorker(worker);
+            if (core == nullptr || hwloc_set_cpubind(topology, core->cpuset, HWLOC_CPUBIND_THREAD) != 0) {
+                STORM_LOG_WARN("Could not pin worker " << worker << " of sylvan.");
+            }
+        }
+#endif
+        
+        VOID_TASK_0(gc_count) {
+            ++numberOfGarbageCollections;
+        }
+        
+        VOID_TASK_0(gc_adaptive_resize) {
+            // Use the default resizing heuristic of sylvan and revert the growth of the operation cache if its hit rate
+            // since the previous garbage collection does not justify it.
+            size_t cacheSize = cache_getsize();
+#if SYLVAN_AGGRESSIVE_RESIZE
+            CALL(sylvan_gc_aggressive_resize);
+#else
+            CALL(sylvan_gc_normal_resize);
+#endif
+            uint64_t hits, misses;
+            cache_getstats(&hits, &misses);
+            uint64_t lookups = (hits - cacheHitsAtLastGarbageCollection) + (misses - cacheMissesAtLastGarbageCollection);
+            double hitRate = lookups == 0 ? 0.0 : static_cast<double>(hits - cacheHitsAtLastGarbageCollection) / lookups;
+            cacheHitsAtLastGarbageCollection = hits;
+            cacheMissesAtLastGarbageCollection = misses;
+            
+            if (hitRate >= adaptiveCacheHitRate) {
+                // Grow the cache even if the default heuristic did not.
+                if (cache_getsize() == cacheSize && cacheSize < cache_getmaxsize()) {
+                    cache_setsize(cacheSize * 2);
+                }
+            } else if (cache_getsize() != cacheSize) {
+                cache_setsize(cacheSize);
+            }
+            if (cache_getsize() != cacheSize) {
+                ++numberOfCacheGrowths;
+            }
+        }
+        
+#if defined(__clang__)
+#pragma clang diagnostic pop
 #endif
         
         uint_fast64_t InternalDdManager<DdType::Sylvan>::numberOfInstances = 0;
@@ -64,6 +159,20 @@ namespace storm {
                 }
                 lace_startup(0, 0, 0);
                 
+#ifdef STORM_HAVE_HWLOC
+                pinningStrategy = settings.getPinningStrategy();
+                if (pinningStrategy != storm::settings::modules::SylvanSettings::PinningStrategy::None || settings.isInterleaveTableSet()) {
+                    hwloc_topology_init(&topology);
+                    hwloc_topology_load(topology);
+                }
+                if (pinningStrategy != storm::settings::modules::SylvanSettings::PinningStrategy::None) {
+                    LACE_ME;
+                    TOGETHER(pin_worker);
+                }
+#else
+                STORM_LOG_WARN_COND(settings.getPinningStrategy() == storm::settings::modules::SylvanSettings::PinningStrategy::None && !settings.isInterleaveTableSet(), "Pinning the workers of sylvan and interleaving its unique table requires hwloc, which is not available.");
+#endif
+                
                 // Each node takes 24 bytes and the maximal memory is specified in megabytes.
                 uint_fast64_t totalNodesToStore = storm::settings::getModule<storm::settings::modules::SylvanSettings>().getMaximalMemory() * 1024 * 1024 / 24;
                 
@@ -83,6 +192,21 @@ namespace storm {
                 
                 STORM_LOG_DEBUG("Initializing sylvan. Initial/max table size: " << initialTableSize << "/" << maxTableSize << ", initial/max cache size: " << initialCacheSize << "/" << maxCacheSize << ".");
                 sylvan::Sylvan::initPackage(initialTableSize, maxTableSize, initialCacheSize, maxCacheSize);
+                
+#ifdef STORM_HAVE_HWLOC
+                if (settings.isInterleaveTableSet()) {
+                    // The memory of the table has not been touched yet, so setting the policy determines where its pages
+                    // are allocated. Sylvan keeps the policy when clearing the table during garbage collection.
+                    void* hashes;
+                    void* data;
+                    size_t hashesSize, dataSize;
+                    sylvan_table_memory(&hashes, &hashesSize, &data, &dataSize);
+                    hwloc_const_cpuset_t allCores = hwloc_topology_get_complete_cpuset(topology);
+                    bool interleaved = hwloc_set_area_membind(topology, hashes, hashesSize, allCores, HWLOC_MEMBIND_INTERLEAVE, 0) == 0;
+                    interleaved &= hwloc_set_area_membind(topology, data, dataSize, allCores, HWLOC_MEMBIND_INTERLEAVE, 0) == 0;
+                    STORM_LOG_WARN_COND(interleaved, "Could not interleave the unique table of sylvan across the NUMA nodes.");
+                }
+#endif
 
                 sylvan::Sylvan::initBdd();
                 sylvan::Sylvan::initMtbdd();
@@ -92,6 +216,19 @@ namespace storm {
                 sylvan_gc_hook_pregc(TASK(gc_start));
                 sylvan_gc_hook_postgc(TASK(gc_end));
 #endif
+                
+                numberOfGarbageCollections = 0;
+                numberOfCacheGrowths = 0;
+                cacheHitsAtLastGarbageCollection = 0;
+                cacheMissesAtLastGarbageCollection = 0;
+                // Counting the cache lookups costs time on every lookup, so it is only done if the numbers are needed.
+                cache_enablestats(settings.isShowStatisticsSet() || settings.isAdaptiveCacheSet());
+                cache_resetstats();
+                sylvan_gc_hook_postgc(TASK(gc_count));
+                if (settings.isAdaptiveCacheSet()) {
+                    adaptiveCacheHitRate = settings.getAdaptiveCacheHitRate();
+                    sylvan_gc_hook_main(TASK(gc_adaptive_resize));
+                }
 
             }
             ++numberOfInstances;
@@ -105,8 +242,36 @@ namespace storm {
 //                sylvan_stats_report(filePointer, 0);
 //                fclose(filePointer);
                 
+                size_t filledTableSize, tableSize;
+                LACE_ME;
+                sylvan_table_usage(&filledTableSize, &tableSize);
+                uint64_t cacheHits, cacheMisses;
+                cache_getstats(&cacheHits, &cacheMisses);
+                storm::settings::modules::SylvanSettings const& settings = storm::settings::getModule<storm::settings::modules::SylvanSettings>();
+                if (settings.isShowStatisticsSet()) {
+                    uint64_t cacheLookups = cacheHits + cacheMisses;
+                    STORM_PRINT_AND_LOG("Sylvan statistics:" << std::endl);
+                    STORM_PRINT_AND_LOG("    unique table: " << filledTableSize << " of " << tableSize << " nodes in use (" << (tableSize == 0 ? 0.0 : 100.0 * filledTableSize / tableSize) << "%)" << std::endl);
+                    STORM_PRINT_AND_LOG("    garbage collections: " << numberOfGarbageCollections << std::endl);
+                    STORM_PRINT_AND_LOG("    operation cache: " << cache_getsize() << " entries, " << cacheHits << " of " << cacheLookups << " lookups hit (" << (cacheLookups == 0 ? 0.0 : 100.0 * cacheHits / cacheLookups) << "%), grown adaptively " << numberOfCacheGrowths << " times" << std::endl);
+                }
+                storm::utility::instrumentation::addToCounter("sylvan-table-size", tableSize);
+                storm::utility::instrumentation::addToCounter("sylvan-table-filled", filledTableSize);
+                storm::utility::instrumentation::addToCounter("sylvan-garbage-collections", numberOfGarbageCollections);
+                if (settings.isShowStatisticsSet() || settings.isAdaptiveCacheSet()) {
+                    storm::utility::instrumentation::addToCounter("sylvan-cache-hits", cacheHits);
+                    storm::utility::instrumentation::addToCounter("sylvan-cache-misses", cacheMisses);
+                }
+                
                 sylvan::Sylvan::quitPackage();
                 lace_exit();
+                
+#ifdef STORM_HAVE_HWLOC
+                if (topology != nullptr) {
+                    hwloc_topology_destroy(topology);
+                    topology = nullptr;
+                }
+#endif
             }
         }
         
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storm/models/ModelType.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+    namespace utility {
+        namespace binary {
+
+            /*
+             * Layout of the binary model format.
+             *
+             * The file is a sequence of 64 bit words. Arrays are stored exactly as they are laid out in memory by the
+             * sparse data structures, so they can be copied from the file without any parsing. Strings are
+             * stored as their length followed by the characters, padded with zeros to a multiple of eight bytes.
+             *
+             * Header:           magic, byte order mark, version, value type, model type, number of states
+             * Transitions:      matrix (see below)
+             * State labeling:   number of labels, then for each label its name and the words of its bit vector
+             * Reward models:    number of reward models, then for each model its name, a word of RewardModelFlags
+             *                   and the vectors (and matrix) that are present, in the order of the flags
+             * Choice labeling:  zero if absent, otherwise one followed by the labels as for the state labeling
+             * Continuous time:  for CTMCs and MAs the exit rates; for MAs also the bit vector of Markovian states
+             *
+             * Matrix:           number of rows, number of columns, number of entries, a flag whether the row grouping
+             *                   is trivial, the row indications, the entries (pairs of column and value) and, for
+             *                   non-trivial row groupings, the number of row groups and the row group indices.
+             */
+
+            // The first eight bytes of every file.
+            char const MAGIC[8] = {'S', 'T', 'O', 'R', 'M', 'B', 'I', 'N'};
+
+            // Used to detect files written on a machine with a different byte order.
+            uint64_t const BYTE_ORDER_MARK = 0x0102030405060708ull;
+
+            // Has to be increased whenever the layout changes.
+            uint64_t const VERSION = 1;
+
+            enum class RewardModelFlags : uint64_t {
+                StateRewards = 1,
+                StateActionRewards = 2,
+                TransitionRewards = 4
+            };
+
+            enum class ValueTypeId : uint64_t {
+                Double = 1
+            };
+
+            template<typename ValueType>
+            struct ValueTypeIdentifier;
+
+            template<>
+            struct ValueTypeIdentifier<double> {
+                static ValueTypeId const id = ValueTypeId::Double;
+            };
+
+            /*!
+             * Retrieves the (stable) identifier under which the given model type is stored.
+             */
+            inline uint64_t getModelTypeId(storm::models::ModelType const& type) {
+                switch (type) {
+                    case storm::models::ModelType::Dtmc:
+                        return 1;
+                    case storm::models::ModelType::Ctmc:
+                        return 2;
+                    case storm::models::ModelType::Mdp:
+                        return 3;
+                    case storm::models::ModelType::MarkovAutomaton:
+                        return 4;
+                    default:
+                        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Models of type " << type << " can not be stored in the binary format.");
+                }
+            }
+
+            /*!
+             * Retrieves the model type for the given identifier.
+             */
+            inline storm::models::ModelType getModelType(uint64_t id) {
+                switch (id) {
+                    case 1:
+                        return storm::models::ModelType::Dtmc;
+                    case 2:
+                        return storm::models::ModelType::Ctmc;
+                    case 3:
+                        return storm::models::ModelType::Mdp;
+                    case 4:
+                        return storm::models::ModelType::MarkovAutomaton;
+                    default:
+                        STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Unknown model type " << id << " in binary model file.");
+                }
+            }
+
+        }
+    }
+}
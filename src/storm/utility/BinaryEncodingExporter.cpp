@@ -0,0 +1,143 @@
+#include "BinaryEncodingExporter.h"
+
+#include "storm/utility/BinaryEncoding.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+    namespace exporter {
+
+        namespace {
+            void writeWord(std::ostream& os, uint64_t word) {
+                os.write(reinterpret_cast<char const*>(&word), sizeof(word));
+            }
+
+            template<typename T>
+            void writeArray(std::ostream& os, std::vector<T> const& array) {
+                static_assert(sizeof(T) % sizeof(uint64_t) == 0, "Array elements must consist of whole words.");
+                os.write(reinterpret_cast<char const*>(array.data()), array.size() * sizeof(T));
+            }
+
+            void writeString(std::ostream& os, std::string const& string) {
+                writeWord(os, string.size());
+                os.write(string.data(), string.size());
+                // Pad the string to whole words.
+                char const padding[sizeof(uint64_t)] = {};
+                os.write(padding, (sizeof(uint64_t) - string.size() % sizeof(uint64_t)) % sizeof(uint64_t));
+            }
+
+            void writeBitVector(std::ostream& os, storm::storage::BitVector const& bitVector) {
+                for (uint64_t index = 0; index < bitVector.size(); index += 64) {
+                    uint64_t numberOfBits = std::min<uint64_t>(64, bitVector.size() - index);
+                    writeWord(os, bitVector.getAsInt(index, numberOfBits) << (64 - numberOfBits));
+                }
+            }
+
+            template<typename ValueType>
+            void writeMatrix(std::ostream& os, storm::storage::SparseMatrix<ValueType> const& matrix) {
+                static_assert(sizeof(typename storm::storage::SparseMatrix<ValueType>::index_type) == sizeof(uint64_t), "The binary format requires 64 bit indices.");
+                writeWord(os, matrix.getRowCount());
+                writeWord(os, matrix.getColumnCount());
+                writeWord(os, matrix.getEntryCount());
+                writeWord(os, matrix.hasTrivialRowGrouping() ? 1 : 0);
+                // The row indications are not accessible directly, so we recover them from the row iterators.
+                writeWord(os, 0);
+                for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                    writeWord(os, matrix.end(row) - matrix.begin());
+                }
+                if (matrix.getEntryCount() > 0) {
+                    os.write(reinterpret_cast<char const*>(&*matrix.begin()), matrix.getEntryCount() * sizeof(storm::storage::MatrixEntry<typename storm::storage::SparseMatrix<ValueType>::index_type, ValueType>));
+                }
+                if (!matrix.hasTrivialRowGrouping()) {
+                    writeWord(os, matrix.getRowGroupCount());
+                    writeArray(os, matrix.getRowGroupIndices());
+                }
+            }
+
+            void writeLabeling(std::ostream& os, storm::models::sparse::StateLabeling const& labeling) {
+                std::set<std::string> labels = labeling.getLabels();
+                writeWord(os, labels.size());
+                for (auto const& label : labels) {
+                    writeString(os, label);
+                    writeBitVector(os, labeling.getStates(label));
+                }
+            }
+
+            void writeLabeling(std::ostream& os, storm::models::sparse::ChoiceLabeling const& labeling) {
+                std::set<std::string> labels = labeling.getLabels();
+                writeWord(os, labels.size());
+                for (auto const& label : labels) {
+                    writeString(os, label);
+                    writeBitVector(os, labeling.getChoices(label));
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void binaryExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel) {
+            storm::models::ModelType type = sparseModel->getType();
+            STORM_LOG_WARN_COND(!sparseModel->hasStateValuations(), "State valuations are not exported to the binary format.");
+            STORM_LOG_WARN_COND(!sparseModel->hasChoiceOrigins(), "Choice origins are not exported to the binary format.");
+
+            // Header
+            os.write(storm::utility::binary::MAGIC, sizeof(storm::utility::binary::MAGIC));
+            writeWord(os, storm::utility::binary::BYTE_ORDER_MARK);
+            writeWord(os, storm::utility::binary::VERSION);
+            writeWord(os, static_cast<uint64_t>(storm::utility::binary::ValueTypeIdentifier<ValueType>::id));
+            writeWord(os, storm::utility::binary::getModelTypeId(type));
+            writeWord(os, sparseModel->getNumberOfStates());
+
+            // Transitions. Notice that for CTMCs we write the rate matrix instead of probabilities.
+            writeMatrix(os, sparseModel->getTransitionMatrix());
+
+            writeLabeling(os, sparseModel->getStateLabeling());
+
+            writeWord(os, sparseModel->getNumberOfRewardModels());
+            for (auto const& rewardModel : sparseModel->getRewardModels()) {
+                writeString(os, rewardModel.first);
+                uint64_t flags = 0;
+                if (rewardModel.second.hasStateRewards()) {
+                    flags |= static_cast<uint64_t>(storm::utility::binary::RewardModelFlags::StateRewards);
+                }
+                if (rewardModel.second.hasStateActionRewards()) {
+                    flags |= static_cast<uint64_t>(storm::utility::binary::RewardModelFlags::StateActionRewards);
+                }
+                if (rewardModel.second.hasTransitionRewards()) {
+                    flags |= static_cast<uint64_t>(storm::utility::binary::RewardModelFlags::TransitionRewards);
+                }
+                writeWord(os, flags);
+                if (rewardModel.second.hasStateRewards()) {
+                    writeArray(os, rewardModel.second.getStateRewardVector());
+                }
+                if (rewardModel.second.hasStateActionRewards()) {
+                    writeArray(os, rewardModel.second.getStateActionRewardVector());
+                }
+                if (rewardModel.second.hasTransitionRewards()) {
+                    writeMatrix(os, rewardModel.second.getTransitionRewardMatrix());
+                }
+            }
+
+            if (sparseModel->hasChoiceLabeling()) {
+                writeWord(os, 1);
+                writeLabeling(os, sparseModel->getChoiceLabeling());
+            } else {
+                writeWord(os, 0);
+            }
+
+            if (type == storm::models::ModelType::Ctmc) {
+                writeArray(os, sparseModel->template as<storm::models::sparse::Ctmc<ValueType>>()->getExitRateVector());
+            } else if (type == storm::models::ModelType::MarkovAutomaton) {
+                auto ma = sparseModel->template as<storm::models::sparse::MarkovAutomaton<ValueType>>();
+                writeArray(os, ma->getExitRates());
+                writeBitVector(os, ma->getMarkovianStates());
+            }
+
+            STORM_LOG_THROW(os.good(), storm::exceptions::FileIoException, "Writing the binary model failed.");
+        }
+
+        template void binaryExportSparseModel<double>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> sparseModel);
+    }
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include <iostream>
+#include <memory>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+    namespace exporter {
+
+        /*!
+         * Exports a sparse model into the binary format that can be loaded by the BinaryEncodingParser. The stream
+         * should be opened in binary mode.
+         *
+         * @param os           Stream to export to
+         * @param sparseModel  Model to export
+         */
+        template<typename ValueType>
+        void binaryExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel);
+
+    }
+}
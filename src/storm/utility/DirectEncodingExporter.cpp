@@ -1,8 +1,13 @@
 #include "DirectEncodingExporter.h"
 
+#include <algorithm>
+#include <type_traits>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/charconv.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
@@ -15,8 +20,142 @@
 namespace storm {
     namespace exporter {
 
+        namespace {
+            void appendIndex(std::string& buffer, uint64_t index) {
+                char digits[20];
+                uint64_t position = sizeof(digits);
+                do {
+                    digits[--position] = '0' + index % 10;
+                    index /= 10;
+                } while (index > 0);
+                buffer.append(digits + position, sizeof(digits) - position);
+            }
+
+            template<typename ValueType>
+            void appendValue(std::string& buffer, ValueType const& value) {
+                buffer += storm::utility::to_string(value);
+            }
+
+            template<>
+            void appendValue(std::string& buffer, double const& value) {
+                // The shortest string that is read back as the same value, so no precision is lost.
+                char digits[storm::utility::charconv::maxDoubleLength];
+                buffer.append(digits, storm::utility::charconv::writeShortest(digits, value));
+            }
+
+            /*!
+             * Formats the row groups of a model in the DRN format. Formatting does not modify any state, so several
+             * ranges of row groups may be formatted concurrently.
+             */
+            template<typename ValueType>
+            class RowFormatter {
+            public:
+                RowFormatter(storm::models::sparse::Model<ValueType> const& model) : matrix(model.getTransitionMatrix()), hasChoiceLabeling(model.hasChoiceLabeling()) {
+                    // The labels are sorted to obtain the same order as getLabelsOfState.
+                    for (auto const& label : model.getStateLabeling().getLabels()) {
+                        stateLabels.emplace_back(label, &model.getStateLabeling().getStates(label));
+                    }
+                    if (model.hasChoiceLabeling()) {
+                        for (auto const& label : model.getChoiceLabeling().getLabels()) {
+                            choiceLabels.emplace_back(label, &model.getChoiceLabeling().getChoices(label));
+                        }
+                    }
+                    for (auto const& rewardModel : model.getRewardModels()) {
+                        rewardModels.push_back(&rewardModel.second);
+                    }
+                }
+
+                void format(std::string& buffer, uint64_t firstGroup, uint64_t endGroup) const {
+                    for (uint64_t group = firstGroup; group < endGroup; ++group) {
+                        buffer += "state ";
+                        appendIndex(buffer, group);
+
+                        // Write state rewards
+                        if (!rewardModels.empty()) {
+                            buffer += " [";
+                            for (uint64_t rewardModel = 0; rewardModel < rewardModels.size(); ++rewardModel) {
+                                if (rewardModel > 0) {
+                                    buffer += ", ";
+                                }
+                                if (rewardModels[rewardModel]->hasStateRewards()) {
+                                    appendValue(buffer, rewardModels[rewardModel]->getStateRewardVector()[group]);
+                                } else {
+                                    buffer += '0';
+                                }
+                            }
+                            buffer += ']';
+                        }
+
+                        // Write labels
+                        for (auto const& label : stateLabels) {
+                            if (label.second->get(group)) {
+                                buffer += ' ';
+                                buffer += label.first;
+                            }
+                        }
+                        buffer += '\n';
+
+                        uint64_t start = matrix.hasTrivialRowGrouping() ? group : matrix.getRowGroupIndices()[group];
+                        uint64_t end = matrix.hasTrivialRowGrouping() ? group + 1 : matrix.getRowGroupIndices()[group + 1];
+
+                        // Iterate over all actions
+                        for (uint64_t row = start; row < end; ++row) {
+                            buffer += "\taction ";
+                            if (hasChoiceLabeling) {
+                                bool first = true;
+                                for (auto const& label : choiceLabels) {
+                                    if (label.second->get(row)) {
+                                        if (!first) {
+                                            buffer += '_';
+                                        }
+                                        buffer += label.first;
+                                        first = false;
+                                    }
+                                }
+                            } else {
+                                appendIndex(buffer, row - start);
+                            }
+
+                            // Write state-action rewards
+                            if (!rewardModels.empty()) {
+                                buffer += " [";
+                                for (uint64_t rewardModel = 0; rewardModel < rewardModels.size(); ++rewardModel) {
+                                    if (rewardModel > 0) {
+                                        buffer += ", ";
+                                    }
+                                    if (rewardModels[rewardModel]->hasStateActionRewards()) {
+                                        appendValue(buffer, rewardModels[rewardModel]->getStateActionRewardVector()[row]);
+                                    } else {
+                                        buffer += '0';
+                                    }
+                                }
+                                buffer += ']';
+                            }
+                            buffer += '\n';
+
+                            // Write probabilities
+                            for (auto const& entry : matrix.getRow(row)) {
+                                buffer += "\t\t";
+                                appendIndex(buffer, entry.getColumn());
+                                buffer += " : ";
+                                appendValue(buffer, entry.getValue());
+                                buffer += '\n';
+                            }
+                        }
+                    }
+                }
+
+            private:
+                storm::storage::SparseMatrix<ValueType> const& matrix;
+                std::vector<std::pair<std::string, storm::storage::BitVector const*>> stateLabels;
+                std::vector<std::pair<std::string, storm::storage::BitVector const*>> choiceLabels;
+                bool hasChoiceLabeling;
+                std::vector<storm::models::sparse::StandardRewardModel<ValueType> const*> rewardModels;
+            };
+        }
+
         template<typename ValueType>
-        void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel, std::vector<std::string> const& parameters) {
+        void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel, std::vector<std::string> const& parameters, uint64_t numberOfThreads) {
 
             // Notice that for CTMCs we write the rate matrix instead of probabilities
 
@@ -55,90 +194,42 @@ namespace storm {
             os << "@model" << std::endl;
 
             storm::storage::SparseMatrix<ValueType> const& matrix = sparseModel->getTransitionMatrix();
-            
-            for (typename storm::storage::SparseMatrix<ValueType>::index_type group = 0; group < matrix.getRowGroupCount(); ++group) {
-                os << "state " << group;
-
-                // Write state rewards
-                bool first = true;
-                for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
-                    if (first) {
-                        os << " [";
-                        first = false;
-                    } else {
-                        os << ", ";
-                    }
-
-                    if(rewardModelEntry.second.hasStateRewards()) {
-                        os << rewardModelEntry.second.getStateRewardVector().at(group);
-                    } else {
-                        os << "0";
-                    }
-                }
 
-                if (!first) {
-                    os << "]";
-                }
+            // Collect the labelings and reward models once, such that the rows can be formatted independently.
+            RowFormatter<ValueType> formatter(*sparseModel);
 
-                // Write labels
-                for(auto const& label : sparseModel->getStateLabeling().getLabelsOfState(group)) {
-                    os << " " << label;
+            // The row groups are formatted in chunks into buffers, which are then written to the stream as a whole.
+            uint64_t const groupsPerChunk = 1024;
+            uint64_t numberOfChunks = (matrix.getRowGroupCount() + groupsPerChunk - 1) / groupsPerChunk;
+            if (numberOfThreads != 1 && !std::is_same<ValueType, double>::value) {
+                // Exact and parametric values are formatted with carl, which we do not assume to be thread-safe.
+                STORM_LOG_DEBUG("Exporting a model with exact or parametric values sequentially.");
+                numberOfThreads = 1;
+            }
+            if (numberOfThreads == 1) {
+                std::string buffer;
+                for (uint64_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+                    buffer.clear();
+                    formatter.format(buffer, chunk * groupsPerChunk, std::min((chunk + 1) * groupsPerChunk, matrix.getRowGroupCount()));
+                    os.write(buffer.data(), buffer.size());
                 }
-                os << std::endl;
-
-                // Write probabilities
-                typename storm::storage::SparseMatrix<ValueType>::index_type start = matrix.hasTrivialRowGrouping() ? group : matrix.getRowGroupIndices()[group];
-                typename storm::storage::SparseMatrix<ValueType>::index_type end = matrix.hasTrivialRowGrouping() ? group + 1 : matrix.getRowGroupIndices()[group + 1];
-
-                // Iterate over all actions
-                for (typename storm::storage::SparseMatrix<ValueType>::index_type row = start; row < end; ++row) {
-                    // Print the actual row.
-                    if (sparseModel->hasChoiceLabeling()) {
-                        os << "\taction ";
-                        bool lfirst = true;
-                        for (auto const& label : sparseModel->getChoiceLabeling().getLabelsOfChoice(row)) {
-                            if (!lfirst) {
-                                os << "_";
-                            }
-                            os << label;
-                            lfirst = false;
-                        }
-                    } else {
-                        os << "\taction " << row - start;
-                    }
-                    bool first = true;
-                    // Write transition rewards
-                    for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
-                        if (first) {
-                            os << " [";
-                            first = false;
-                        } else {
-                            os << ", ";
-                        }
-
-                        if(rewardModelEntry.second.hasStateActionRewards()) {
-                            os << storm::utility::to_string(rewardModelEntry.second.getStateActionRewardVector().at(row));
-                        } else {
-                            os << "0";
-                        }
-
-                    }
-                    if (!first) {
-                        os << "]";
-                    }
-
-                    os << std::endl;
-                    
-                    // Write probabilities
-                    for(auto it = matrix.begin(row); it != matrix.end(row); ++it) {
-                        ValueType prob = it->getValue();
-                        os << "\t\t" << it->getColumn() << " : ";
-                        os << storm::utility::to_string(prob) << std::endl;
+            } else {
+                // The chunks are formatted concurrently in batches and written in order. Limiting the size of a batch
+                // keeps the memory overhead independent of the model size.
+                storm::utility::ThreadPool threadPool(numberOfThreads);
+                std::vector<std::string> buffers(threadPool.getNumberOfThreads() * 4);
+                for (uint64_t batchStart = 0; batchStart < numberOfChunks; batchStart += buffers.size()) {
+                    uint64_t batchSize = std::min<uint64_t>(buffers.size(), numberOfChunks - batchStart);
+                    threadPool.execute(batchSize, [&] (uint64_t chunk, uint64_t) {
+                        uint64_t firstGroup = (batchStart + chunk) * groupsPerChunk;
+                        buffers[chunk].clear();
+                        formatter.format(buffers[chunk], firstGroup, std::min(firstGroup + groupsPerChunk, matrix.getRowGroupCount()));
+                    });
+                    for (uint64_t chunk = 0; chunk < batchSize; ++chunk) {
+                        os.write(buffers[chunk].data(), buffers[chunk].size());
                     }
-                    
                 }
-            } // end matrix iteration
-            
+            }
         }
 
         template<typename ValueType>
@@ -146,7 +237,7 @@ namespace storm {
             return {};
         }
 
-        template void explicitExportSparseModel<double>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> sparseModel, std::vector<std::string> const& parameters);
+        template void explicitExportSparseModel<double>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> sparseModel, std::vector<std::string> const& parameters, uint64_t numberOfThreads);
 
 #ifdef STORM_HAVE_CARL
         template<>
@@ -167,8 +258,8 @@ namespace storm {
             return parameters;
         }
 
-        template void explicitExportSparseModel<storm::RationalNumber>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> sparseModel, std::vector<std::string> const& parameters);
-        template void explicitExportSparseModel<storm::RationalFunction>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> sparseModel, std::vector<std::string> const& parameters);
+        template void explicitExportSparseModel<storm::RationalNumber>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> sparseModel, std::vector<std::string> const& parameters, uint64_t numberOfThreads);
+        template void explicitExportSparseModel<storm::RationalFunction>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> sparseModel, std::vector<std::string> const& parameters, uint64_t numberOfThreads);
 #endif
     }
 }
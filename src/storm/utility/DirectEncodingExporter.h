@@ -8,14 +8,18 @@ namespace storm {
     namespace exporter {
 
         /*!
-         * Exports a sparse model into the explicit DRN format.
+         * Exports a sparse model into the explicit DRN format. The states are formatted in chunks into buffers that are
+         * written to the stream as a whole. Floating point values are written with the fewest digits that preserve them.
          *
-         * @param os           Stream to export to
-         * @param sparseModel  Model to export
-         * @param parameters   List of parameters
+         * @param os               Stream to export to
+         * @param sparseModel      Model to export
+         * @param parameters       List of parameters
+         * @param numberOfThreads  The number of threads formatting the chunks concurrently (0 for the number of
+         *                         hardware threads). The output does not depend on the number of threads. Models with exact or
+         *                         parametric values are always exported sequentially.
          */
         template<typename ValueType>
-        void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel, std::vector<std::string> const& parameters);
+        void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel, std::vector<std::string> const& parameters, uint64_t numberOfThreads = 1);
 
         /*!
          * Accumalate parameters in the model.
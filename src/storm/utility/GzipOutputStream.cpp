@@ -0,0 +1,118 @@
+#include "storm/utility/GzipOutputStream.h"
+
+#include <vector>
+
+#include "storm-config.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+#ifdef STORM_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+namespace storm {
+    namespace utility {
+
+#ifdef STORM_HAVE_ZLIB
+        /*!
+         * Collects the written characters and compresses them whenever the buffer is full.
+         */
+        class GzipOutputStream::Buffer : public std::streambuf {
+        public:
+            Buffer(std::ostream& target) : target(target), input(1 << 16), output(1 << 16), finished(false) {
+                stream.zalloc = Z_NULL;
+                stream.zfree = Z_NULL;
+                stream.opaque = Z_NULL;
+                // Adding 16 to the window bits makes zlib write a gzip header and trailer.
+                int result = deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+                STORM_LOG_THROW(result == Z_OK, storm::exceptions::FileIoException, "Could not initialize compression.");
+                setp(input.data(), input.data() + input.size());
+            }
+
+            ~Buffer() {
+                deflateEnd(&stream);
+            }
+
+            void finish() {
+                if (!finished) {
+                    compress(Z_FINISH);
+                    finished = true;
+                }
+            }
+
+        protected:
+            virtual int_type overflow(int_type character) override {
+                STORM_LOG_THROW(!finished, storm::exceptions::FileIoException, "Writing to a finished compressed stream.");
+                compress(Z_NO_FLUSH);
+                if (!traits_type::eq_int_type(character, traits_type::eof())) {
+                    *pptr() = traits_type::to_char_type(character);
+                    pbump(1);
+                }
+                return traits_type::not_eof(character);
+            }
+
+            virtual int sync() override {
+                // Flushing the compressor would deteriorate the compression (e.g. on every std::endl), so we only hand
+                // the buffered data to zlib.
+                if (!finished) {
+                    compress(Z_NO_FLUSH);
+                }
+                return target.good() ? 0 : -1;
+            }
+
+        private:
+            void compress(int flush) {
+                stream.next_in = reinterpret_cast<Bytef*>(pbase());
+                stream.avail_in = static_cast<uInt>(pptr() - pbase());
+                do {
+                    stream.next_out = reinterpret_cast<Bytef*>(output.data());
+                    stream.avail_out = static_cast<uInt>(output.size());
+                    int result = deflate(&stream, flush);
+                    STORM_LOG_THROW(result != Z_STREAM_ERROR, storm::exceptions::FileIoException, "Compression failed.");
+                    target.write(output.data(), output.size() - stream.avail_out);
+                } while (stream.avail_out == 0);
+                STORM_LOG_ASSERT(stream.avail_in == 0, "Not all data was compressed.");
+                setp(input.data(), input.data() + input.size());
+            }
+
+            std::ostream& target;
+            std::vector<char> input;
+            std::vector<char> output;
+            z_stream stream;
+            bool finished;
+        };
+
+        GzipOutputStream::GzipOutputStream(std::ostream& target) : std::ostream(nullptr), buffer(new Buffer(target)) {
+            rdbuf(buffer.get());
+        }
+
+        GzipOutputStream::~GzipOutputStream() {
+            try {
+                finish();
+            } catch (std::exception const& e) {
+                STORM_LOG_ERROR("Finishing the compressed stream failed: " << e.what());
+            }
+        }
+
+        void GzipOutputStream::finish() {
+            flush();
+            buffer->finish();
+        }
+#else
+        class GzipOutputStream::Buffer {
+        };
+
+        GzipOutputStream::GzipOutputStream(std::ostream&) : std::ostream(nullptr) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Compressed output requires storm to be built with zlib.");
+        }
+
+        GzipOutputStream::~GzipOutputStream() = default;
+
+        void GzipOutputStream::finish() {
+            // Intentionally left empty.
+        }
+#endif
+
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <ostream>
+
+namespace storm {
+    namespace utility {
+
+        /*!
+         * An output stream that compresses everything written to it in the gzip format and writes the compressed data
+         * to another stream. Compression is only available if storm was built with zlib support, otherwise creating
+         * the stream throws a NotSupportedException.
+         */
+        class GzipOutputStream : public std::ostream {
+        public:
+            /*!
+             * Creates a stream that writes the compressed data to the given target stream.
+             *
+             * @param target The stream receiving the compressed data. It must outlive this stream.
+             */
+            GzipOutputStream(std::ostream& target);
+
+            ~GzipOutputStream();
+
+            /*!
+             * Compresses the remaining data and writes the end of the gzip stream. Nothing may be written afterwards.
+             * If this is not called explicitly, the destructor finishes the stream.
+             */
+            void finish();
+
+        private:
+            class Buffer;
+
+            std::unique_ptr<Buffer> buffer;
+        };
+
+    }
+}
@@ -0,0 +1,241 @@
+#include "storm/utility/Instrumentation.h"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sys/resource.h>
+
+#include "json.hpp"
+
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidOperationException.h"
+
+namespace storm {
+    namespace utility {
+        namespace instrumentation {
+
+            namespace detail {
+                /*!
+                 * The performance data of a scope.
+                 */
+                struct Node {
+                    Node(std::string const& name) : name(name), invocations(0), time(0), peakMemory(0) {
+                        // Intentionally left empty.
+                    }
+
+                    // The name of the scope.
+                    std::string name;
+
+                    // A mutex protecting all other members, as scopes may be entered by several threads concurrently.
+                    std::mutex mutex;
+
+                    // The scopes entered within this scope, indexed by their name.
+                    std::map<std::string, std::unique_ptr<Node>> children;
+
+                    // How often the scope was entered and the accumulated time spent in it.
+                    uint64_t invocations;
+                    std::chrono::nanoseconds time;
+
+                    // The counters of this scope.
+                    std::map<std::string, uint64_t> counters;
+
+                    // The time each thread spent in this scope.
+                    std::map<uint64_t, std::chrono::nanoseconds> threadTimes;
+
+                    // The highest peak memory usage (in bytes) observed when leaving the scope.
+                    uint64_t peakMemory;
+                };
+            }
+
+            namespace {
+                using json = nlohmann::json;
+
+                std::atomic<bool> enabled(false);
+                std::unique_ptr<detail::Node> root;
+                std::chrono::high_resolution_clock::time_point startOfCollection;
+                std::atomic<uint64_t> numberOfThreads(0);
+                thread_local detail::Node* currentNode = nullptr;
+
+                /*!
+                 * Retrieves a small index identifying the calling thread.
+                 */
+                uint64_t getThreadIndex() {
+                    thread_local uint64_t index = numberOfThreads.fetch_add(1);
+                    return index;
+                }
+
+                /*!
+                 * Retrieves the peak memory usage of the process so far in bytes.
+                 */
+                uint64_t getPeakMemoryUsage() {
+                    struct rusage ru;
+                    getrusage(RUSAGE_SELF, &ru);
+#ifdef MACOS
+                    // For Mac OS, this is returned in bytes.
+                    return ru.ru_maxrss;
+#else
+                    // For Linux, this is returned in kilobytes.
+                    return static_cast<uint64_t>(ru.ru_maxrss) * 1024;
+#endif
+                }
+
+                detail::Node* getInnermostNode() {
+                    return currentNode == nullptr ? root.get() : currentNode;
+                }
+
+                double toSeconds(std::chrono::nanoseconds time) {
+                    return std::chrono::duration_cast<std::chrono::duration<double>>(time).count();
+                }
+
+                json toJson(detail::Node& node) {
+                    std::lock_guard<std::mutex> lock(node.mutex);
+                    json result;
+                    result["name"] = node.name;
+                    result["time"] = toSeconds(node.time);
+                    result["invocations"] = node.invocations;
+                    if (node.peakMemory > 0) {
+                        result["peak-memory"] = node.peakMemory;
+                    }
+                    if (!node.counters.empty()) {
+                        json counters;
+                        for (auto const& counter : node.counters) {
+                            counters[counter.first] = counter.second;
+                        }
+                        result["counters"] = counters;
+                    }
+                    if (!node.threadTimes.empty()) {
+                        json threads = json::array();
+                        for (auto const& threadTime : node.threadTimes) {
+                            json thread;
+                            thread["thread"] = threadTime.first;
+                            thread["time"] = toSeconds(threadTime.second);
+                            threads.push_back(thread);
+                        }
+                        result["threads"] = threads;
+                    }
+                    if (!node.children.empty()) {
+                        json children = json::array();
+                        for (auto const& child : node.children) {
+                            children.push_back(toJson(*child.second));
+                        }
+                        result["children"] = children;
+                    }
+                    return result;
+                }
+            }
+
+            void enable() {
+                if (!enabled.load()) {
+                    root.reset(new detail::Node("total"));
+                    startOfCollection = std::chrono::high_resolution_clock::now();
+                    enabled.store(true);
+                }
+            }
+
+            bool isEnabled() {
+                return enabled.load(std::memory_order_relaxed);
+            }
+
+            void reset() {
+                enabled.store(false);
+                currentNode = nullptr;
+                root.reset();
+            }
+
+            void addToCounter(std::string const& name, uint64_t value) {
+                if (isEnabled()) {
+                    detail::Node* node = getInnermostNode();
+                    std::lock_guard<std::mutex> lock(node->mutex);
+                    node->counters[name] += value;
+                }
+            }
+
+            void countMultiplication(uint64_t numberOfEntries) {
+                if (isEnabled()) {
+                    detail::Node* node = getInnermostNode();
+                    std::lock_guard<std::mutex> lock(node->mutex);
+                    ++node->counters["multiplications"];
+                    node->counters["nonzeros"] += numberOfEntries;
+                }
+            }
+
+            void exportToJson(std::ostream& out) {
+                STORM_LOG_THROW(root, storm::exceptions::InvalidOperationException, "Performance data was not collected.");
+                {
+                    std::lock_guard<std::mutex> lock(root->mutex);
+                    root->invocations = 1;
+                    root->time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - startOfCollection);
+                    root->peakMemory = getPeakMemoryUsage();
+                }
+                out << toJson(*root).dump(4) << std::endl;
+            }
+
+            Scope::Scope(std::string const& name) : node(nullptr), previousNode(nullptr) {
+                if (isEnabled()) {
+                    detail::Node* parent = getInnermostNode();
+                    {
+                        std::lock_guard<std::mutex> lock(parent->mutex);
+                        std::unique_ptr<detail::Node>& child = parent->children[name];
+                        if (!child) {
+                            child.reset(new detail::Node(name));
+                        }
+                        node = child.get();
+                    }
+                    previousNode = currentNode;
+                    currentNode = node;
+                    start = std::chrono::high_resolution_clock::now();
+                }
+            }
+
+            Scope::~Scope() {
+                if (node != nullptr) {
+                    std::chrono::nanoseconds elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+                    uint64_t peakMemory = getPeakMemoryUsage();
+                    uint64_t thread = getThreadIndex();
+                    {
+                        std::lock_guard<std::mutex> lock(node->mutex);
+                        ++node->invocations;
+                        node->time += elapsed;
+                        node->threadTimes[thread] += elapsed;
+                        node->peakMemory = std::max(node->peakMemory, peakMemory);
+                    }
+                    currentNode = previousNode;
+                }
+            }
+
+            void Scope::addToCounter(std::string const& name, uint64_t value) {
+                if (node != nullptr) {
+                    std::lock_guard<std::mutex> lock(node->mutex);
+                    node->counters[name] += value;
+                }
+            }
+
+            Context::Context() : node(isEnabled() ? currentNode : nullptr) {
+                // Intentionally left empty.
+            }
+
+            ContextGuard::ContextGuard(Context const& context) : node(context.node), previousNode(currentNode) {
+                if (node != nullptr) {
+                    currentNode = node;
+                    start = std::chrono::high_resolution_clock::now();
+                }
+            }
+
+            ContextGuard::~ContextGuard() {
+                if (node != nullptr) {
+                    std::chrono::nanoseconds elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+                    uint64_t thread = getThreadIndex();
+                    {
+                        std::lock_guard<std::mutex> lock(node->mutex);
+                        node->threadTimes[thread] += elapsed;
+                    }
+                    currentNode = previousNode;
+                }
+            }
+
+        }
+    }
+}
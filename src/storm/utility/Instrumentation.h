@@ -0,0 +1,144 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace storm {
+    namespace utility {
+        namespace instrumentation {
+
+            namespace detail {
+                struct Node;
+            }
+
+            /*!
+             * Enables the collection of performance data. As long as this was not called, scopes and counters have
+             * (almost) no overhead.
+             */
+            void enable();
+
+            /*!
+             * Retrieves whether performance data is collected.
+             */
+            bool isEnabled();
+
+            /*!
+             * Disables the collection and discards all performance data collected so far.
+             */
+            void reset();
+
+            /*!
+             * Adds the given value to the counter with the given name of the innermost scope of the calling thread.
+             *
+             * @param name The name of the counter.
+             * @param value The value to add.
+             */
+            void addToCounter(std::string const& name, uint64_t value);
+
+            /*!
+             * Counts a matrix-vector multiplication in the innermost scope of the calling thread, i.e. increases the
+             * counters 'multiplications' and 'nonzeros'. This is cheap enough to be called in the hot loops of the
+             * solvers.
+             *
+             * @param numberOfEntries The number of matrix entries touched by the multiplication.
+             */
+            void countMultiplication(uint64_t numberOfEntries);
+
+            /*!
+             * Writes the collected performance data in the JSON format to the given stream. The data forms a tree of
+             * scopes, each with the accumulated time, the number of invocations, its counters, the peak memory usage
+             * of the process when the scope was left and the time spent in the scope by each thread.
+             *
+             * @param out The stream to write to.
+             */
+            void exportToJson(std::ostream& out);
+
+            /*!
+             * Measures the time between its construction and destruction and attributes it to a named scope below the
+             * innermost scope of the calling thread. Scopes with the same name and parent are accumulated.
+             */
+            class Scope {
+            public:
+                /*!
+                 * Enters the scope with the given name.
+                 *
+                 * @param name The name of the scope.
+                 */
+                Scope(std::string const& name);
+
+                /*!
+                 * Leaves the scope.
+                 */
+                ~Scope();
+
+                Scope(Scope const&) = delete;
+                Scope& operator=(Scope const&) = delete;
+
+                /*!
+                 * Adds the given value to the counter with the given name of this scope.
+                 *
+                 * @param name The name of the counter.
+                 * @param value The value to add.
+                 */
+                void addToCounter(std::string const& name, uint64_t value);
+
+            private:
+                // The node of the scope or null if performance data is not collected.
+                detail::Node* node;
+
+                // The innermost scope of the calling thread before this scope was entered.
+                detail::Node* previousNode;
+
+                // The point in time at which the scope was entered.
+                std::chrono::high_resolution_clock::time_point start;
+            };
+
+            /*!
+             * The innermost scope of the thread that created the context. This allows to attribute work that is
+             * performed by other threads on behalf of the creating thread to the right scope.
+             */
+            class Context {
+            public:
+                /*!
+                 * Captures the innermost scope of the calling thread.
+                 */
+                Context();
+
+            private:
+                friend class ContextGuard;
+
+                detail::Node* node;
+            };
+
+            /*!
+             * Makes the scope of the given context the innermost scope of the calling thread until the guard is
+             * destroyed. The time in between is attributed to the calling thread in that scope.
+             */
+            class ContextGuard {
+            public:
+                /*!
+                 * Adopts the given context.
+                 *
+                 * @param context The context to adopt.
+                 */
+                ContextGuard(Context const& context);
+
+                /*!
+                 * Restores the previous innermost scope of the calling thread.
+                 */
+                ~ContextGuard();
+
+                ContextGuard(ContextGuard const&) = delete;
+                ContextGuard& operator=(ContextGuard const&) = delete;
+
+            private:
+                detail::Node* node;
+                detail::Node* previousNode;
+                std::chrono::high_resolution_clock::time_point start;
+            };
+
+        }
+    }
+}
@@ -0,0 +1,122 @@
+#include "storm/utility/ThreadPool.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace utility {
+
+        ThreadPool::ThreadPool(uint64_t numberOfThreads) : numberOfThreads(numberOfThreads), currentFunction(nullptr), generation(0), numberOfBusyWorkers(0), shutdown(false) {
+            if (this->numberOfThreads == 0) {
+                this->numberOfThreads = std::max(1u, std::thread::hardware_concurrency());
+            }
+            chunkRanges.reset(new ChunkRange[this->numberOfThreads]);
+            for (uint64_t thread = 0; thread < this->numberOfThreads; ++thread) {
+                chunkRanges[thread].next.store(0);
+                chunkRanges[thread].end = 0;
+            }
+
+            // The calling thread also processes chunks, so we only need to start the additional threads.
+            workers.reserve(this->numberOfThreads - 1);
+            for (uint64_t thread = 1; thread < this->numberOfThreads; ++thread) {
+                workers.emplace_back(&ThreadPool::work, this, thread);
+            }
+            STORM_LOG_TRACE("Started thread pool with " << this->numberOfThreads << " threads.");
+        }
+
+        ThreadPool::~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                shutdown = true;
+            }
+            workAvailable.notify_all();
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+
+        uint64_t ThreadPool::getNumberOfThreads() const {
+            return numberOfThreads;
+        }
+
+        void ThreadPool::execute(uint64_t numberOfChunks, std::function<void (uint64_t chunk, uint64_t thread)> const& function) {
+            if (numberOfThreads == 1 || numberOfChunks <= 1) {
+                for (uint64_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+                    function(chunk, 0);
+                }
+                return;
+            }
+
+            for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+                chunkRanges[thread].next.store(numberOfChunks * thread / numberOfThreads, std::memory_order_relaxed);
+                chunkRanges[thread].end = numberOfChunks * (thread + 1) / numberOfThreads;
+            }
+
+            // Publish the work. Acquiring the mutex makes the chunk ranges visible to the workers.
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                currentFunction = &function;
+                currentContext = instrumentation::Context();
+                exception = nullptr;
+                numberOfBusyWorkers = workers.size();
+                ++generation;
+            }
+            workAvailable.notify_all();
+
+            processChunks(0);
+
+            std::unique_lock<std::mutex> lock(mutex);
+            workDone.wait(lock, [this] { return numberOfBusyWorkers == 0; });
+            currentFunction = nullptr;
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+
+        void ThreadPool::work(uint64_t thread) {
+            uint64_t processedGeneration = 0;
+            while (true) {
+                instrumentation::Context context;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    workAvailable.wait(lock, [this, processedGeneration] { return shutdown || generation != processedGeneration; });
+                    if (shutdown) {
+                        return;
+                    }
+                    processedGeneration = generation;
+                    context = currentContext;
+                }
+
+                {
+                    instrumentation::ContextGuard guard(context);
+                    processChunks(thread);
+                }
+
+                std::lock_guard<std::mutex> lock(mutex);
+                --numberOfBusyWorkers;
+                if (numberOfBusyWorkers == 0) {
+                    workDone.notify_one();
+                }
+            }
+        }
+
+        void ThreadPool::processChunks(uint64_t thread) {
+            // First process the own chunks and then try to steal chunks from the other threads in a round-robin fashion.
+            for (uint64_t offset = 0; offset < numberOfThreads; ++offset) {
+                ChunkRange& range = chunkRanges[(thread + offset) % numberOfThreads];
+                for (uint64_t chunk = range.next.fetch_add(1); chunk < range.end; chunk = range.next.fetch_add(1)) {
+                    try {
+                        (*currentFunction)(chunk, thread);
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (!exception) {
+                            exception = std::current_exception();
+                        }
+                    }
+                }
+            }
+        }
+
+    }
+}
@@ -0,0 +1,110 @@
+#ifndef STORM_UTILITY_THREADPOOL_H_
+#define STORM_UTILITY_THREADPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "storm/utility/Instrumentation.h"
+
+namespace storm {
+    namespace utility {
+
+        /*!
+         * A pool of threads that cooperatively process a number of chunks of work. The chunks are initially divided
+         * into contiguous blocks, one per thread. A thread that finished its own block steals the remaining chunks of
+         * the other threads. As the assignment of the blocks is the same every time the same number of chunks is
+         * processed, repeatedly processing the same data (as in iterative solvers) mostly touches the same memory
+         * from the same thread.
+         *
+         * The pool does not depend on any third-party library.
+         */
+        class ThreadPool {
+        public:
+            /*!
+             * Creates a thread pool.
+             *
+             * @param numberOfThreads The number of threads that process the chunks, including the thread that calls
+             * execute. If zero, the number of hardware threads is used.
+             */
+            ThreadPool(uint64_t numberOfThreads);
+
+            ~ThreadPool();
+
+            ThreadPool(ThreadPool const&) = delete;
+            ThreadPool& operator=(ThreadPool const&) = delete;
+
+            /*!
+             * Retrieves the number of threads of this pool (including the calling thread).
+             */
+            uint64_t getNumberOfThreads() const;
+
+            /*!
+             * Processes the chunks 0, ..., numberOfChunks - 1 with the given function and returns once all chunks
+             * have been processed. If the function throws for some chunk, the remaining chunks are still processed
+             * and the first exception is rethrown afterwards.
+             *
+             * @param numberOfChunks The number of chunks to process.
+             * @param function The function to apply. Its arguments are the index of the chunk and the index of the
+             * thread processing it, which is smaller than the number of threads. This can be used to accumulate
+             * results per thread without synchronization.
+             */
+            void execute(uint64_t numberOfChunks, std::function<void (uint64_t chunk, uint64_t thread)> const& function);
+
+        private:
+            // The chunks that are still to be processed by a thread. Other threads may steal chunks by incrementing
+            // the next chunk. The padding prevents false sharing between threads.
+            struct ChunkRange {
+                std::atomic<uint64_t> next;
+                uint64_t end;
+                char padding[64 - sizeof(std::atomic<uint64_t>) - sizeof(uint64_t)];
+            };
+
+            /*!
+             * The loop executed by the additional threads of the pool.
+             */
+            void work(uint64_t thread);
+
+            /*!
+             * Processes the chunks of the given thread and then steals chunks from the other threads.
+             */
+            void processChunks(uint64_t thread);
+
+            // The number of threads (including the calling thread).
+            uint64_t numberOfThreads;
+
+            // The additional threads of the pool.
+            std::vector<std::thread> workers;
+
+            // The ranges of chunks per thread.
+            std::unique_ptr<ChunkRange[]> chunkRanges;
+
+            // The function that is currently executed.
+            std::function<void (uint64_t, uint64_t)> const* currentFunction;
+
+            // The instrumentation context of the thread that called execute, such that the work of the additional
+            // threads is attributed to the scope in which execute was called.
+            instrumentation::Context currentContext;
+
+            // Synchronization of the threads. Each call to execute increases the generation to wake the workers.
+            std::mutex mutex;
+            std::condition_variable workAvailable;
+            std::condition_variable workDone;
+            uint64_t generation;
+            uint64_t numberOfBusyWorkers;
+            bool shutdown;
+
+            // The first exception that was thrown while processing the current chunks.
+            std::exception_ptr exception;
+        };
+
+    }
+}
+
+#endif /* STORM_UTILITY_THREADPOOL_H_ */
@@ -0,0 +1,35 @@
+#include "storm/utility/charconv.h"
+
+// This file is compiled as C++17 (see src/storm/CMakeLists.txt), as std::to_chars is not available before.
+#if defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace storm {
+    namespace utility {
+        namespace charconv {
+
+            char* writeShortest(char* first, double value) {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611
+                return std::to_chars(first, first + maxDoubleLength, value).ptr;
+#else
+                // Without std::to_chars, increase the number of significant digits until the value is read back exactly.
+                int length = 0;
+                for (int precision = 1; precision <= 17; ++precision) {
+                    length = std::snprintf(first, maxDoubleLength, "%.*g", precision, value);
+                    if (std::strtod(first, nullptr) == value) {
+                        break;
+                    }
+                }
+                return first + length;
+#endif
+            }
+
+        }
+    }
+}
@@ -0,0 +1,26 @@
+#ifndef STORM_UTILITY_CHARCONV_H_
+#define STORM_UTILITY_CHARCONV_H_
+
+namespace storm {
+    namespace utility {
+        namespace charconv {
+
+            /*!
+             * The number of characters that suffices for every value written by writeShortest.
+             */
+            static const int maxDoubleLength = 32;
+
+            /*!
+             * Writes the shortest decimal representation of the given value that is read back as exactly this value.
+             *
+             * @param first The beginning of the output range, which has to hold at least maxDoubleLength characters.
+             * @param value The value to write.
+             * @return The end of the written characters. No terminating null character is written.
+             */
+            char* writeShortest(char* first, double value);
+
+        }
+    }
+}
+
+#endif /* STORM_UTILITY_CHARCONV_H_ */
@@ -914,6 +914,8 @@ namespace storm {
         // other instantiations
         template unsigned long convertNumber(long const&);
         template double convertNumber(long const&);
+        template float convertNumber(double const&);
+        template double convertNumber(float const&);
         
 #if defined(STORM_HAVE_CLN)
         // Instantiations for (CLN) rational number.
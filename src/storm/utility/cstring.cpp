@@ -1,5 +1,6 @@
 #include "storm/utility/cstring.h"
 
+#include <algorithm>
 #include <cstring>
 
 #include "storm/exceptions/WrongFormatException.h"
@@ -84,6 +85,27 @@ char const* forwardToNextLine(char const* buffer) {
 	return lineEnd;
 }
 
+/*!
+ * @brief Splits the given range into chunks that start at the beginning of a line.
+ */
+std::vector<char const*> splitAtLineBoundaries(char const* begin, char const* end, uint_fast64_t numberOfChunks) {
+	std::vector<char const*> boundaries;
+	boundaries.reserve(numberOfChunks + 1);
+	boundaries.push_back(begin);
+	uint_fast64_t size = end - begin;
+	for (uint_fast64_t chunk = 1; chunk < numberOfChunks; ++chunk) {
+		char const* boundary = std::max(begin + size * chunk / numberOfChunks, boundaries.back());
+		// Move the boundary to the beginning of the next line unless it already is at the beginning of a line.
+		if (boundary != begin && boundary != end && boundary[-1] != '\n') {
+			char const* lineEnd = static_cast<char const*>(memchr(boundary, '\n', end - boundary));
+			boundary = lineEnd == nullptr ? end : lineEnd + 1;
+		}
+		boundaries.push_back(boundary);
+	}
+	boundaries.push_back(end);
+	return boundaries;
+}
+
 } // namespace cstring
 
 } // namespace utility
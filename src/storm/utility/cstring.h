@@ -9,6 +9,7 @@
 #define STORM_UTILITY_CSTRING_H_
 
 #include <cstdint>
+#include <vector>
 
 namespace storm {
 	namespace utility {
@@ -46,6 +47,13 @@ namespace storm {
 		 */
 		char const* forwardToNextLine(char const* buffer);
 
+		/*!
+		 * @brief Splits the given range into (roughly) equally large chunks that start at the beginning of a line.
+		 *
+		 * @return The boundaries of the chunks, i.e. numberOfChunks + 1 non-decreasing pointers starting with begin and ending with end. Chunks may be empty.
+		 */
+		std::vector<char const*> splitAtLineBoundaries(char const* begin, char const* end, uint_fast64_t numberOfChunks);
+
 		} // namespace cstring
 	} // namespace utility
 } // namespace storm
@@ -45,6 +45,97 @@ namespace storm {
                 return reachableStates;
             }
             
+            template <storm::dd::DdType Type>
+            std::vector<storm::dd::Bdd<Type>> computeBlocksInReverseTopologicalOrder(storm::dd::Bdd<Type> const& states, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, uint64_t maximalBlockSize) {
+                std::vector<storm::dd::Bdd<Type>> blocks;
+                storm::dd::Bdd<Type> currentBlock = states.getDdManager().getBddZero();
+                uint64_t currentBlockSize = 0;
+                uint64_t numberOfSccSets = 0;
+                
+                // Appends a union of SCCs whose successors are all in earlier blocks (or the current one).
+                auto appendSccs = [&] (storm::dd::Bdd<Type> const& sccs) {
+                    uint64_t size = sccs.getNonZeroCount();
+                    if (currentBlockSize > 0 && currentBlockSize + size > maximalBlockSize) {
+                        blocks.push_back(currentBlock);
+                        currentBlock = states.getDdManager().getBddZero();
+                        currentBlockSize = 0;
+                    }
+                    currentBlock |= sccs;
+                    currentBlockSize += size;
+                    ++numberOfSccSets;
+                };
+                
+                // We decompose the states in the manner of Xie and Beerel. The stack holds sets of states that are yet
+                // to be decomposed or, if the flag is set, unions of SCCs that are ready to be appended. The element on
+                // top of the stack can only reach states in blocks that were already appended.
+                std::vector<std::pair<storm::dd::Bdd<Type>, bool>> stack = {std::make_pair(states, false)};
+                while (!stack.empty()) {
+                    storm::dd::Bdd<Type> remaining = stack.back().first;
+                    bool isSccUnion = stack.back().second;
+                    stack.pop_back();
+                    if (isSccUnion) {
+                        appendSccs(remaining);
+                        continue;
+                    }
+                    
+                    // Trim the set: states without successors in the set only depend on earlier blocks, and states
+                    // without predecessors in the set can be solved after all others. Trimming handles acyclic parts
+                    // of the graph with few symbolic operations.
+                    std::vector<storm::dd::Bdd<Type>> sourceLayers;
+                    bool changed = true;
+                    while (changed && !remaining.isZero()) {
+                        changed = false;
+                        storm::dd::Bdd<Type> bottomStates = remaining && !remaining.inverseRelationalProduct(transitions, rowMetaVariables, columnMetaVariables);
+                        if (!bottomStates.isZero()) {
+                            appendSccs(bottomStates);
+                            remaining &= !bottomStates;
+                            changed = true;
+                        }
+                        storm::dd::Bdd<Type> sourceStates = remaining && !remaining.relationalProduct(transitions, rowMetaVariables, columnMetaVariables);
+                        if (!sourceStates.isZero()) {
+                            sourceLayers.push_back(sourceStates);
+                            remaining &= !sourceStates;
+                            changed = true;
+                        }
+                    }
+                    
+                    // The source layers come after the rest of the set, the layer that was found last first.
+                    for (auto const& layer : sourceLayers) {
+                        stack.emplace_back(layer, true);
+                    }
+                    if (remaining.isZero()) {
+                        continue;
+                    }
+                    
+                    // Compute the SCC of a pivot state as the intersection of its forward and backward reachable states.
+                    storm::dd::Bdd<Type> pivot = remaining.existsAbstractRepresentative(rowMetaVariables);
+                    storm::dd::Bdd<Type> forwardStates = pivot;
+                    storm::dd::Bdd<Type> frontier = pivot;
+                    while (!frontier.isZero()) {
+                        frontier = frontier.relationalProduct(transitions, rowMetaVariables, columnMetaVariables) && remaining && !forwardStates;
+                        forwardStates |= frontier;
+                    }
+                    storm::dd::Bdd<Type> scc = pivot;
+                    frontier = pivot;
+                    while (!frontier.isZero()) {
+                        frontier = frontier.inverseRelationalProduct(transitions, rowMetaVariables, columnMetaVariables) && forwardStates && !scc;
+                        scc |= frontier;
+                    }
+                    
+                    // The states reachable from the SCC need to be solved before it and the states that cannot be reached
+                    // from it after it.
+                    stack.emplace_back(remaining && !forwardStates, false);
+                    stack.emplace_back(scc, true);
+                    stack.emplace_back(forwardStates && !scc, false);
+                }
+                if (currentBlockSize > 0) {
+                    blocks.push_back(currentBlock);
+                }
+                
+                STORM_LOG_DEBUG("Decomposed " << states.getNonZeroCount() << " states into " << blocks.size() << " block(s) formed by " << numberOfSccSets << " set(s) of SCCs.");
+                return blocks;
+            }
+            
             template <storm::dd::DdType Type>
             storm::dd::Bdd<Type> getRowColumnDiagonal(storm::dd::DdManager<Type> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs) {
                 return ddManager.getIdentity(rowColumnMetaVariablePairs);
@@ -53,6 +144,9 @@ namespace storm {
             template storm::dd::Bdd<storm::dd::DdType::CUDD> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
             template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+            template std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> computeBlocksInReverseTopologicalOrder(storm::dd::Bdd<storm::dd::DdType::CUDD> const& states, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, uint64_t maximalBlockSize);
+            template std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> computeBlocksInReverseTopologicalOrder(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& states, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, uint64_t maximalBlockSize);
+
             template storm::dd::Bdd<storm::dd::DdType::CUDD> getRowColumnDiagonal(storm::dd::DdManager<storm::dd::DdType::CUDD> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
             template storm::dd::Bdd<storm::dd::DdType::Sylvan> getRowColumnDiagonal(storm::dd::DdManager<storm::dd::DdType::Sylvan> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <set>
 #include <vector>
 
@@ -26,6 +27,22 @@ namespace storm {
             template <storm::dd::DdType Type>
             storm::dd::Bdd<Type> computeReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
             
+            /*!
+             * Partitions the given states into blocks that can be solved one after the other: every block is a union of
+             * SCCs of the graph restricted to the given states, and a transition leaving a block can only lead to a
+             * block that comes earlier in the result or to a state outside the given ones. Consecutive SCCs are merged
+             * into one block as long as it holds at most the given number of states, larger SCCs form a block of their own.
+             *
+             * @param states The states to partition.
+             * @param transitions The transition relation over the row and column meta variables.
+             * @param rowMetaVariables The row meta variables.
+             * @param columnMetaVariables The column meta variables.
+             * @param maximalBlockSize The number of states up to which SCCs are merged into one block.
+             * @return The blocks in the order in which they can be solved.
+             */
+            template <storm::dd::DdType Type>
+            std::vector<storm::dd::Bdd<Type>> computeBlocksInReverseTopologicalOrder(storm::dd::Bdd<Type> const& states, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, uint64_t maximalBlockSize);
+            
             template <storm::dd::DdType Type, typename ValueType>
             storm::dd::Add<Type, ValueType> getRowColumnDiagonal(storm::dd::DdManager<Type> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
 
@@ -20,6 +20,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/utility/constants.h"
+#include "storm/utility/Instrumentation.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 
@@ -322,6 +323,7 @@ namespace storm {
             
             template <typename T>
             std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                storm::utility::instrumentation::Scope scope("prob01");
                 std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
                 result.first = performProbGreater0(backwardTransitions, phiStates, psiStates);
                 result.second = performProb1(backwardTransitions, phiStates, psiStates, result.first);
@@ -662,6 +664,7 @@ namespace storm {
             
             template <typename T>
             std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                storm::utility::instrumentation::Scope scope("prob01");
                 std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
                 
                 result.first = performProb0A(backwardTransitions, phiStates, psiStates);
@@ -874,6 +877,7 @@ namespace storm {
             
             template <typename T>
             std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                storm::utility::instrumentation::Scope scope("prob01");
                 std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
                 result.first = performProb0E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
                 result.second = performProb1A(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
@@ -0,0 +1,45 @@
+#include "storm/utility/simd.h"
+
+namespace storm {
+    namespace utility {
+        namespace simd {
+            
+            std::ostream& operator<<(std::ostream& out, SimdKernel const& kernel) {
+                switch (kernel) {
+                    case SimdKernel::None: out << "none"; break;
+                    case SimdKernel::Avx2: out << "AVX2"; break;
+                    case SimdKernel::Avx512: out << "AVX-512"; break;
+                }
+                return out;
+            }
+            
+            bool isSupported(SimdKernel const& kernel) {
+                switch (kernel) {
+                    case SimdKernel::None:
+                        return true;
+#ifdef STORM_HAVE_X86_SIMD_KERNELS
+                    case SimdKernel::Avx2:
+                        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+                    case SimdKernel::Avx512:
+                        return __builtin_cpu_supports("avx512f");
+#else
+                    case SimdKernel::Avx2:
+                    case SimdKernel::Avx512:
+                        return false;
+#endif
+                }
+                return false;
+            }
+            
+            SimdKernel getBestSupportedKernel() {
+                if (isSupported(SimdKernel::Avx512)) {
+                    return SimdKernel::Avx512;
+                } else if (isSupported(SimdKernel::Avx2)) {
+                    return SimdKernel::Avx2;
+                }
+                return SimdKernel::None;
+            }
+            
+        }
+    }
+}
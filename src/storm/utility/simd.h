@@ -0,0 +1,36 @@
+#pragma once
+
+#include <iostream>
+
+// Kernels using x86 vector extensions are only compiled if the compiler allows to enable them per function.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define STORM_HAVE_X86_SIMD_KERNELS
+#endif
+
+namespace storm {
+    namespace utility {
+        namespace simd {
+            
+            // The SIMD instruction sets for which storm provides dedicated kernels.
+            enum class SimdKernel { None, Avx2, Avx512 };
+            
+            std::ostream& operator<<(std::ostream& out, SimdKernel const& kernel);
+            
+            /*!
+             * Retrieves whether the given kernel can be executed on the current machine.
+             *
+             * @param kernel The kernel to check.
+             * @return True iff storm was compiled with support for the kernel and the processor supports it.
+             */
+            bool isSupported(SimdKernel const& kernel);
+            
+            /*!
+             * Retrieves the most powerful kernel that can be executed on the current machine.
+             *
+             * @return The best available kernel.
+             */
+            SimdKernel getBestSupportedKernel();
+            
+        }
+    }
+}
@@ -0,0 +1,58 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include<carl/core/VariablePool.h>
+
+#include "storm-pars/api/storm-pars.h"
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+
+TEST(SampleParsingTest, Brp_Prob) {
+    carl::VariablePool::getInstance().clear();
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=5 ]";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+    ASSERT_EQ(2ull, modelParameters.size());
+
+    // Two cartesian products with 2 * 3 and 1 * 1 sample points.
+    auto samples = storm::api::parseSamples<storm::RationalFunction>("pL=0.8:0.9,pK=0.7:0.8:0.9; pK=1, pL=0.5", *model, true);
+    EXPECT_TRUE(samples.graphPreserving);
+    ASSERT_EQ(2ull, samples.cartesianProducts.size());
+    std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> samplePoints = storm::api::getSamplePoints(samples);
+    ASSERT_EQ(7ull, samplePoints.size());
+    for (auto const& samplePoint : samplePoints) {
+        EXPECT_EQ(2ull, samplePoint.size());
+    }
+
+    // The results at the sample points coincide with the instantiations of the parametric result.
+    auto parametricResult = storm::api::verifyWithSparseEngine<storm::RationalFunction>(model, storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+    storm::RationalFunction function = parametricResult->asExplicitQuantitativeCheckResult<storm::RationalFunction>()[*model->getInitialStates().begin()];
+
+    storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> modelchecker(*model);
+    modelchecker.specifyFormula(storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+    modelchecker.setInstantiationsAreGraphPreserving(samples.graphPreserving);
+    storm::Environment env;
+    for (auto const& samplePoint : samplePoints) {
+        auto result = modelchecker.check(env, samplePoint);
+        double expected = storm::utility::convertNumber<double>(function.evaluate(samplePoint));
+        EXPECT_NEAR(expected, result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()], 1e-6);
+    }
+
+    // All parameters need to be sampled and only parameters can be sampled.
+    EXPECT_THROW(storm::api::parseSamples<storm::RationalFunction>("pL=0.8:0.9", *model), storm::exceptions::WrongFormatException);
+    EXPECT_THROW(storm::api::parseSamples<storm::RationalFunction>("pL=0.8,pK=0.9,N=16", *model), storm::exceptions::WrongFormatException);
+    EXPECT_THROW(storm::api::parseSamples<storm::RationalFunction>("pL:0.8,pK=0.9", *model), storm::exceptions::WrongFormatException);
+    EXPECT_TRUE(storm::api::parseSamples<storm::RationalFunction>("", *model).empty());
+}
+
+#endif
@@ -0,0 +1,67 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include<carl/core/VariablePool.h>
+
+#include "storm-pars/api/storm-pars.h"
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/GmmxxSolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+
+TEST(SparseDtmcInstantiationModelCheckerTest, Brp_Prob_Batch) {
+    carl::VariablePool::getInstance().clear();
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=5 ]";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+    ASSERT_EQ(2ull, modelParameters.size());
+
+    // Only the precision of the selected solver is tight, so the batch is only accurate if it respects the selected solver.
+    double precision = 1e-10;
+    storm::Environment env;
+    env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Gmmxx);
+    env.solver().gmmxx().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(precision));
+    env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-3));
+
+    // The number of valuations exceeds the size of a chunk, so several chunks (with the last one only partially filled) are considered.
+    std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> valuations;
+    for (uint64_t i = 1; i < 10; ++i) {
+        for (uint64_t j = 1; j < 10; ++j) {
+            storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+            valuation.emplace(*modelParameters.begin(), storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.1 * i));
+            valuation.emplace(*modelParameters.rbegin(), storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.1 * j));
+            valuations.push_back(std::move(valuation));
+        }
+    }
+
+    for (bool graphPreserving : {true, false}) {
+        storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> modelchecker(*model);
+        modelchecker.specifyFormula(storm::api::createTask<storm::RationalFunction>(formulas[0], false));
+        modelchecker.setInstantiationsAreGraphPreserving(graphPreserving);
+        std::vector<std::vector<double>> batchResult = modelchecker.checkBatch(env, valuations);
+        ASSERT_EQ(valuations.size(), batchResult.size());
+
+        storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> referenceChecker(*model);
+        referenceChecker.specifyFormula(storm::api::createTask<storm::RationalFunction>(formulas[0], false));
+        for (uint64_t i = 0; i < valuations.size(); ++i) {
+            auto result = referenceChecker.check(env, valuations[i]);
+            auto const& expected = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            ASSERT_EQ(expected.size(), batchResult[i].size());
+            for (uint64_t state = 0; state < expected.size(); ++state) {
+                EXPECT_NEAR(expected[state], batchResult[i][state], precision);
+            }
+        }
+    }
+}
+
+#endif
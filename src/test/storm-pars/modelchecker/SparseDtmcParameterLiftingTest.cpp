@@ -80,6 +80,47 @@ namespace {
     
     }
     
+#ifdef STORM_CARL_THREAD_SAFE
+    TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_RefineParallel) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P<=0.84 [F s=5 ]";
+        std::string constantsAsString = ""; //e.g. pL=0.9,TOACK=0.5
+    
+        // Program and formula
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+        
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+        modelParameters.insert(rewParameters.begin(), rewParameters.end());
+        
+        auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+        auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+        std::vector<std::shared_ptr<storm::modelchecker::RegionModelChecker<storm::RationalFunction>>> additionalCheckers;
+        for (uint64_t thread = 1; thread < 4; ++thread) {
+            additionalCheckers.push_back(storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task));
+        }
+        
+        //start testing
+        auto region=storm::api::parseRegion<storm::RationalFunction>("0.1<=pL<=0.9,0.1<=pK<=0.9", modelParameters);
+        auto sequentialResult = regionChecker->performRegionRefinement(this->env(), region, storm::utility::convertNumber<storm::RationalFunction>(0.2), 4ull);
+        auto parallelResult = regionChecker->performRegionRefinement(this->env(), region, storm::utility::convertNumber<storm::RationalFunction>(0.2), 4ull, storm::modelchecker::RegionResultHypothesis::Unknown, additionalCheckers);
+        
+        // The refinement has to yield the same regions with the same results, irrespective of the number of threads.
+        ASSERT_EQ(sequentialResult->getRegionResults().size(), parallelResult->getRegionResults().size());
+        for (uint64_t i = 0; i < sequentialResult->getRegionResults().size(); ++i) {
+            EXPECT_EQ(sequentialResult->getRegionResults()[i].first.toString(), parallelResult->getRegionResults()[i].first.toString());
+            EXPECT_EQ(sequentialResult->getRegionResults()[i].second, parallelResult->getRegionResults()[i].second);
+        }
+        EXPECT_EQ(sequentialResult->getSatFraction(), parallelResult->getSatFraction());
+        EXPECT_EQ(sequentialResult->getUnsatFraction(), parallelResult->getUnsatFraction());
+    }
+#endif
+    
     TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Rew) {
         typedef typename TestFixture::ValueType ValueType;
         std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp_rewards16_2.pm";
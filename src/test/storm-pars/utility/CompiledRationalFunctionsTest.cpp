@@ -0,0 +1,114 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include<carl/core/VariablePool.h>
+
+#include "storm-pars/utility/CompiledRationalFunctions.h"
+#include "storm-pars/utility/ModelInstantiator.h"
+#include "storm/api/storm.h"
+#include "storm/models/sparse/Dtmc.h"
+
+namespace {
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> buildBrp() {
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P=? [F s=5 ]";
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        return storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    }
+}
+
+TEST(CompiledRationalFunctionsTest, BrpTransitionFunctions) {
+    carl::VariablePool::getInstance().clear();
+    auto dtmc = buildBrp();
+
+    storm::utility::CompiledRationalFunctions compiledFunctions;
+    std::vector<storm::RationalFunction> functions;
+    for (auto const& entry : dtmc->getTransitionMatrix()) {
+        uint64_t index = compiledFunctions.addFunction(entry.getValue());
+        if (index == functions.size()) {
+            functions.push_back(entry.getValue());
+        }
+        EXPECT_EQ(functions[index], entry.getValue());
+    }
+    EXPECT_EQ(functions.size(), compiledFunctions.getNumberOfFunctions());
+    ASSERT_EQ(2ull, compiledFunctions.getVariables().size());
+
+    // Evaluate the functions for some valuations with carl and with the compiled program.
+    std::vector<std::pair<double, double>> points = {{0.8, 0.9}, {0.1, 0.5}, {0.99, 0.01}, {0.5, 0.5}, {0.3, 0.7}, {0.6, 0.2}, {0.25, 0.75}, {0.9, 0.3}, {0.45, 0.55}, {0.7, 0.65}};
+    std::vector<double> batchValues(2 * points.size());
+    std::vector<std::vector<double>> expectedResults;
+    for (uint64_t point = 0; point < points.size(); ++point) {
+        storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+        valuation.emplace(compiledFunctions.getVariables()[0], storm::utility::convertNumber<storm::RationalFunctionCoefficient>(points[point].first));
+        valuation.emplace(compiledFunctions.getVariables()[1], storm::utility::convertNumber<storm::RationalFunctionCoefficient>(points[point].second));
+        batchValues[point] = points[point].first;
+        batchValues[points.size() + point] = points[point].second;
+
+        std::vector<double> expected;
+        for (auto const& function : functions) {
+            expected.push_back(storm::utility::convertNumber<double>(function.evaluate(valuation)));
+        }
+
+        std::vector<double> variableValues = compiledFunctions.getVariableValues(valuation);
+        std::vector<double> registers = compiledFunctions.createRegisters();
+        std::vector<double> results(functions.size());
+        compiledFunctions.evaluate(variableValues.data(), registers, results.data());
+        for (uint64_t function = 0; function < functions.size(); ++function) {
+            EXPECT_NEAR(expected[function], results[function], 1e-12);
+            EXPECT_NEAR(expected[function], compiledFunctions.evaluate(function, variableValues.data(), registers), 1e-12);
+        }
+        expectedResults.push_back(std::move(expected));
+    }
+
+    // The number of points is not a multiple of the block size, so the last block is only partially filled.
+    std::vector<double> batchResults(functions.size() * points.size());
+    compiledFunctions.evaluateBatch(points.size(), batchValues.data(), batchResults.data());
+    for (uint64_t point = 0; point < points.size(); ++point) {
+        for (uint64_t function = 0; function < functions.size(); ++function) {
+            EXPECT_NEAR(expectedResults[point][function], batchResults[function * points.size() + point], 1e-12);
+        }
+    }
+
+    // Functions can still be added after single functions have been evaluated.
+    storm::RationalFunction product = functions.front() * functions.back();
+    uint64_t productIndex = compiledFunctions.addFunction(product);
+    storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+    valuation.emplace(compiledFunctions.getVariables()[0], storm::utility::convertNumber<storm::RationalFunctionCoefficient>(points.front().first));
+    valuation.emplace(compiledFunctions.getVariables()[1], storm::utility::convertNumber<storm::RationalFunctionCoefficient>(points.front().second));
+    std::vector<double> variableValues = compiledFunctions.getVariableValues(valuation);
+    std::vector<double> registers = compiledFunctions.createRegisters();
+    EXPECT_NEAR(storm::utility::convertNumber<double>(product.evaluate(valuation)), compiledFunctions.evaluate(productIndex, variableValues.data(), registers), 1e-12);
+    EXPECT_NEAR(expectedResults.front().front(), compiledFunctions.evaluate(0, variableValues.data(), registers), 1e-12);
+}
+
+TEST(CompiledRationalFunctionsTest, BrpInstantiation) {
+    carl::VariablePool::getInstance().clear();
+    auto dtmc = buildBrp();
+
+    storm::utility::ModelInstantiator<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::models::sparse::Dtmc<double>> exactInstantiator(*dtmc);
+    storm::utility::ModelInstantiator<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::models::sparse::Dtmc<double>> compiledInstantiator(*dtmc, true);
+
+    std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+    storm::RationalFunctionVariable const& pL = carl::VariablePool::getInstance().findVariableWithName("pL");
+    ASSERT_NE(pL, carl::Variable::NO_VARIABLE);
+    storm::RationalFunctionVariable const& pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+    ASSERT_NE(pK, carl::Variable::NO_VARIABLE);
+    valuation.insert(std::make_pair(pL, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.8)));
+    valuation.insert(std::make_pair(pK, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.9)));
+
+    auto const& exactMatrix = exactInstantiator.instantiate(valuation).getTransitionMatrix();
+    auto const& compiledMatrix = compiledInstantiator.instantiate(valuation).getTransitionMatrix();
+    ASSERT_EQ(exactMatrix.getEntryCount(), compiledMatrix.getEntryCount());
+    auto compiledEntryIt = compiledMatrix.begin();
+    for (auto const& exactEntry : exactMatrix) {
+        EXPECT_EQ(exactEntry.getColumn(), compiledEntryIt->getColumn());
+        EXPECT_NEAR(exactEntry.getValue(), compiledEntryIt->getValue(), 1e-12);
+        ++compiledEntryIt;
+    }
+}
+
+#endif
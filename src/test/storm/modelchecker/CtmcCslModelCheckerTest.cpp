@@ -5,6 +5,7 @@
 #include "storm/api/builder.h"
 #include "storm/api/model_descriptions.h"
 #include "storm/api/properties.h"
+#include "storm/api/verification.h"
 #include "storm/parser/FormulaParser.h"
 #include "storm/logic/Formulas.h"
 #include "storm/solver/EigenLinearEquationSolver.h"
@@ -14,7 +15,9 @@
 #include "storm/models/symbolic/Ctmc.h"
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/HybridCtmcCslModelChecker.h"
+#include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
@@ -364,4 +367,67 @@ namespace {
         
         
     }
-}
\ No newline at end of file
+    
+    TEST(SparseCtmcCslHelperTest, BatchedBoundedUntil) {
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm");
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [ F<=100 !\"minimum\"]", program));
+        auto model = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Ctmc<double>>();
+        
+        storm::Environment env;
+        storm::solver::GeneralLinearEquationSolverFactory<double> factory;
+        storm::storage::BitVector phiStates(model->getNumberOfStates(), true);
+        storm::storage::BitVector psiStates = ~model->getStates("minimum");
+        
+        std::vector<std::pair<double, double>> timeBounds = {{0.0, 100.0}, {0.0, 0.5}, {0.0, 2000.0}, {100.0, 100.0}, {2.0, 2.0}, {100.0, 2000.0}, {10.0, 20.0}, {20.0, 30.0}, {0.0, 0.0}, {1.0, storm::utility::infinity<double>()}};
+        for (bool detectSteadyState : {false, true}) {
+            std::vector<std::vector<double>> batchedResult = storm::modelchecker::helper::SparseCtmcCslHelper::computeBatchedBoundedUntilProbabilities(env, model->getTransitionMatrix(), model->getBackwardTransitions(), phiStates, psiStates, model->getExitRateVector(), false, timeBounds, factory, detectSteadyState);
+            ASSERT_EQ(model->getNumberOfStates(), batchedResult.size());
+            
+            // Without steady-state detection, the batched computation performs exactly the same operations as the individual ones.
+            double precision = detectSteadyState ? 1e-4 : 1e-12;
+            for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+                std::vector<double> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(env, storm::solver::SolveGoal<double>(), model->getTransitionMatrix(), model->getBackwardTransitions(), phiStates, psiStates, model->getExitRateVector(), false, timeBounds[boundIndex].first, timeBounds[boundIndex].second, factory);
+                for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+                    ASSERT_EQ(timeBounds.size(), batchedResult[state].size());
+                    EXPECT_NEAR(result[state], batchedResult[state][boundIndex], precision);
+                }
+            }
+        }
+        
+        std::vector<std::vector<double>> batchedResult = storm::modelchecker::helper::SparseCtmcCslHelper::computeBatchedBoundedUntilProbabilities(env, model->getTransitionMatrix(), model->getBackwardTransitions(), phiStates, psiStates, model->getExitRateVector(), false, timeBounds, factory);
+        uint64_t initialState = *model->getInitialStates().begin();
+        EXPECT_NEAR(5.5461254704419085E-5, batchedResult[initialState][0], 1e-6);
+        EXPECT_NEAR(2.3397873548343415E-6, batchedResult[initialState][3], 1e-6);
+        EXPECT_NEAR(0.001105335651670241, batchedResult[initialState][5], 1e-6);
+    }
+    
+    TEST(SparseCtmcCslModelCheckerTest, BatchedBoundedUntil) {
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm");
+        std::string formulasString = "P=? [ F<=100 !\"minimum\"];P=? [ F[100,2000] !\"minimum\"];P=? [ \"minimum\" U<=10 \"premium\"];P=? [ F<=0.5 !\"minimum\"];P=? [ F[10,20] !\"minimum\"]";
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+        auto model = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Ctmc<double>>();
+        
+        for (auto const& formula : formulas) {
+            EXPECT_TRUE(storm::api::isBatchableTimeBoundedReachabilityFormula(*formula));
+        }
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> batchedResults = storm::api::verifyTimeBoundedReachabilityWithSparseEngine<double>(model, formulas);
+        ASSERT_EQ(formulas.size(), batchedResults.size());
+        
+        storm::Environment env;
+        storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>> checker(*model);
+        for (uint64_t index = 0; index < formulas.size(); ++index) {
+            std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[index]));
+            auto const& expected = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            auto const& actual = batchedResults[index]->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            ASSERT_EQ(expected.size(), actual.size());
+            for (uint64_t state = 0; state < expected.size(); ++state) {
+                EXPECT_NEAR(expected[state], actual[state], 1e-4);
+            }
+        }
+        
+        auto unbatchableFormulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P>0.5 [ F<=100 !\"minimum\"];P=? [ F !\"minimum\"]", program));
+        for (auto const& formula : unbatchableFormulas) {
+            EXPECT_FALSE(storm::api::isBatchableTimeBoundedReachabilityFormula(*formula));
+        }
+    }
+}
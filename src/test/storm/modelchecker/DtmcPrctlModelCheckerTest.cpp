@@ -301,6 +301,41 @@ namespace {
         }
     };
     
+    class HybridCuddNativeJacobiBlockwiseEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::CUDD;
+        static const storm::settings::modules::CoreSettings::Engine engine = storm::settings::modules::CoreSettings::Engine::Hybrid;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::symbolic::Dtmc<ddType, ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setHybridBlockwise(true);
+            env.solver().setHybridMaximalBlockSize(4);
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Jacobi);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            return env;
+        }
+    };
+    
+    class HybridSylvanNativeRationalSearchBlockwiseEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
+        static const storm::settings::modules::CoreSettings::Engine engine = storm::settings::modules::CoreSettings::Engine::Hybrid;
+        static const bool isExact = true;
+        typedef storm::RationalNumber ValueType;
+        typedef storm::models::symbolic::Dtmc<ddType, ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setHybridBlockwise(true);
+            env.solver().setHybridMaximalBlockSize(4);
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::RationalSearch);
+            return env;
+        }
+    };
+    
     class DdSylvanNativePowerEnvironment {
     public:
         static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
@@ -452,6 +487,8 @@ namespace {
             HybridCuddNativeJacobiEnvironment,
             HybridCuddNativeSoundPowerEnvironment,
             HybridSylvanNativeRationalSearchEnvironment,
+            HybridCuddNativeJacobiBlockwiseEnvironment,
+            HybridSylvanNativeRationalSearchBlockwiseEnvironment,
             DdSylvanNativePowerEnvironment,
             DdCuddNativeJacobiEnvironment,
             DdSylvanRationalSearchEnvironment
@@ -6,6 +6,7 @@
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHintCache.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
@@ -197,3 +198,50 @@ TEST(ExplicitMdpPrctlModelCheckerTest, AsynchronousLeader) {
     EXPECT_NEAR(30.0/7.0, quantitativeResult6[0], precision);
 }
 
+
+TEST(ExplicitMdpPrctlModelCheckerTest, DiceWithHintCache) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab", "", "");
+    storm::Environment env;
+    double const precision = 1e-6;
+    // Increase precision a little to get more accurate results
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+
+    ASSERT_EQ(abstractModel->getType(), storm::models::ModelType::Mdp);
+
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = abstractModel->as<storm::models::sparse::Mdp<double>>();
+    auto hintCache = std::make_shared<storm::modelchecker::ExplicitModelCheckerHintCache<double>>();
+
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    checker.setHintCache(hintCache);
+
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("Pmin=? [F \"two\"]");
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, *formula);
+    EXPECT_NEAR(1.0/36.0, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    EXPECT_EQ(0ull, hintCache->getNumberOfHits());
+    EXPECT_EQ(0ull, hintCache->getNumberOfWarmStarts());
+
+    // The cache is shared with a second model checker for the same model.
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> otherChecker(*mdp);
+    otherChecker.setHintCache(hintCache);
+
+    result = otherChecker.check(env, *formula);
+    EXPECT_NEAR(1.0/36.0, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    EXPECT_EQ(1ull, hintCache->getNumberOfHits());
+
+    formula = formulaParser.parseSingleFormulaFromString("Pmin=? [F (\"two\" | \"three\")]");
+
+    result = otherChecker.check(env, *formula);
+    EXPECT_NEAR(3.0/36.0, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    EXPECT_EQ(1ull, hintCache->getNumberOfWarmStarts());
+
+    formula = formulaParser.parseSingleFormulaFromString("Pmax=? [F \"two\"]");
+
+    result = checker.check(env, *formula);
+    EXPECT_NEAR(1.0/36.0, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    EXPECT_EQ(1ull, hintCache->getNumberOfHits());
+    EXPECT_EQ(1ull, hintCache->getNumberOfWarmStarts());
+}
@@ -138,6 +138,37 @@ namespace {
             return env;
         }
     };
+    class HybridCuddDoubleValueIterationBlockwiseEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::CUDD;
+        static const storm::settings::modules::CoreSettings::Engine engine = storm::settings::modules::CoreSettings::Engine::Hybrid;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::symbolic::Mdp<ddType, ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setHybridBlockwise(true);
+            env.solver().setHybridMaximalBlockSize(4);
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+            return env;
+        }
+    };
+    class HybridSylvanRationalPolicyIterationBlockwiseEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
+        static const storm::settings::modules::CoreSettings::Engine engine = storm::settings::modules::CoreSettings::Engine::Hybrid;
+        static const bool isExact = true;
+        typedef storm::RationalNumber ValueType;
+        typedef storm::models::symbolic::Mdp<ddType, ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setHybridBlockwise(true);
+            env.solver().setHybridMaximalBlockSize(4);
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::PolicyIteration);
+            return env;
+        }
+    };
    class DdCuddDoubleValueIterationEnvironment {
     public:
         static const storm::dd::DdType ddType = storm::dd::DdType::CUDD;
@@ -289,6 +320,8 @@ namespace {
             HybridSylvanDoubleValueIterationEnvironment,
             HybridCuddDoubleSoundValueIterationEnvironment,
             HybridSylvanRationalPolicyIterationEnvironment,
+            HybridCuddDoubleValueIterationBlockwiseEnvironment,
+            HybridSylvanRationalPolicyIterationBlockwiseEnvironment,
             DdCuddDoubleValueIterationEnvironment,
             DdSylvanDoubleValueIterationEnvironment,
             DdCuddDoublePolicyIterationEnvironment,
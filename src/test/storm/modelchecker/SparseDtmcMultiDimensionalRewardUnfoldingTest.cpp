@@ -1,10 +1,12 @@
 #include "gtest/gtest.h"
 #include "storm-config.h"
 
+#include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/solver/LinearEquationSolver.h"
 #include "storm/utility/constants.h"
 #include "storm/api/storm.h"
 #include "storm/environment/Environment.h"
@@ -97,3 +99,32 @@ TEST(SparseDtmcMultiDimensionalRewardUnfoldingTest, cost_bounded_crowds) {
     ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
     EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("620529/1364000")), result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
 }
+
+TEST(SparseDtmcMultiDimensionalRewardUnfoldingTest, cost_bounded_crowds_epoch_threads) {
+    storm::Environment env;
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/dtmc/crowds_cost_bounded.pm";
+    std::string formulasAsString = "P=? [F{\"num_runs\"}<=3,{\"observe0\"}>1 true]";
+    formulasAsString += "; P=? [F{\"num_runs\"}<=3,{\"observe1\"}>1 true]";
+    formulasAsString += "; R{\"observe0\"}=? [C{\"num_runs\"}<=3]";
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "CrowdSize=4");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Dtmc<double>>();
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalNumber>> exactDtmc = storm::api::buildSparseModel<storm::RationalNumber>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalNumber>>();
+    uint_fast64_t const initState = *dtmc->getInitialStates().begin();
+    storm::solver::GeneralLinearEquationSolverFactory<double> factory;
+    storm::solver::GeneralLinearEquationSolverFactory<storm::RationalNumber> exactFactory;
+
+    for (auto const& formula : formulas) {
+        auto operatorFormula = std::static_pointer_cast<storm::logic::OperatorFormula const>(formula);
+        auto sequentialResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<double>::computeRewardBoundedValues(env, *dtmc, operatorFormula, factory, 1);
+        auto parallelResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<double>::computeRewardBoundedValues(env, *dtmc, operatorFormula, factory, 4);
+        EXPECT_NEAR(sequentialResult.at(initState), parallelResult.at(initState), storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+
+        // Exact numbers are not shared between threads, so the epochs are solved sequentially.
+        auto exactResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<storm::RationalNumber>::computeRewardBoundedValues(env, *exactDtmc, operatorFormula, exactFactory, 4);
+        EXPECT_NEAR(storm::utility::convertNumber<double>(exactResult.at(initState)), parallelResult.at(initState), storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    }
+}
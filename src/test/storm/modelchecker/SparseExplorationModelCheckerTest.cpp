@@ -86,3 +86,38 @@ TEST(SparseExplorationModelCheckerTest, AsynchronousLeader) {
     
     EXPECT_NEAR(1, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
 }
+
+TEST(SparseExplorationModelCheckerTest, DiceMultiThreaded) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+    double precision = storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision();
+    
+    std::vector<std::pair<std::string, double>> formulasAndResults = {{"Pmin=? [F \"two\"]", 0.0277777612209320068}, {"Pmax=? [F \"two\"]", 0.0277777612209320068}, {"Pmin=? [F \"three\"]", 0.0555555224418640136}, {"Pmax=? [F \"three\"]", 0.0555555224418640136}, {"Pmin=? [F \"four\"]", 0.083333283662796020508}, {"Pmax=? [F \"four\"]", 0.083333283662796020508}};
+    for (uint64_t numberOfThreads : {2, 4}) {
+        storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Mdp<double>, uint32_t> checker(program, numberOfThreads);
+        for (auto const& formulaAndResult : formulasAndResults) {
+            std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaAndResult.first);
+            std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+            EXPECT_NEAR(formulaAndResult.second, result->asExplicitQuantitativeCheckResult<double>()[0], precision) << formulaAndResult.first << " with " << numberOfThreads << " threads";
+        }
+    }
+}
+
+TEST(SparseExplorationModelCheckerTest, AsynchronousLeaderMultiThreaded) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm");
+    
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+    double precision = storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision();
+    
+    for (uint64_t numberOfThreads : {2, 4}) {
+        storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Mdp<double>, uint32_t> checker(program, numberOfThreads);
+        for (std::string const& formulaString : {"Pmin=? [F \"elected\"]", "Pmax=? [F \"elected\"]"}) {
+            std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaString);
+            std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+            EXPECT_NEAR(1, result->asExplicitQuantitativeCheckResult<double>()[0], precision) << formulaString << " with " << numberOfThreads << " threads";
+        }
+    }
+}
@@ -0,0 +1,66 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/builder.h"
+#include "storm/api/model_descriptions.h"
+#include "storm/api/properties.h"
+#include "storm/logic/Formulas.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
+#include "storm/modelchecker/csl/helper/SparseMarkovAutomatonCslHelper.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/environment/Environment.h"
+
+namespace {
+
+    /*
+     * Checks the time-bounded reachability formulas with Unif+ (using one and several threads) against the results of
+     * the discretization-based technique (Imca). Returns whether the probabilistic states of the model contain a cycle,
+     * i.e., whether Unif+ had to solve the sub-MDP of the probabilistic states with a solver.
+     */
+    bool checkUnifPlusAgainstImca(std::string const& programFile, std::string const& formulasString) {
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+        auto ma = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::MarkovAutomaton<double>>();
+        EXPECT_TRUE(ma->isClosed());
+
+        storm::Environment env;
+        storm::solver::GeneralMinMaxLinearEquationSolverFactory<double> factory;
+        storm::modelchecker::SparseMarkovAutomatonCslModelChecker<storm::models::sparse::MarkovAutomaton<double>> checker(*ma);
+        for (auto const& formula : formulas) {
+            auto const& operatorFormula = formula->asProbabilityOperatorFormula();
+            auto const& pathFormula = operatorFormula.getSubformula().asBoundedUntilFormula();
+            storm::storage::BitVector psiStates = checker.check(env, pathFormula.getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            std::pair<double, double> boundsPair(0.0, pathFormula.getNonStrictUpperBound<double>());
+
+            std::vector<double> imcaResult = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesImca(env, operatorFormula.getOptimalityType(), ma->getTransitionMatrix(), ma->getExitRates(), ma->getMarkovianStates(), psiStates, boundsPair, factory);
+            std::vector<double> sequentialResult = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper::unifPlus(env, operatorFormula.getOptimalityType(), boundsPair, ma->getExitRates(), ma->getTransitionMatrix(), ma->getMarkovianStates(), psiStates, factory, 1);
+            std::vector<double> parallelResult = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper::unifPlus(env, operatorFormula.getOptimalityType(), boundsPair, ma->getExitRates(), ma->getTransitionMatrix(), ma->getMarkovianStates(), psiStates, factory, 4);
+            EXPECT_EQ(ma->getNumberOfStates(), imcaResult.size());
+            EXPECT_EQ(ma->getNumberOfStates(), sequentialResult.size());
+            EXPECT_EQ(ma->getNumberOfStates(), parallelResult.size());
+
+            // Both techniques are accurate up to the default precision, and the threads only partition the states of a layer.
+            for (auto state : ma->getInitialStates()) {
+                EXPECT_NEAR(imcaResult[state], sequentialResult[state], 1e-4);
+                EXPECT_NEAR(sequentialResult[state], parallelResult[state], 1e-8);
+            }
+        }
+
+        storm::storage::StronglyConnectedComponentDecomposition<double> probabilisticSccs(ma->getTransitionMatrix(), ~ma->getMarkovianStates(), true, false);
+        return probabilisticSccs.size() != 0;
+    }
+
+    TEST(SparseMaCslModelCheckerTest, UnifPlusCyclicProbabilisticStates) {
+        bool cyclic = checkUnifPlusAgainstImca(STORM_TEST_RESOURCES_DIR "/ma/simple.ma", "Pmin=? [ F<=1 s=3 ];Pmax=? [ F<=1 s=3 ];Pmax=? [ F<=3 s=4 ]");
+        EXPECT_TRUE(cyclic);
+    }
+
+    TEST(SparseMaCslModelCheckerTest, UnifPlusCycleFreeProbabilisticStates) {
+        bool cyclic = checkUnifPlusAgainstImca(STORM_TEST_RESOURCES_DIR "/ma/server.ma", "Pmin=? [ F<=1 \"error\" ];Pmax=? [ F<=1 \"error\" ];Pmax=? [ F<=3 \"processB\" ]");
+        EXPECT_FALSE(cyclic);
+    }
+}
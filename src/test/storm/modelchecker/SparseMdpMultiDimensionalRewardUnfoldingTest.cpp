@@ -2,12 +2,14 @@
 #include "storm-config.h"
 
 #include "storm/modelchecker/multiobjective/multiObjectiveModelChecking.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/utility/constants.h"
 #include "storm/api/storm.h"
 #include "storm/environment/Environment.h"
@@ -561,3 +563,36 @@ TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, lower_bounds) {
 
 
 #endif /* STORM_HAVE_HYPRO || defined STORM_HAVE_Z3_OPTIMIZE */
+
+TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_one_dim_walk_epoch_threads) {
+    storm::Environment env;
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/one_dim_walk.nm";
+    std::string constantsDef = "N=10";
+    std::string formulasAsString = "Pmax=? [ F{\"r\"}<=8,{\"l\"}<=4 x=N ] ";
+    formulasAsString += "; \n Pmax=? [ F{\"r\"}<=4,{\"l\"}<=8 x=0 ] ";
+    formulasAsString += "; \n Pmin=? [ F{\"r\"}>=2,{\"l\"}<=6 x=N ] ";
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsDef);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    std::shared_ptr<storm::models::sparse::Mdp<storm::RationalNumber>> exactMdp = storm::api::buildSparseModel<storm::RationalNumber>(program, formulas)->as<storm::models::sparse::Mdp<storm::RationalNumber>>();
+    uint_fast64_t const initState = *mdp->getInitialStates().begin();
+    storm::solver::GeneralMinMaxLinearEquationSolverFactory<double> factory;
+    storm::solver::GeneralMinMaxLinearEquationSolverFactory<storm::RationalNumber> exactFactory;
+
+    for (auto const& formula : formulas) {
+        auto operatorFormula = std::static_pointer_cast<storm::logic::OperatorFormula const>(formula);
+        storm::modelchecker::helper::rewardbounded::MultiDimensionalRewardUnfolding<double, true> sequentialUnfolding(*mdp, operatorFormula);
+        auto sequentialResult = storm::modelchecker::helper::SparseMdpPrctlHelper<double>::computeRewardBoundedValues(env, operatorFormula->getOptimalityType(), sequentialUnfolding, mdp->getInitialStates(), factory, 1);
+        storm::modelchecker::helper::rewardbounded::MultiDimensionalRewardUnfolding<double, true> parallelUnfolding(*mdp, operatorFormula);
+        auto parallelResult = storm::modelchecker::helper::SparseMdpPrctlHelper<double>::computeRewardBoundedValues(env, operatorFormula->getOptimalityType(), parallelUnfolding, mdp->getInitialStates(), factory, 4);
+        EXPECT_NEAR(sequentialResult.at(initState), parallelResult.at(initState), storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+
+        // Exact numbers are not shared between threads, so the epochs are solved sequentially.
+        storm::modelchecker::helper::rewardbounded::MultiDimensionalRewardUnfolding<storm::RationalNumber, true> exactUnfolding(*exactMdp, operatorFormula);
+        auto exactResult = storm::modelchecker::helper::SparseMdpPrctlHelper<storm::RationalNumber>::computeRewardBoundedValues(env, operatorFormula->getOptimalityType(), exactUnfolding, exactMdp->getInitialStates(), exactFactory, 4);
+        EXPECT_NEAR(storm::utility::convertNumber<double>(exactResult.at(initState)), parallelResult.at(initState), storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    }
+}
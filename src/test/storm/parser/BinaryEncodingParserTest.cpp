@@ -0,0 +1,85 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <fstream>
+#include <boost/filesystem.hpp>
+
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/parser/MarkovAutomatonParser.h"
+#include "storm/parser/BinaryEncodingParser.h"
+#include "storm/parser/DirectEncodingParser.h"
+#include "storm/utility/BinaryEncodingExporter.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace {
+    std::shared_ptr<storm::models::sparse::Model<double>> exportAndParse(std::shared_ptr<storm::models::sparse::Model<double>> const& model) {
+        boost::filesystem::path file = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-%%%%-%%%%-%%%%.bin");
+        std::ofstream stream(file.native(), std::ios::out | std::ios::binary);
+        storm::exporter::binaryExportSparseModel(stream, model);
+        stream.close();
+        std::shared_ptr<storm::models::sparse::Model<double>> result = storm::parser::BinaryEncodingParser<double>::parseModel(file.native());
+        boost::filesystem::remove(file);
+        return result;
+    }
+
+    void checkEqual(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual) {
+        ASSERT_EQ(expected.getType(), actual.getType());
+        ASSERT_EQ(expected.getNumberOfStates(), actual.getNumberOfStates());
+        EXPECT_EQ(expected.getTransitionMatrix(), actual.getTransitionMatrix());
+        EXPECT_EQ(expected.getStateLabeling(), actual.getStateLabeling());
+        ASSERT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels());
+        for (auto const& rewardModel : expected.getRewardModels()) {
+            ASSERT_TRUE(actual.hasRewardModel(rewardModel.first));
+            auto const& actualRewardModel = actual.getRewardModel(rewardModel.first);
+            ASSERT_EQ(rewardModel.second.hasStateRewards(), actualRewardModel.hasStateRewards());
+            ASSERT_EQ(rewardModel.second.hasStateActionRewards(), actualRewardModel.hasStateActionRewards());
+            ASSERT_EQ(rewardModel.second.hasTransitionRewards(), actualRewardModel.hasTransitionRewards());
+            if (rewardModel.second.hasStateRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateRewardVector(), actualRewardModel.getStateRewardVector());
+            }
+            if (rewardModel.second.hasStateActionRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), actualRewardModel.getStateActionRewardVector());
+            }
+            if (rewardModel.second.hasTransitionRewards()) {
+                EXPECT_EQ(rewardModel.second.getTransitionRewardMatrix(), actualRewardModel.getTransitionRewardMatrix());
+            }
+        }
+    }
+}
+
+TEST(BinaryEncodingParserTest, CtmcRoundTrip) {
+    std::shared_ptr<storm::models::sparse::Model<double>> modelPtr = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn");
+    std::shared_ptr<storm::models::sparse::Model<double>> parsedModelPtr = exportAndParse(modelPtr);
+
+    checkEqual(*modelPtr, *parsedModelPtr);
+    EXPECT_EQ(modelPtr->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector(), parsedModelPtr->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector());
+    ASSERT_EQ(64ul, parsedModelPtr->getStates("premium").getNumberOfSetBits());
+}
+
+TEST(BinaryEncodingParserTest, MdpRoundTrip) {
+    std::shared_ptr<storm::models::sparse::Model<double>> modelPtr = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    std::shared_ptr<storm::models::sparse::Model<double>> parsedModelPtr = exportAndParse(modelPtr);
+
+    checkEqual(*modelPtr, *parsedModelPtr);
+    ASSERT_EQ(254ul, parsedModelPtr->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
+    ASSERT_EQ(5ul, parsedModelPtr->getStates("six").getNumberOfSetBits());
+}
+
+TEST(BinaryEncodingParserTest, MarkovAutomatonRoundTrip) {
+    std::shared_ptr<storm::models::sparse::Model<double>> modelPtr = std::make_shared<storm::models::sparse::MarkovAutomaton<double>>(storm::parser::MarkovAutomatonParser<>::parseMarkovAutomaton(STORM_TEST_RESOURCES_DIR "/tra/ma_general.tra", STORM_TEST_RESOURCES_DIR "/lab/ma_general.lab", STORM_TEST_RESOURCES_DIR "/rew/ma_general.state.rew"));
+    std::shared_ptr<storm::models::sparse::Model<double>> parsedModelPtr = exportAndParse(modelPtr);
+
+    checkEqual(*modelPtr, *parsedModelPtr);
+    auto ma = modelPtr->as<storm::models::sparse::MarkovAutomaton<double>>();
+    auto parsedMa = parsedModelPtr->as<storm::models::sparse::MarkovAutomaton<double>>();
+    EXPECT_EQ(ma->getExitRates(), parsedMa->getExitRates());
+    EXPECT_EQ(ma->getMarkovianStates(), parsedMa->getMarkovianStates());
+    EXPECT_EQ(ma->isClosed(), parsedMa->isClosed());
+}
+
+TEST(BinaryEncodingParserTest, WrongFormat) {
+    EXPECT_THROW(storm::parser::BinaryEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn"), storm::exceptions::WrongFormatException);
+}
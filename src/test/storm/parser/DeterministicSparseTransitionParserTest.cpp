@@ -218,3 +218,30 @@ TEST(DeterministicSparseTransitionParserTest, RewardForNonExistentTransition) {
     // There is a reward for a transition that does not exist in the transition matrix.
     ASSERT_THROW(storm::parser::DeterministicSparseTransitionParser<>::parseDeterministicTransitionRewards(STORM_TEST_RESOURCES_DIR "/rew/dtmc_rewardForNonExTrans.trans.rew", transitionMatrix), storm::exceptions::WrongFormatException);
 }
+
+TEST(DeterministicSparseTransitionParserTest, ParallelParsing) {
+    // Parsing with several threads must yield exactly the same matrix as the sequential parser.
+    for (std::string const& file : {STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/tra/dtmc_general.tra", STORM_TEST_RESOURCES_DIR "/tra/dtmc_deadlock.tra", STORM_TEST_RESOURCES_DIR "/tra/dtmc_mixedTransitionOrder.tra", STORM_TEST_RESOURCES_DIR "/tra/dtmc_trailingStates.tra"}) {
+        storm::storage::SparseMatrix<double> sequentialMatrix = storm::parser::DeterministicSparseTransitionParser<>::parseDeterministicTransitions(file, 1);
+        // The chunks depend on the number of threads, so the result must not.
+        for (uint_fast64_t numberOfThreads : {2, 3, 4, 8}) {
+            storm::storage::SparseMatrix<double> parallelMatrix = storm::parser::DeterministicSparseTransitionParser<>::parseDeterministicTransitions(file, numberOfThreads);
+            EXPECT_EQ(sequentialMatrix, parallelMatrix) << file << " with " << numberOfThreads << " threads";
+        }
+    }
+
+    // States after the last given row keep empty rows, skipped rows get a self-loop.
+    storm::storage::SparseMatrix<double> trailingMatrix = storm::parser::DeterministicSparseTransitionParser<>::parseDeterministicTransitions(STORM_TEST_RESOURCES_DIR "/tra/dtmc_trailingStates.tra", 4);
+    ASSERT_EQ(8ul, trailingMatrix.getRowCount());
+    ASSERT_EQ(1ul, trailingMatrix.getRow(1).getNumberOfEntries());
+    EXPECT_EQ(1ul, trailingMatrix.getRow(1).begin()->getColumn());
+    for (uint_fast64_t row = 4; row < 8; ++row) {
+        EXPECT_EQ(0ul, trailingMatrix.getRow(row).getNumberOfEntries());
+    }
+
+    ASSERT_THROW(storm::parser::DeterministicSparseTransitionParser<>::parseDeterministicTransitions(STORM_TEST_RESOURCES_DIR "/tra/dtmc_mixedStateOrder.tra", 4), storm::exceptions::InvalidArgumentException);
+    ASSERT_THROW(storm::parser::DeterministicSparseTransitionParser<>::parseDeterministicTransitions(STORM_TEST_RESOURCES_DIR "/tra/dtmc_doubledLines.tra", 4), storm::exceptions::InvalidArgumentException);
+
+    std::unique_ptr<storm::settings::SettingMemento> dontFixDeadlocks = storm::settings::mutableCoreSettings().overrideDontFixDeadlocksSet(true);
+    ASSERT_THROW(storm::parser::DeterministicSparseTransitionParser<>::parseDeterministicTransitions(STORM_TEST_RESOURCES_DIR "/tra/dtmc_deadlock.tra", 4), storm::exceptions::WrongFormatException);
+}
@@ -36,3 +36,31 @@ TEST(DirectEncodingParserTest, MdpParsing) {
     ASSERT_EQ(2ul, modelPtr->getStates("eleven").getNumberOfSetBits());
 }
 
+
+TEST(DirectEncodingParserTest, ParallelParsing) {
+    // Parsing with several threads must yield exactly the same model as the sequential parser.
+    for (std::string const& file : {STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn", STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn"}) {
+        std::shared_ptr<storm::models::sparse::Model<double>> sequentialModelPtr = storm::parser::DirectEncodingParser<double>::parseModel(file, 1);
+        std::shared_ptr<storm::models::sparse::Model<double>> parallelModelPtr = storm::parser::DirectEncodingParser<double>::parseModel(file, 4);
+
+        ASSERT_EQ(sequentialModelPtr->getType(), parallelModelPtr->getType());
+        EXPECT_EQ(sequentialModelPtr->getTransitionMatrix(), parallelModelPtr->getTransitionMatrix());
+        EXPECT_EQ(sequentialModelPtr->getStateLabeling(), parallelModelPtr->getStateLabeling());
+        ASSERT_EQ(sequentialModelPtr->getNumberOfRewardModels(), parallelModelPtr->getNumberOfRewardModels());
+        for (auto const& rewardModel : sequentialModelPtr->getRewardModels()) {
+            ASSERT_TRUE(parallelModelPtr->hasRewardModel(rewardModel.first));
+            EXPECT_EQ(rewardModel.second.getStateRewardVector(), parallelModelPtr->getRewardModel(rewardModel.first).getStateRewardVector());
+        }
+    }
+}
+
+TEST(DirectEncodingParserTest, MdpRowGroups) {
+    std::shared_ptr<storm::models::sparse::Model<double>> modelPtr = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+
+    // Each of the first states has two actions, so every row group starts with the first action of its state.
+    std::vector<uint_fast64_t> const& rowGroupIndices = modelPtr->getTransitionMatrix().getRowGroupIndices();
+    ASSERT_EQ(0ul, rowGroupIndices[0]);
+    ASSERT_EQ(2ul, rowGroupIndices[1]);
+    ASSERT_EQ(4ul, rowGroupIndices[2]);
+    ASSERT_EQ(254ul, rowGroupIndices.back());
+}
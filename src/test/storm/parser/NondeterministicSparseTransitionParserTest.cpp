@@ -269,3 +269,17 @@ TEST(NondeterministicSparseTransitionParserTest, RewardForNonExistentTransition)
 	// There is a reward for a transition that does not exist in the transition matrix.
 	ASSERT_THROW(storm::parser::NondeterministicSparseTransitionParser<>::parseNondeterministicTransitionRewards(STORM_TEST_RESOURCES_DIR "/rew/mdp_rewardForNonExTrans.trans.rew", transitionResult), storm::exceptions::WrongFormatException);
 }
+
+TEST(NondeterministicSparseTransitionParserTest, ParallelParsing) {
+	// Parsing with several threads must yield exactly the same matrix as the sequential parser.
+	for (std::string const& file : {STORM_TEST_RESOURCES_DIR "/tra/leader4.tra", STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/tra/mdp_general.tra", STORM_TEST_RESOURCES_DIR "/tra/mdp_deadlock.tra", STORM_TEST_RESOURCES_DIR "/tra/mdp_mixedTransitionOrder.tra"}) {
+		storm::storage::SparseMatrix<double> sequentialMatrix = storm::parser::NondeterministicSparseTransitionParser<>::parseNondeterministicTransitions(file, 1);
+		storm::storage::SparseMatrix<double> parallelMatrix = storm::parser::NondeterministicSparseTransitionParser<>::parseNondeterministicTransitions(file, 4);
+		EXPECT_EQ(sequentialMatrix, parallelMatrix) << file;
+	}
+
+	ASSERT_THROW(storm::parser::NondeterministicSparseTransitionParser<>::parseNondeterministicTransitions(STORM_TEST_RESOURCES_DIR "/tra/mdp_mixedStateOrder.tra", 4), storm::exceptions::InvalidArgumentException);
+
+	std::unique_ptr<storm::settings::SettingMemento> dontFixDeadlocks = storm::settings::mutableCoreSettings().overrideDontFixDeadlocksSet(true);
+	ASSERT_THROW(storm::parser::NondeterministicSparseTransitionParser<>::parseNondeterministicTransitions(STORM_TEST_RESOURCES_DIR "/tra/mdp_deadlock.tra", 4), storm::exceptions::WrongFormatException);
+}
@@ -34,6 +34,43 @@ namespace {
             return env;
         }
     };
+    class DoubleParallelViEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.solver().minMax().setNumberOfThreads(4);
+            return env;
+        }
+    };
+    class DoubleParallelSoundViEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().setForceSoundness(true);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+            env.solver().minMax().setNumberOfThreads(4);
+            return env;
+        }
+    };
+    class DoubleMixedPrecisionViEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.solver().minMax().setValueIterationArithmetic(storm::solver::ValueIterationArithmetic::Mixed);
+            return env;
+        }
+    };
     class DoubleTopologicalViEnvironment {
     public:
         typedef double ValueType;
@@ -45,6 +82,18 @@ namespace {
             return env;
         }
     };
+    class DoubleParallelTopologicalViEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.solver().minMax().setNumberOfThreads(4);
+            return env;
+        }
+    };
     class DoublePIEnvironment {
     public:
         typedef double ValueType;
@@ -95,7 +144,11 @@ namespace {
     typedef ::testing::Types<
             DoubleViEnvironment,
             DoubleSoundViEnvironment,
+            DoubleParallelViEnvironment,
+            DoubleParallelSoundViEnvironment,
+            DoubleMixedPrecisionViEnvironment,
             DoubleTopologicalViEnvironment,
+            DoubleParallelTopologicalViEnvironment,
             DoublePIEnvironment,
             RationalPIEnvironment,
             RationalRationalSearchEnvironment
@@ -175,7 +228,36 @@ namespace {
         EXPECT_NEAR(x[0], this->parseNumber("0.923808265834023387639"), this->precision());
     }
     
+    TEST(MinMaxLinearEquationSolverTest, SinglePrecisionEndComponent) {
+        // States 0 and 1 form an end component that can be left with the values 0.3 and 0.6, respectively. As the
+        // solution is not unique, the iteration has to start from the lower bound and must not use single precision.
+        storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, 1.0));
+        ASSERT_NO_THROW(builder.newRowGroup(2));
+        ASSERT_NO_THROW(builder.addNextValue(2, 0, 1.0));
+        
+        storm::storage::SparseMatrix<double> A;
+        ASSERT_NO_THROW(A = builder.build(4, 2, 2));
+        std::vector<double> b = {0.0, 0.3, 0.0, 0.6};
+        
+        for (auto arithmetic : {storm::solver::ValueIterationArithmetic::Mixed, storm::solver::ValueIterationArithmetic::Single}) {
+            storm::Environment env = DoubleMixedPrecisionViEnvironment::createEnvironment();
+            env.solver().minMax().setValueIterationArithmetic(arithmetic);
+            
+            auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>();
+            auto solver = factory.create(env, A);
+            solver->setHasUniqueSolution(false);
+            solver->setBounds(0.0, 1.0);
+            storm::solver::MinMaxLinearEquationSolverRequirements req = solver->getRequirements(env, storm::OptimizationDirection::Maximize);
+            req.clearBounds();
+            ASSERT_TRUE(req.empty());
+            
+            // Values above the solution are a fixed point of the end component, so they must not be used as a start.
+            std::vector<double> x = {1.0, 1.0};
+            ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b));
+            EXPECT_NEAR(0.6, x[0], 1e-6);
+            EXPECT_NEAR(0.6, x[1], 1e-6);
+        }
+    }
 }
-
-
-
@@ -0,0 +1,65 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
+#include "storm/storage/FlexibleSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+
+namespace {
+    // Computes the probability to win the gambler's ruin game with the given number of positions from the given
+    // position by eliminating all other positions first. The states correspond to the positions 1, ..., n - 1.
+    template<typename ValueType>
+    ValueType computeWinningProbability(uint64_t numberOfPositions, uint64_t initialPosition, uint64_t numberOfThreads) {
+        uint64_t numberOfStates = numberOfPositions - 1;
+        ValueType half = storm::utility::convertNumber<ValueType>(0.5);
+        storm::storage::SparseMatrixBuilder<ValueType> matrixBuilder(numberOfStates, numberOfStates);
+        std::vector<ValueType> values(numberOfStates, storm::utility::zero<ValueType>());
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (state > 0) {
+                matrixBuilder.addNextValue(state, state - 1, half);
+            }
+            if (state + 1 < numberOfStates) {
+                matrixBuilder.addNextValue(state, state + 1, half);
+            } else {
+                values[state] = half;
+            }
+        }
+        storm::storage::SparseMatrix<ValueType> matrix = matrixBuilder.build();
+        storm::storage::FlexibleSparseMatrix<ValueType> flexibleMatrix(matrix);
+        storm::storage::FlexibleSparseMatrix<ValueType> flexibleBackwardTransitions(matrix.transpose());
+
+        uint64_t initialState = initialPosition - 1;
+        std::vector<storm::storage::sparse::state_type> statesToEliminate;
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (state != initialState) {
+                statesToEliminate.push_back(state);
+            }
+        }
+
+        storm::solver::stateelimination::PrioritizedStateEliminator<ValueType> eliminator(flexibleMatrix, flexibleBackwardTransitions, statesToEliminate, values);
+        eliminator.setNumberOfThreads(numberOfThreads);
+        eliminator.eliminateAll(true);
+        eliminator.eliminateState(initialState, false);
+        return values[initialState];
+    }
+}
+
+TEST(StateEliminatorTest, GamblersRuin) {
+    EXPECT_NEAR(7.0 / 20.0, computeWinningProbability<double>(20, 7, 1), 1e-10);
+    EXPECT_NEAR(41.0 / 100.0, computeWinningProbability<double>(100, 41, 1), 1e-10);
+}
+
+TEST(StateEliminatorTest, GamblersRuinParallel) {
+    EXPECT_NEAR(7.0 / 20.0, computeWinningProbability<double>(20, 7, 4), 1e-10);
+    EXPECT_NEAR(41.0 / 100.0, computeWinningProbability<double>(100, 41, 4), 1e-10);
+    EXPECT_NEAR(41.0 / 100.0, computeWinningProbability<double>(100, 41, 0), 1e-10);
+}
+
+TEST(StateEliminatorTest, GamblersRuinParallelRationalFunction) {
+    // Unless carl was built thread-safe, the states are eliminated by a single thread.
+    storm::RationalNumber expected = storm::utility::convertNumber<storm::RationalNumber>(std::string("41/100"));
+    EXPECT_EQ(expected, storm::utility::convertNumber<storm::RationalNumber>(computeWinningProbability<storm::RationalFunction>(100, 41, 1)));
+    EXPECT_EQ(expected, storm::utility::convertNumber<storm::RationalNumber>(computeWinningProbability<storm::RationalFunction>(100, 41, 4)));
+}
@@ -0,0 +1,96 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/CompactSparseMatrix.h"
+#include "storm/utility/simd.h"
+
+namespace {
+    storm::storage::SparseMatrix<double> createMatrix() {
+        // Rows have up to 11 entries, so the vectorized kernels have to process both full registers and remainders.
+        // The second row group is empty.
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder(6, 12, 0, true, true, 4);
+        matrixBuilder.newRowGroup(0);
+        for (uint64_t column = 0; column < 11; ++column) {
+            matrixBuilder.addNextValue(0, column, 0.05 * (column + 1));
+        }
+        matrixBuilder.addNextValue(1, 3, 0.5);
+        matrixBuilder.addNextValue(1, 11, 0.5);
+        matrixBuilder.newRowGroup(2);
+        matrixBuilder.newRowGroup(2);
+        for (uint64_t column = 0; column < 12; column += 2) {
+            matrixBuilder.addNextValue(2, column, 0.1);
+        }
+        matrixBuilder.addNextValue(3, 1, 0.25);
+        matrixBuilder.addNextValue(3, 5, 0.25);
+        matrixBuilder.addNextValue(3, 9, 0.25);
+        matrixBuilder.newRowGroup(4);
+        for (uint64_t column = 4; column < 9; ++column) {
+            matrixBuilder.addNextValue(4, column, 0.2);
+        }
+        return matrixBuilder.build();
+    }
+}
+
+TEST(CompactSparseMatrix, Creation) {
+    storm::storage::SparseMatrix<double> matrix = createMatrix();
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix);
+    EXPECT_EQ(matrix.getRowCount(), compactMatrix.getRowCount());
+    EXPECT_EQ(matrix.getColumnCount(), compactMatrix.getColumnCount());
+    EXPECT_EQ(matrix.getEntryCount(), compactMatrix.getEntryCount());
+    EXPECT_TRUE(compactMatrix.hasCompactColumnIndices());
+    EXPECT_TRUE(compactMatrix.hasCompactRowIndications());
+    EXPECT_EQ(storm::utility::simd::SimdKernel::None, compactMatrix.getKernel());
+}
+
+TEST(CompactSparseMatrix, MultiplyWithVector) {
+    storm::storage::SparseMatrix<double> matrix = createMatrix();
+    std::vector<double> x = {1.0, 0.5, 0.25, 0.125, 1.0, 0.5, 0.25, 0.125, 1.0, 0.5, 0.25, 0.125};
+    std::vector<double> b = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6};
+    std::vector<double> expected(matrix.getRowCount());
+    matrix.multiplyWithVector(x, expected, &b);
+    std::vector<double> expectedWithoutSummand(matrix.getRowCount());
+    matrix.multiplyWithVector(x, expectedWithoutSummand);
+    
+    for (auto kernel : {storm::utility::simd::SimdKernel::None, storm::utility::simd::SimdKernel::Avx2, storm::utility::simd::SimdKernel::Avx512}) {
+        if (!storm::utility::simd::isSupported(kernel)) {
+            continue;
+        }
+        storm::storage::CompactSparseMatrix<double> compactMatrix(matrix, kernel);
+        std::vector<double> result(matrix.getRowCount());
+        compactMatrix.multiplyWithVector(x, result, &b);
+        for (uint64_t row = 0; row < result.size(); ++row) {
+            EXPECT_NEAR(expected[row], result[row], 1e-12) << "Row " << row << " with the " << kernel << " kernel.";
+        }
+        compactMatrix.multiplyWithVector(x, result);
+        for (uint64_t row = 0; row < result.size(); ++row) {
+            EXPECT_NEAR(expectedWithoutSummand[row], result[row], 1e-12) << "Row " << row << " with the " << kernel << " kernel.";
+        }
+    }
+}
+
+TEST(CompactSparseMatrix, MultiplyAndReduce) {
+    storm::storage::SparseMatrix<double> matrix = createMatrix();
+    std::vector<double> x = {1.0, 0.5, 0.25, 0.125, 1.0, 0.5, 0.25, 0.125, 1.0, 0.5, 0.25, 0.125};
+    std::vector<double> b = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6};
+    
+    for (auto dir : {storm::solver::OptimizationDirection::Minimize, storm::solver::OptimizationDirection::Maximize}) {
+        std::vector<double> expected(matrix.getRowGroupCount());
+        std::vector<uint64_t> expectedChoices(matrix.getRowGroupCount());
+        matrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, &b, expected, &expectedChoices);
+        
+        for (auto kernel : {storm::utility::simd::SimdKernel::None, storm::utility::simd::SimdKernel::Avx2, storm::utility::simd::SimdKernel::Avx512}) {
+            if (!storm::utility::simd::isSupported(kernel)) {
+                continue;
+            }
+            storm::storage::CompactSparseMatrix<double> compactMatrix(matrix, kernel);
+            std::vector<double> result(matrix.getRowGroupCount());
+            std::vector<uint64_t> choices(matrix.getRowGroupCount());
+            compactMatrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, &b, result, &choices);
+            for (uint64_t group = 0; group < result.size(); ++group) {
+                EXPECT_NEAR(expected[group], result[group], 1e-12) << "Row group " << group << " with the " << kernel << " kernel.";
+                EXPECT_EQ(expectedChoices[group], choices[group]) << "Row group " << group << " with the " << kernel << " kernel.";
+            }
+        }
+    }
+}
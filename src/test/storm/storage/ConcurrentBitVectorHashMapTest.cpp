@@ -0,0 +1,109 @@
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+TEST(ConcurrentBitVectorHashMapTest, FindOrAdd) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(64, 3);
+    
+    storm::storage::BitVector first(64);
+    first.set(4);
+    first.set(47);
+    EXPECT_EQ(std::make_pair(0ul, true), map.findOrAdd(first));
+    
+    storm::storage::BitVector second(64);
+    second.set(8);
+    second.set(18);
+    EXPECT_EQ(std::make_pair(1ul, true), map.findOrAdd(second));
+    
+    EXPECT_EQ(std::make_pair(0ul, false), map.findOrAdd(first));
+    EXPECT_EQ(std::make_pair(1ul, false), map.findOrAdd(second));
+    
+    storm::storage::BitVector third(64);
+    third.set(10);
+    third.set(63);
+    EXPECT_FALSE(map.contains(third));
+    EXPECT_EQ(std::make_pair(2ul, true), map.findOrAdd(third));
+    EXPECT_TRUE(map.contains(third));
+    EXPECT_EQ(2ul, map.getValue(third));
+    
+    EXPECT_EQ(3ul, map.size());
+    EXPECT_EQ(first, map.getKey(0));
+    EXPECT_EQ(second, map.getKey(1));
+    EXPECT_EQ(third, map.getKey(2));
+}
+
+TEST(ConcurrentBitVectorHashMapTest, Grow) {
+    storm::storage::ConcurrentBitVectorHashMap<uint32_t> map(128, 10);
+    uint64_t initialCapacity = map.capacity();
+    
+    for (uint64_t value = 0; value < 10000; ++value) {
+        storm::storage::BitVector key(128);
+        key.setFromInt(0, 64, value);
+        key.setFromInt(64, 64, value * 7);
+        EXPECT_EQ(std::make_pair(static_cast<uint32_t>(value), true), map.findOrAdd(key));
+    }
+    EXPECT_LT(initialCapacity, map.capacity());
+    EXPECT_EQ(10000ul, map.size());
+    
+    // All keys must be retained with their indices after growing.
+    uint64_t index = 0;
+    for (auto const& keyIndexPair : map) {
+        EXPECT_EQ(index, keyIndexPair.first.getAsInt(0, 64));
+        EXPECT_EQ(index, keyIndexPair.second);
+        EXPECT_EQ(std::make_pair(static_cast<uint32_t>(index), false), map.findOrAdd(keyIndexPair.first));
+        ++index;
+    }
+    EXPECT_EQ(10000ul, index);
+}
+
+TEST(ConcurrentBitVectorHashMapTest, Concurrent) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(64, 16);
+    
+    // All threads insert the same keys in different orders (since the number of keys is a power of two, multiplying
+    // with an odd number permutes them).
+    uint64_t const numberOfThreads = 4;
+    uint64_t const numberOfKeys = 1ull << 14;
+    std::vector<std::vector<uint64_t>> indices(numberOfThreads, std::vector<uint64_t>(numberOfKeys));
+    std::vector<uint64_t> insertions(numberOfThreads, 0);
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threads.emplace_back([&map, &indices, &insertions, thread, numberOfKeys] () {
+            for (uint64_t step = 0; step < numberOfKeys; ++step) {
+                uint64_t value = (step * (2 * thread + 1)) % numberOfKeys;
+                storm::storage::BitVector key(64);
+                key.setFromInt(0, 64, value);
+                auto indexFlagPair = map.findOrAdd(key);
+                indices[thread][value] = indexFlagPair.first;
+                if (indexFlagPair.second) {
+                    ++insertions[thread];
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    // Every key must have been inserted exactly once and all threads must agree on its index.
+    EXPECT_EQ(numberOfKeys, map.size());
+    uint64_t totalInsertions = 0;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        totalInsertions += insertions[thread];
+        EXPECT_EQ(indices[0], indices[thread]);
+    }
+    EXPECT_EQ(numberOfKeys, totalInsertions);
+    
+    storm::storage::BitVector seenIndices(numberOfKeys);
+    for (uint64_t value = 0; value < numberOfKeys; ++value) {
+        uint64_t index = indices[0][value];
+        ASSERT_LT(index, numberOfKeys);
+        EXPECT_FALSE(seenIndices.get(index));
+        seenIndices.set(index);
+        EXPECT_EQ(value, map.getKey(index).getAsInt(0, 64));
+    }
+}
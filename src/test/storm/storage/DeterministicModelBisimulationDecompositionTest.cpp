@@ -124,3 +124,45 @@ TEST(DeterministicModelBisimulationDecomposition, Crowds) {
     EXPECT_EQ(65ul, result->getNumberOfStates());
     EXPECT_EQ(105ul, result->getNumberOfTransitions());
 }
+
+TEST(DeterministicModelBisimulationDecomposition, SignatureBasedRefinement) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "");
+
+    ASSERT_EQ(abstractModel->getType(), storm::models::ModelType::Dtmc);
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]");
+
+    std::vector<typename storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>>::Options> optionsList;
+    optionsList.emplace_back();
+    optionsList.emplace_back(*dtmc, *formula);
+    std::vector<std::pair<uint64_t, uint64_t>> expectedSizes = {{334ul, 546ul}, {64ul, 104ul}};
+
+    for (uint64_t index = 0; index < optionsList.size(); ++index) {
+        auto options = optionsList[index];
+        storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>> splitterBisim(*dtmc, options);
+        ASSERT_NO_THROW(splitterBisim.computeBisimulationDecomposition());
+
+        options.refinementMethod = storm::storage::SparseRefinementMethod::Signature;
+        options.numberOfThreads = 4;
+        storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>> signatureBisim(*dtmc, options);
+        ASSERT_NO_THROW(signatureBisim.computeBisimulationDecomposition());
+        std::shared_ptr<storm::models::sparse::Model<double>> result;
+        ASSERT_NO_THROW(result = signatureBisim.getQuotient());
+
+        EXPECT_EQ(storm::models::ModelType::Dtmc, result->getType());
+        EXPECT_EQ(expectedSizes[index].first, result->getNumberOfStates());
+        EXPECT_EQ(expectedSizes[index].second, result->getNumberOfTransitions());
+
+        // Both methods need to find the same blocks (possibly in a different order).
+        ASSERT_EQ(splitterBisim.size(), signatureBisim.size());
+        std::set<storm::storage::FlatSetStateContainer> splitterBlocks;
+        for (auto const& block : splitterBisim) {
+            splitterBlocks.insert(block.getStates());
+        }
+        for (auto const& block : signatureBisim) {
+            EXPECT_TRUE(splitterBlocks.find(block.getStates()) != splitterBlocks.end());
+        }
+    }
+}
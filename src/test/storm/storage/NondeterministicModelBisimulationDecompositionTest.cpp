@@ -56,3 +56,47 @@ TEST(NondeterministicModelBisimulationDecomposition, TwoDice) {
     EXPECT_EQ(26ul, result->getNumberOfTransitions());
     EXPECT_EQ(14ul, result->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
 }
+
+TEST(NondeterministicModelBisimulationDecomposition, SignatureBasedRefinement) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+
+    ASSERT_EQ(model->getType(), storm::models::ModelType::Mdp);
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = model->as<storm::models::sparse::Mdp<double>>();
+
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("Pmin=? [F \"two\"]");
+
+    std::vector<typename storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<double>>::Options> optionsList;
+    optionsList.emplace_back();
+    optionsList.emplace_back(*mdp, *formula);
+    std::vector<std::tuple<uint64_t, uint64_t, uint64_t>> expectedSizes = {std::make_tuple(77ul, 183ul, 97ul), std::make_tuple(11ul, 26ul, 14ul)};
+
+    for (uint64_t index = 0; index < optionsList.size(); ++index) {
+        auto options = optionsList[index];
+        storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<double>> splitterBisim(*mdp, options);
+        ASSERT_NO_THROW(splitterBisim.computeBisimulationDecomposition());
+
+        options.refinementMethod = storm::storage::SparseRefinementMethod::Signature;
+        options.numberOfThreads = 4;
+        storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<double>> signatureBisim(*mdp, options);
+        ASSERT_NO_THROW(signatureBisim.computeBisimulationDecomposition());
+        std::shared_ptr<storm::models::sparse::Model<double>> result;
+        ASSERT_NO_THROW(result = signatureBisim.getQuotient());
+
+        EXPECT_EQ(storm::models::ModelType::Mdp, result->getType());
+        EXPECT_EQ(std::get<0>(expectedSizes[index]), result->getNumberOfStates());
+        EXPECT_EQ(std::get<1>(expectedSizes[index]), result->getNumberOfTransitions());
+        EXPECT_EQ(std::get<2>(expectedSizes[index]), result->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
+
+        // Both methods need to find the same blocks (possibly in a different order).
+        ASSERT_EQ(splitterBisim.size(), signatureBisim.size());
+        std::set<storm::storage::FlatSetStateContainer> splitterBlocks;
+        for (auto const& block : splitterBisim) {
+            splitterBlocks.insert(block.getStates());
+        }
+        for (auto const& block : signatureBisim) {
+            EXPECT_TRUE(splitterBlocks.find(block.getStates()) != splitterBlocks.end());
+        }
+    }
+}
@@ -35,6 +35,53 @@ TEST(StronglyConnectedComponentDecomposition, SmallSystemFromMatrix) {
 	ASSERT_EQ(1ul, sccDecomposition.size());
 }
 
+TEST(StronglyConnectedComponentDecomposition, Parallel) {
+	// A chain of 5000 cycles of length two, where each cycle can move on to the next one.
+	uint_fast64_t numberOfCycles = 5000;
+	storm::storage::SparseMatrixBuilder<double> matrixBuilder(2 * numberOfCycles, 2 * numberOfCycles);
+	for (uint_fast64_t cycle = 0; cycle < numberOfCycles; ++cycle) {
+		uint_fast64_t state = 2 * cycle;
+		ASSERT_NO_THROW(matrixBuilder.addNextValue(state, state + 1, 1.0));
+		ASSERT_NO_THROW(matrixBuilder.addNextValue(state + 1, state, 0.5));
+		ASSERT_NO_THROW(matrixBuilder.addNextValue(state + 1, cycle + 1 < numberOfCycles ? state + 2 : state + 1, 0.5));
+	}
+	storm::storage::SparseMatrix<double> matrix;
+	ASSERT_NO_THROW(matrix = matrixBuilder.build());
+	storm::storage::BitVector allBits(2 * numberOfCycles, true);
+
+	storm::storage::StronglyConnectedComponentDecomposition<double> sequentialDecomposition(matrix, allBits, false, false);
+	storm::storage::StronglyConnectedComponentDecomposition<double> parallelDecomposition(matrix, allBits, false, false, 4);
+	ASSERT_EQ(numberOfCycles, parallelDecomposition.size());
+	for (uint_fast64_t sccIndex = 0; sccIndex < numberOfCycles; ++sccIndex) {
+		// Both decompositions list each SCC after all SCCs reachable from it.
+		EXPECT_TRUE(sequentialDecomposition[sccIndex] == parallelDecomposition[sccIndex]);
+	}
+
+	storm::storage::BitVector allBitsSmall(6, true);
+	storm::storage::SparseMatrixBuilder<double> smallMatrixBuilder(6, 6);
+	ASSERT_NO_THROW(smallMatrixBuilder.addNextValue(0, 0, 0.3));
+	ASSERT_NO_THROW(smallMatrixBuilder.addNextValue(0, 5, 0.7));
+	ASSERT_NO_THROW(smallMatrixBuilder.addNextValue(1, 2, 1.0));
+	ASSERT_NO_THROW(smallMatrixBuilder.addNextValue(2, 1, 0.4));
+	ASSERT_NO_THROW(smallMatrixBuilder.addNextValue(2, 2, 0.3));
+	ASSERT_NO_THROW(smallMatrixBuilder.addNextValue(2, 3, 0.3));
+	ASSERT_NO_THROW(smallMatrixBuilder.addNextValue(3, 4, 1.0));
+	ASSERT_NO_THROW(smallMatrixBuilder.addNextValue(4, 3, 0.5));
+	ASSERT_NO_THROW(smallMatrixBuilder.addNextValue(4, 4, 0.5));
+	ASSERT_NO_THROW(smallMatrixBuilder.addNextValue(5, 1, 1.0));
+	ASSERT_NO_THROW(matrix = smallMatrixBuilder.build());
+
+	storm::storage::StronglyConnectedComponentDecomposition<double> sccDecomposition;
+	ASSERT_NO_THROW(sccDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, allBitsSmall, false, false, 4));
+	ASSERT_EQ(4ul, sccDecomposition.size());
+
+	ASSERT_NO_THROW(sccDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, allBitsSmall, true, false, 4));
+	ASSERT_EQ(3ul, sccDecomposition.size());
+
+	ASSERT_NO_THROW(sccDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, allBitsSmall, true, true, 4));
+	ASSERT_EQ(1ul, sccDecomposition.size());
+}
+
 TEST(StronglyConnectedComponentDecomposition, FullSystem1) {
 	std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/tiny1.tra", STORM_TEST_RESOURCES_DIR "/lab/tiny1.lab", "", "");
 
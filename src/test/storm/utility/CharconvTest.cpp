@@ -0,0 +1,31 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+#include "storm/utility/charconv.h"
+
+#include <cstdlib>
+#include <string>
+
+namespace {
+    std::string writeShortest(double value) {
+        char digits[storm::utility::charconv::maxDoubleLength];
+        return std::string(digits, storm::utility::charconv::writeShortest(digits, value));
+    }
+}
+
+TEST(CharconvTest, ShortestRepresentation) {
+    EXPECT_EQ("0.1", writeShortest(0.1));
+    EXPECT_EQ("1", writeShortest(1.0));
+    EXPECT_EQ("-2.5", writeShortest(-2.5));
+    EXPECT_EQ("0.30000000000000004", writeShortest(0.1 + 0.2));
+    // Printing 15 significant digits would already read back as this value, but is not the shortest representation.
+    EXPECT_EQ("5e-324", writeShortest(5e-324));
+}
+
+TEST(CharconvTest, RoundTrip) {
+    double value = 1.0;
+    for (uint64_t i = 0; i < 1000; ++i) {
+        value = value * 1.1 + 1.0 / 3.0;
+        EXPECT_EQ(value, std::strtod(writeShortest(value).c_str(), nullptr));
+        EXPECT_EQ(1.0 / value, std::strtod(writeShortest(1.0 / value).c_str(), nullptr));
+    }
+}
@@ -0,0 +1,73 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <fstream>
+#include <sstream>
+#include <boost/filesystem.hpp>
+
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/parser/DirectEncodingParser.h"
+#include "storm/utility/DirectEncodingExporter.h"
+
+namespace {
+    std::shared_ptr<storm::models::sparse::Model<double>> parseExport(std::string const& exportedModel) {
+        boost::filesystem::path file = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-%%%%-%%%%-%%%%.drn");
+        std::ofstream stream(file.native());
+        stream << exportedModel;
+        stream.close();
+        std::shared_ptr<storm::models::sparse::Model<double>> result = storm::parser::DirectEncodingParser<double>::parseModel(file.native());
+        boost::filesystem::remove(file);
+        return result;
+    }
+}
+
+TEST(DirectEncodingExporterTest, MdpRoundTrip) {
+    std::shared_ptr<storm::models::sparse::Model<double>> modelPtr = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+
+    std::stringstream sequentialStream;
+    storm::exporter::explicitExportSparseModel(sequentialStream, modelPtr, {});
+    std::stringstream parallelStream;
+    storm::exporter::explicitExportSparseModel(parallelStream, modelPtr, {}, 4);
+    EXPECT_EQ(sequentialStream.str(), parallelStream.str());
+
+    // The values are written without loss of precision, so the parsed model is identical.
+    std::shared_ptr<storm::models::sparse::Model<double>> parsedModelPtr = parseExport(sequentialStream.str());
+    ASSERT_EQ(storm::models::ModelType::Mdp, parsedModelPtr->getType());
+    EXPECT_EQ(modelPtr->getTransitionMatrix(), parsedModelPtr->getTransitionMatrix());
+    EXPECT_EQ(modelPtr->getStateLabeling(), parsedModelPtr->getStateLabeling());
+}
+
+TEST(DirectEncodingExporterTest, RewardsRoundTrip) {
+    // A model with more than one chunk of states, rewards and probabilities that are not exactly representable.
+    storm::storage::SparseMatrixBuilder<double> builder(3000, 3000, 6000);
+    std::vector<double> stateRewards(3000);
+    for (uint64_t state = 0; state < 3000; ++state) {
+        if (state + 1 < 3000) {
+            builder.addNextValue(state, state, 1.0 / 3.0);
+            builder.addNextValue(state, state + 1, 2.0 / 3.0);
+        } else {
+            builder.addNextValue(state, 0, 2.0 / 3.0);
+            builder.addNextValue(state, state, 1.0 / 3.0);
+        }
+        stateRewards[state] = 0.1 * state;
+    }
+    storm::models::sparse::StateLabeling labeling(3000);
+    labeling.addLabel("init");
+    labeling.addLabelToState("init", 0);
+    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<double>> rewardModels;
+    rewardModels.emplace("rew", storm::models::sparse::StandardRewardModel<double>(std::move(stateRewards)));
+    std::shared_ptr<storm::models::sparse::Model<double>> modelPtr = std::make_shared<storm::models::sparse::Dtmc<double>>(builder.build(), std::move(labeling), std::move(rewardModels));
+
+    std::stringstream sequentialStream;
+    storm::exporter::explicitExportSparseModel(sequentialStream, modelPtr, {});
+    std::stringstream parallelStream;
+    storm::exporter::explicitExportSparseModel(parallelStream, modelPtr, {}, 3);
+    EXPECT_EQ(sequentialStream.str(), parallelStream.str());
+
+    std::shared_ptr<storm::models::sparse::Model<double>> parsedModelPtr = parseExport(sequentialStream.str());
+    EXPECT_EQ(modelPtr->getTransitionMatrix(), parsedModelPtr->getTransitionMatrix());
+    ASSERT_TRUE(parsedModelPtr->hasRewardModel("rew"));
+    EXPECT_EQ(modelPtr->getRewardModel("rew").getStateRewardVector(), parsedModelPtr->getRewardModel("rew").getStateRewardVector());
+}
@@ -0,0 +1,90 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+#include "storm/utility/Instrumentation.h"
+#include "storm/utility/ThreadPool.h"
+
+#include <sstream>
+
+#include "json.hpp"
+
+namespace {
+    nlohmann::json findChild(nlohmann::json const& node, std::string const& name) {
+        for (auto const& child : node["children"]) {
+            if (child["name"] == name) {
+                return child;
+            }
+        }
+        return nlohmann::json();
+    }
+}
+
+TEST(InstrumentationTest, Disabled) {
+    storm::utility::instrumentation::reset();
+    {
+        storm::utility::instrumentation::Scope scope("phase");
+        storm::utility::instrumentation::addToCounter("iterations", 3);
+    }
+    EXPECT_FALSE(storm::utility::instrumentation::isEnabled());
+    std::stringstream stream;
+    EXPECT_ANY_THROW(storm::utility::instrumentation::exportToJson(stream));
+}
+
+TEST(InstrumentationTest, NestedScopes) {
+    storm::utility::instrumentation::reset();
+    storm::utility::instrumentation::enable();
+    for (uint64_t round = 0; round < 3; ++round) {
+        storm::utility::instrumentation::Scope scope("phase");
+        storm::utility::instrumentation::addToCounter("iterations", 2);
+        {
+            storm::utility::instrumentation::Scope innerScope("subphase");
+            storm::utility::instrumentation::countMultiplication(10);
+        }
+    }
+    storm::utility::instrumentation::addToCounter("outside", 1);
+
+    std::stringstream stream;
+    storm::utility::instrumentation::exportToJson(stream);
+    storm::utility::instrumentation::reset();
+
+    nlohmann::json report = nlohmann::json::parse(stream.str());
+    EXPECT_EQ("total", report["name"]);
+    EXPECT_EQ(1ull, report["counters"]["outside"].get<uint64_t>());
+    EXPECT_GT(report["peak-memory"].get<uint64_t>(), 0ull);
+
+    nlohmann::json phase = findChild(report, "phase");
+    ASSERT_FALSE(phase.is_null());
+    EXPECT_EQ(3ull, phase["invocations"].get<uint64_t>());
+    EXPECT_EQ(6ull, phase["counters"]["iterations"].get<uint64_t>());
+    EXPECT_LE(phase["time"].get<double>(), report["time"].get<double>());
+
+    nlohmann::json subphase = findChild(phase, "subphase");
+    ASSERT_FALSE(subphase.is_null());
+    EXPECT_EQ(3ull, subphase["invocations"].get<uint64_t>());
+    EXPECT_EQ(3ull, subphase["counters"]["multiplications"].get<uint64_t>());
+    EXPECT_EQ(30ull, subphase["counters"]["nonzeros"].get<uint64_t>());
+}
+
+TEST(InstrumentationTest, ThreadPool) {
+    storm::utility::instrumentation::reset();
+    storm::utility::instrumentation::enable();
+    storm::utility::ThreadPool pool(4);
+    {
+        storm::utility::instrumentation::Scope scope("parallel");
+        pool.execute(100, [] (uint64_t, uint64_t) {
+            storm::utility::instrumentation::countMultiplication(5);
+        });
+    }
+
+    std::stringstream stream;
+    storm::utility::instrumentation::exportToJson(stream);
+    storm::utility::instrumentation::reset();
+
+    // The work of all threads is attributed to the scope in which it was issued.
+    nlohmann::json report = nlohmann::json::parse(stream.str());
+    nlohmann::json parallel = findChild(report, "parallel");
+    ASSERT_FALSE(parallel.is_null());
+    EXPECT_EQ(100ull, parallel["counters"]["multiplications"].get<uint64_t>());
+    EXPECT_EQ(500ull, parallel["counters"]["nonzeros"].get<uint64_t>());
+    EXPECT_GE(parallel["threads"].size(), 1ull);
+    EXPECT_TRUE(report["counters"].is_null());
+}
@@ -0,0 +1,48 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+#include "storm/utility/ThreadPool.h"
+
+#include <atomic>
+#include <stdexcept>
+
+TEST(ThreadPoolTest, ProcessAllChunks) {
+    storm::utility::ThreadPool pool(4);
+    ASSERT_EQ(4ull, pool.getNumberOfThreads());
+
+    uint64_t const numberOfChunks = 1000;
+    std::vector<uint64_t> processed(numberOfChunks, 0);
+    std::vector<uint64_t> sumPerThread(pool.getNumberOfThreads(), 0);
+    // Repeat the execution to check that the pool can be reused.
+    for (uint64_t round = 0; round < 10; ++round) {
+        pool.execute(numberOfChunks, [&] (uint64_t chunk, uint64_t thread) {
+            ++processed[chunk];
+            sumPerThread[thread] += chunk;
+        });
+    }
+
+    uint64_t sum = 0;
+    for (auto const& threadSum : sumPerThread) {
+        sum += threadSum;
+    }
+    EXPECT_EQ(10 * numberOfChunks * (numberOfChunks - 1) / 2, sum);
+    for (auto const& count : processed) {
+        EXPECT_EQ(10ull, count);
+    }
+}
+
+TEST(ThreadPoolTest, Exception) {
+    storm::utility::ThreadPool pool(3);
+    std::atomic<uint64_t> numberOfProcessedChunks(0);
+    EXPECT_THROW(pool.execute(100, [&] (uint64_t chunk, uint64_t) {
+        ++numberOfProcessedChunks;
+        if (chunk == 42) {
+            throw std::runtime_error("Test");
+        }
+    }), std::runtime_error);
+    EXPECT_EQ(100ull, numberOfProcessedChunks.load());
+
+    // The pool can still be used after an exception.
+    numberOfProcessedChunks = 0;
+    pool.execute(10, [&] (uint64_t, uint64_t) { ++numberOfProcessedChunks; });
+    EXPECT_EQ(10ull, numberOfProcessedChunks.load());
+}